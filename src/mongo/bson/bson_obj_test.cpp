@@ -628,4 +628,66 @@ TEST(BSONObj, addField) {
     ASSERT_BSONOBJ_EQ(obj, BSON("a" << 1 << "b" << 2));
 }
 
+TEST(BSONObjGetOwnedSharing, SubobjectSharesParentBuffer) {
+    BSONObj parent = BSON("sub" << BSON("a" << 1 << "b" << 2)).getOwned();
+    BSONObj sub = parent["sub"].Obj();
+    ASSERT_FALSE(sub.isOwned());
+
+    BSONObj shared = sub.getOwned(parent);
+    ASSERT_TRUE(shared.isOwned());
+    // No copy: the slice still points into the parent's buffer.
+    ASSERT_EQ(static_cast<const void*>(shared.objdata()), static_cast<const void*>(sub.objdata()));
+    ASSERT_BSONOBJ_EQ(shared, BSON("a" << 1 << "b" << 2));
+}
+
+TEST(BSONObjGetOwnedSharing, SliceKeepsParentBufferAlive) {
+    BSONObj shared;
+    {
+        BSONObj parent = BSON("sub" << BSON("a" << 1)).getOwned();
+        shared = parent["sub"].Obj().getOwned(parent);
+    }
+    // The parent BSONObj is gone but the refcounted buffer must survive.
+    ASSERT_BSONOBJ_EQ(shared, BSON("a" << 1));
+}
+
+TEST(BSONObjGetOwnedSharing, CopiesWhenParentUnownedOrUnrelated) {
+    BSONObj ownedParent = BSON("sub" << BSON("a" << 1)).getOwned();
+    BSONObj unownedParent(ownedParent.objdata());
+    BSONObj sub = unownedParent["sub"].Obj();
+
+    // Unowned parent: must degrade to a copy.
+    BSONObj copied = sub.getOwned(unownedParent);
+    ASSERT_TRUE(copied.isOwned());
+    ASSERT_NE(static_cast<const void*>(copied.objdata()), static_cast<const void*>(sub.objdata()));
+
+    // Unrelated parent: must also degrade to a copy.
+    BSONObj unrelated = BSON("x" << 1).getOwned();
+    BSONObj copied2 = sub.getOwned(unrelated);
+    ASSERT_TRUE(copied2.isOwned());
+    ASSERT_NE(static_cast<const void*>(copied2.objdata()), static_cast<const void*>(sub.objdata()));
+    ASSERT_BSONOBJ_EQ(copied2, BSON("a" << 1));
+}
+
+TEST(BSONObjGetOwnedSharing, AlreadyOwnedIsANoOp) {
+    BSONObj obj = BSON("a" << 1).getOwned();
+    BSONObj parent = BSON("sub" << BSON("a" << 1)).getOwned();
+    BSONObj result = obj.getOwned(parent);
+    ASSERT_EQ(static_cast<const void*>(result.objdata()), static_cast<const void*>(obj.objdata()));
+}
+
+TEST(BSONElementSize, RegexIncludesTypeByte) {
+    BSONObjBuilder bob;
+    bob.appendRegex("re", "pattern", "i");
+    bob.append("after", 1);
+    BSONObj obj = bob.obj();
+
+    // Type byte + "re\0" + "pattern\0" + "i\0".
+    ASSERT_EQUALS(1 + 3 + 8 + 2, obj["re"].size());
+
+    // An undersized regex element would make iteration read a premature EOO out of the flags
+    // string's NUL terminator and silently drop every field after the regex.
+    ASSERT_EQUALS(2, obj.nFields());
+    ASSERT_EQUALS(1, obj["after"].numberInt());
+}
+
 }  // unnamed namespace
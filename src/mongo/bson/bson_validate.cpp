@@ -31,12 +31,17 @@
 #include <limits>
 #include <vector>
 
+#if defined(_M_AMD64) || defined(__amd64__)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/data_view.h"
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/bson_validate.h"
 #include "mongo/bson/oid.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 
 namespace mongo {
@@ -67,6 +72,34 @@ Status NOINLINE_DECL makeError(StringData baseMsg, BSONElement idElem, StringDat
     return Status(ErrorCodes::InvalidBSON, msg);
 }
 
+/**
+ * Returns the offset of the first NUL byte in [p, p + len), or 'len' if there is none.
+ *
+ * Equivalent to memchr(), but vectorized inline on x86_64 so that the very short strings
+ * that dominate validation (field names are typically well under 16 bytes) avoid the call
+ * overhead, while long strings are still scanned 16 bytes per iteration.
+ */
+inline uint64_t findNulByte(const char* p, uint64_t len) {
+#if defined(_M_AMD64) || defined(__amd64__)
+    const __m128i zero = _mm_setzero_si128();
+    uint64_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        if (mask)
+            return i + countTrailingZeros64(static_cast<unsigned>(mask));
+    }
+    for (; i < len; i++) {
+        if (p[i] == '\0')
+            return i;
+    }
+    return len;
+#else
+    const void* x = memchr(p, 0, len);
+    return x ? static_cast<uint64_t>(static_cast<const char*>(x) - p) : len;
+#endif
+}
+
 class Buffer {
 public:
     Buffer(const char* buffer, uint64_t maxLength, BSONVersion version)
@@ -89,10 +122,10 @@ public:
      * reading, if it exists. Otherwise, it should be empty.
      */
     Status readCString(StringData elemName, StringData* out) {
-        const void* x = memchr(_buffer + _position, 0, _maxLength - _position);
-        if (!x)
+        const uint64_t remaining = _maxLength - _position;
+        const uint64_t len = findNulByte(_buffer + _position, remaining);
+        if (len == remaining)
             return makeError("no end of c-string", _idElem, elemName);
-        uint64_t len = static_cast<uint64_t>(static_cast<const char*>(x) - (_buffer + _position));
 
         StringData data(_buffer + _position, len);
         _position += len + 1;
@@ -249,6 +249,24 @@ TEST(BSONValidateFast, NestedObject) {
     ASSERT_NOT_OK(validateBSON(x.objdata(), x.objsize() / 2, BSONVersion::kLatest));
 }
 
+TEST(BSONValidateFast, LongFieldNames) {
+    // Field names longer than one vector width exercise the chunked c-string scan.
+    const std::string longName(100, 'x');
+    BSONObj x = BSON(longName << 1 << longName + "y" << BSON(longName << "s"));
+    ASSERT_OK(validateBSON(x.objdata(), x.objsize(), BSONVersion::kLatest));
+    ASSERT_NOT_OK(validateBSON(x.objdata(), x.objsize() - 1, BSONVersion::kLatest));
+}
+
+TEST(BSONValidateFast, UnterminatedLongFieldName) {
+    BufBuilder bb;
+    BSONObjBuilder ob(bb);
+    ob.append("a", 1);
+    const BSONObj x = ob.done();
+    // Truncate the buffer mid-fieldname so no NUL terminator is reachable.
+    const Status status = validateBSON(x.objdata(), 6, BSONVersion::kLatest);
+    ASSERT_NOT_OK(status);
+}
+
 TEST(BSONValidateFast, ErrorWithId) {
     BufBuilder bb;
     BSONObjBuilder ob(bb);
@@ -37,6 +37,7 @@
 #include "mongo/base/compare_numbers.h"
 #include "mongo/base/data_cursor.h"
 #include "mongo/base/simple_string_data_comparator.h"
+#include "mongo/base/static_assert.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/platform/strnlen.h"
 #include "mongo/util/base64.h"
@@ -578,64 +579,78 @@ int BSONElement::size() const {
     if (totalSize >= 0)
         return totalSize;
 
-    int x = 0;
-    switch (type()) {
-        case EOO:
-        case Undefined:
-        case jstNULL:
-        case MaxKey:
-        case MinKey:
-            break;
-        case mongo::Bool:
-            x = 1;
-            break;
-        case NumberInt:
-            x = 4;
-            break;
-        case bsonTimestamp:
-        case mongo::Date:
-        case NumberDouble:
-        case NumberLong:
-            x = 8;
-            break;
-        case NumberDecimal:
-            x = 16;
-            break;
-        case jstOID:
-            x = OID::kOIDSize;
-            break;
-        case Symbol:
-        case Code:
-        case mongo::String:
-            x = valuestrsize() + 4;
-            break;
-        case DBRef:
-            x = valuestrsize() + 4 + 12;
-            break;
-        case CodeWScope:
-        case Object:
-        case mongo::Array:
-            x = objsize();
+    enum SizeStyle : uint8_t {
+        kFixed,         // Total size is fieldNameSize() plus a constant.
+        kIntPlusFixed,  // As kFixed, plus the int32 stored at value().
+        kRegEx,         // Needs special handling.
+    };
+    struct SizeInfo {
+        uint8_t style;
+        uint8_t bytes;  // Includes the type byte. Excludes the field name and any
+                        // variable-length payload counted by the int32 at value().
+    };
+
+    // Indexed by BSONType from EOO (0) through NumberDecimal (19). Note that for Object,
+    // Array and CodeWScope the int32 at value() includes its own four bytes, so only the
+    // type byte is added. MinKey and MaxKey fall outside the table and are handled below.
+    static const SizeInfo kSizeInfoTable[] = {
+        {kFixed, 1},          // EOO
+        {kFixed, 9},          // NumberDouble
+        {kIntPlusFixed, 5},   // String
+        {kIntPlusFixed, 1},   // Object
+        {kIntPlusFixed, 1},   // Array
+        {kIntPlusFixed, 6},   // BinData
+        {kFixed, 1},          // Undefined
+        {kFixed, 13},         // jstOID
+        {kFixed, 2},          // Bool
+        {kFixed, 9},          // Date
+        {kFixed, 1},          // jstNULL
+        {kRegEx, 1},          // RegEx (the two cstrings are counted below; this is the type byte)
+        {kIntPlusFixed, 17},  // DBRef
+        {kIntPlusFixed, 5},   // Code
+        {kIntPlusFixed, 5},   // Symbol
+        {kIntPlusFixed, 1},   // CodeWScope
+        {kFixed, 5},          // NumberInt
+        {kFixed, 9},          // bsonTimestamp
+        {kFixed, 9},          // NumberLong
+        {kFixed, 17},         // NumberDecimal
+    };
+    MONGO_STATIC_ASSERT(sizeof(kSizeInfoTable) / sizeof(kSizeInfoTable[0]) == JSTypeMax + 1);
+
+    const signed char rawType = *data;
+    if (rawType < 0 || rawType > JSTypeMax) {
+        // All types outside the table are value-less; anything else is invalid.
+        if (rawType != MinKey && rawType != MaxKey) {
+            StringBuilder ss;
+            ss << "BSONElement: bad type " << (int)rawType;
+            std::string msg = ss.str();
+            massert(10320, msg.c_str(), false);
+        }
+        totalSize = fieldNameSize() + 1;
+        return totalSize;
+    }
+
+    const SizeInfo& sizeInfo = kSizeInfoTable[rawType];
+    int x;
+    switch (sizeInfo.style) {
+        case kFixed:
+            x = 0;
             break;
-        case BinData:
-            x = valuestrsize() + 4 + 1 /*subtype*/;
+        case kIntPlusFixed:
+            x = valuestrsize();
             break;
-        case RegEx: {
+        case kRegEx: {
             const char* p = value();
             size_t len1 = strlen(p);
             p = p + len1 + 1;
-            size_t len2;
-            len2 = strlen(p);
+            size_t len2 = strlen(p);
             x = (int)(len1 + 1 + len2 + 1);
-        } break;
-        default: {
-            StringBuilder ss;
-            ss << "BSONElement: bad type " << (int)type();
-            std::string msg = ss.str();
-            massert(10320, msg.c_str(), false);
+            break;
         }
+        default:
+            MONGO_UNREACHABLE;
     }
-    totalSize = x + fieldNameSize() + 1;  // BSONType
+    totalSize = fieldNameSize() + sizeInfo.bytes + x;
 
     return totalSize;
 }
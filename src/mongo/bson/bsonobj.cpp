@@ -70,6 +70,18 @@ BSONObj BSONObj::getOwned() const {
     return copy();
 }
 
+BSONObj BSONObj::getOwned(const BSONObj& parent) const {
+    if (isOwned())
+        return *this;
+    if (parent.isOwned() && objdata() >= parent.objdata() &&
+        objdata() + objsize() <= parent.objdata() + parent.objsize()) {
+        BSONObj result = *this;
+        result.shareOwnershipWith(parent.sharedBuffer());
+        return result;
+    }
+    return copy();
+}
+
 string BSONObj::jsonString(JsonStringFormat format, int pretty, bool isArray) const {
     if (isEmpty())
         return isArray ? "[]" : "{}";
@@ -105,6 +117,9 @@ int BSONObj::woCompare(const BSONObj& r,
                        const Ordering& o,
                        bool considerFieldName,
                        const StringData::ComparatorInterface* comparator) const {
+    if (objdata() == r.objdata())
+        return 0;  // Identical buffers compare equal without walking the elements.
+
     if (isEmpty())
         return r.isEmpty() ? 0 : -1;
     if (r.isEmpty())
@@ -141,6 +156,9 @@ int BSONObj::woCompare(const BSONObj& r,
                        const BSONObj& idxKey,
                        bool considerFieldName,
                        const StringData::ComparatorInterface* comparator) const {
+    if (objdata() == r.objdata())
+        return 0;  // Identical buffers compare equal without walking the elements.
+
     if (isEmpty())
         return r.isEmpty() ? 0 : -1;
     if (r.isEmpty())
@@ -220,6 +220,18 @@ public:
     */
     BSONObj getOwned() const;
 
+    /**
+     * Returns an owned version of this object, sharing ownership of "parent"'s buffer instead
+     * of copying when this object is a view into it (e.g. a subobject obtained via
+     * BSONElement::Obj()). Falls back to getOwned() semantics when sharing is not possible:
+     * a no-op if already owned, a full copy if "parent" is unowned or does not contain this
+     * object's data.
+     *
+     * Use this instead of getOwned() when extracting embedded objects from large owned
+     * documents to avoid copying the parent's buffer region.
+     */
+    BSONObj getOwned(const BSONObj& parent) const;
+
     /** @return a new full (and owned) copy of the object. */
     BSONObj copy() const;
 
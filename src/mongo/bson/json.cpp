@@ -1184,7 +1184,15 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
             }
             ++q;
         } else {
-            result->push_back(*q++);
+            // Bulk-append the run of ordinary characters ending at the next terminal,
+            // escape, control character, or character outside the allowed set, rather
+            // than growing the result one byte at a time.
+            const char* runStart = q;
+            do {
+                ++q;
+            } while (q < _input_end && !match(*q, terminalSet) && *q != '\\' &&
+                     !(0x00 <= *q && *q <= 0x1F) && (allowedSet == NULL || match(*q, allowedSet)));
+            result->append(runStart, q);
         }
     }
     if (q < _input_end) {
@@ -1319,6 +1327,29 @@ BSONObj fromjson(const std::string& str) {
     return fromjson(str.c_str());
 }
 
+Status fromjson(StringData jsonString, BSONObjBuilder* builder, int* len) {
+    MONGO_JSON_DEBUG("jsonString: " << jsonString);
+    if (jsonString.empty()) {
+        if (len)
+            *len = 0;
+        return Status::OK();
+    }
+    JParse jparse(jsonString);
+    try {
+        Status ret = jparse.parse(*builder);
+        if (!ret.isOK()) {
+            return ret;
+        }
+    } catch (std::exception& e) {
+        std::ostringstream message;
+        message << "caught exception from within JSON parser: " << e.what();
+        return Status(ErrorCodes::FailedToParse, message.str());
+    }
+    if (len)
+        *len = jparse.offset();
+    return Status::OK();
+}
+
 std::string tojson(const BSONObj& obj, JsonStringFormat format, bool pretty) {
     return obj.jsonString(format, pretty);
 }
@@ -53,6 +53,16 @@ BSONObj fromjson(const std::string& str);
 /** @param len will be size of JSON object in text chars. */
 BSONObj fromjson(const char* str, int* len = NULL);
 
+/**
+ * Parses a JSON object or array directly into "builder", which the caller may preallocate
+ * and reuse across documents to amortize buffer growth during bulk ingestion. Unlike the
+ * throwing fromjson() overloads, parse failures are reported via the returned Status and no
+ * intermediate BSONObj is materialized. On error the builder's contents are unspecified.
+ *
+ * @param len if non-NULL, set to the number of input characters consumed on success.
+ */
+Status fromjson(StringData str, BSONObjBuilder* builder, int* len = NULL);
+
 /**
  * Tests whether the JSON string is an Array.
  *
@@ -565,8 +565,10 @@ public:
         _objects.reserve(2);
 
         // We always have at least one byte for the root field name, and we would like
-        // to be able to hold a few short field names without reallocation.
-        _fieldNames.reserve(8);
+        // to be able to hold the field names a typical update op materializes without
+        // reallocation. Once grown, the heap's capacity is retained across reset() so a
+        // reused Document performs no per-operation field name allocations at all.
+        _fieldNames.reserve(64);
 
         // We need an object at _objects[0] so that we can access leaf elements we
         // construct with the leaf builder in the same way we access elements serialized in
@@ -582,7 +584,11 @@ public:
     }
 
     void reset(Document::InPlaceMode inPlaceMode) {
-        // Clear out the state in the vectors.
+        // Clear out the state in the vectors. Note that clear() preserves each vector's
+        // capacity, as does BufBuilder::reset() below for the leaf heap, so a Document
+        // that is reset and reused across operations (see UpdateStage and the update
+        // driver's log document) behaves as a resettable arena: steady-state mutations
+        // perform no individual allocations or frees.
         _slowElements.clear();
         _numElements = 0;
 
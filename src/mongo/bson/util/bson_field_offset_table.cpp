@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/bson/util/bson_field_offset_table.h"
+
+#include <algorithm>
+
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+
+void BSONFieldOffsetTable::_build() const {
+    std::uint32_t ordinal = 0;
+    BSONObjIterator it(_obj);
+    while (it.more()) {
+        BSONElement e = it.next();
+        const auto offset = static_cast<std::uint32_t>(e.rawdata() - _obj.objdata());
+        _offsets.push_back({e.fieldNameStringData(), offset, ordinal++});
+    }
+    std::sort(_offsets.begin(), _offsets.end(), [](const Entry& lhs, const Entry& rhs) {
+        const int cmp = lhs.name.compare(rhs.name);
+        if (cmp != 0)
+            return cmp < 0;
+        return lhs.ordinal < rhs.ordinal;
+    });
+    _built = true;
+}
+
+BSONElement BSONFieldOffsetTable::lookup(StringData name) const {
+    if (!_built)
+        _build();
+
+    auto it = std::lower_bound(_offsets.begin(),
+                               _offsets.end(),
+                               name,
+                               [](const Entry& entry, StringData target) {
+                                   return entry.name.compare(target) < 0;
+                               });
+    if (it == _offsets.end() || it->name != name)
+        return BSONElement();
+    return BSONElement(_obj.objdata() + it->offset);
+}
+
+}  // namespace mongo
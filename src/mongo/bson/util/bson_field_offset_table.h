@@ -0,0 +1,99 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+/**
+ * An index over the field names of a single BSONObj that makes repeated field lookups
+ * O(log n) instead of the O(n) linear scan performed by BSONObj::getField().
+ *
+ * The table is built lazily on the first lookup, so constructing one is free and callers
+ * that end up performing only a single lookup pay no more than a plain getField(). It is
+ * worthwhile for consumers that look up several fields of a wide document by name, e.g.
+ * projection and expression evaluation over documents with hundreds of fields.
+ *
+ * The table stores byte offsets into the object's buffer rather than BSONElements, so it
+ * costs eight bytes per field. It holds a reference to the BSONObj passed at construction;
+ * as with BSONObj itself, the caller is responsible for ensuring the underlying buffer
+ * outlives the table unless the object is owned.
+ *
+ * Not thread safe.
+ */
+class BSONFieldOffsetTable {
+    MONGO_DISALLOW_COPYING(BSONFieldOffsetTable);
+
+public:
+    explicit BSONFieldOffsetTable(const BSONObj& obj) : _obj(obj) {}
+
+    /**
+     * Returns the first element of the indexed object whose field name equals "name", or
+     * an eoo element if there is no such field. Builds the offset table on first call.
+     */
+    BSONElement lookup(StringData name) const;
+
+    /**
+     * Returns true if the offset table has been populated by a prior lookup.
+     */
+    bool isBuilt() const {
+        return _built;
+    }
+
+    /**
+     * Returns the number of indexed fields. Valid only once isBuilt() returns true.
+     */
+    size_t numFields() const {
+        return _offsets.size();
+    }
+
+private:
+    struct Entry {
+        StringData name;        // Points into _obj's buffer.
+        std::uint32_t offset;   // Byte offset of the element from _obj.objdata().
+        std::uint32_t ordinal;  // Position of the field in the document, for tie-breaking.
+    };
+
+    void _build() const;
+
+    BSONObj _obj;
+
+    // Lazily populated, sorted by field name; ties (duplicate field names) are broken by
+    // document order so that lookup() returns the first occurrence, matching getField().
+    mutable std::vector<Entry> _offsets;
+    mutable bool _built = false;
+};
+
+}  // namespace mongo
@@ -0,0 +1,96 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <string>
+
+#include "mongo/bson/util/bson_field_offset_table.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONFieldOffsetTable, LookupFindsAllFields) {
+    BSONObj obj = BSON("a" << 1 << "b"
+                           << "hello"
+                           << "c"
+                           << BSON("x" << 1));
+    BSONFieldOffsetTable table(obj);
+    ASSERT_FALSE(table.isBuilt());
+
+    ASSERT_EQUALS(1, table.lookup("a").Int());
+    ASSERT_TRUE(table.isBuilt());
+    ASSERT_EQUALS(3U, table.numFields());
+    ASSERT_EQUALS(std::string("hello"), table.lookup("b").str());
+    ASSERT_BSONOBJ_EQ(BSON("x" << 1), table.lookup("c").Obj());
+}
+
+TEST(BSONFieldOffsetTable, LookupMissingFieldReturnsEoo) {
+    BSONObj obj = BSON("a" << 1);
+    BSONFieldOffsetTable table(obj);
+    ASSERT_TRUE(table.lookup("b").eoo());
+    ASSERT_TRUE(table.lookup("").eoo());
+}
+
+TEST(BSONFieldOffsetTable, EmptyObject) {
+    BSONFieldOffsetTable table(BSONObj{});
+    ASSERT_TRUE(table.lookup("a").eoo());
+    ASSERT_EQUALS(0U, table.numFields());
+}
+
+TEST(BSONFieldOffsetTable, LookupAgreesWithGetField) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < 200; ++i) {
+        bob.append("field" + std::to_string(i), i);
+    }
+    BSONObj obj = bob.obj();
+
+    BSONFieldOffsetTable table(obj);
+    for (int i = 199; i >= 0; --i) {
+        const std::string name = "field" + std::to_string(i);
+        BSONElement viaTable = table.lookup(name);
+        BSONElement viaScan = obj.getField(name);
+        ASSERT_EQUALS(viaScan.rawdata(), viaTable.rawdata());
+    }
+}
+
+TEST(BSONFieldOffsetTable, DuplicateFieldNamesReturnFirstOccurrence) {
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    BSONObj obj = bob.obj();
+
+    BSONFieldOffsetTable table(obj);
+    ASSERT_EQUALS(1, table.lookup("a").Int());
+    ASSERT_EQUALS(obj.getField("a").rawdata(), table.lookup("a").rawdata());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -106,20 +106,24 @@ public:
         return _buf.get();
     }
 
+    // Default initial capacity for builders using this allocator.
+    enum { SZ = 512 };
+
 private:
     SharedBuffer _buf;
 };
 
-class StackAllocator {
-    MONGO_DISALLOW_COPYING(StackAllocator);
+template <size_t InlineBytes>
+class BasicStackAllocator {
+    MONGO_DISALLOW_COPYING(BasicStackAllocator);
 
 public:
-    StackAllocator() = default;
-    ~StackAllocator() {
+    BasicStackAllocator() = default;
+    ~BasicStackAllocator() {
         free();
     }
 
-    enum { SZ = 512 };
+    enum { SZ = InlineBytes };
     void malloc(size_t sz) {
         if (sz > SZ)
             _ptr = mongoMalloc(sz);
@@ -152,10 +156,17 @@ private:
     void* _ptr = _buf;
 };
 
+using StackAllocator = BasicStackAllocator<512>;
+
+// Inline-storage variant for builders of tiny outputs (short diagnostic strings, generated
+// field names and the like), sized to be cheap to place on the stack or embed in another
+// object. Outputs larger than the inline buffer spill to the heap as usual.
+using SmallStackAllocator = BasicStackAllocator<64>;
+
 template <class BufferAllocator>
 class _BufBuilder {
 public:
-    _BufBuilder(int initsize = 512) : size(initsize) {
+    _BufBuilder(int initsize = BufferAllocator::SZ) : size(initsize) {
         if (size > 0) {
             _buf.malloc(size);
         }
@@ -378,6 +389,16 @@ public:
 };
 MONGO_STATIC_ASSERT(!std::is_move_constructible<StackBufBuilder>::value);
 
+/** Like StackBufBuilder, but with only 64 bytes of inline storage. Prefer this for outputs
+    that are almost always tiny, where StackBufBuilder's 512-byte frame would be wasteful.
+*/
+class SmallStackBufBuilder : public _BufBuilder<SmallStackAllocator> {
+public:
+    SmallStackBufBuilder() : _BufBuilder<SmallStackAllocator>(SmallStackAllocator::SZ) {}
+    void release() = delete;  // not allowed. not implemented.
+};
+MONGO_STATIC_ASSERT(!std::is_move_constructible<SmallStackBufBuilder>::value);
+
 /** std::stringstream deals with locale so this is a lot faster than std::stringstream for UTF8 */
 template <typename Allocator>
 class StringBuilderImpl {
@@ -517,4 +538,5 @@ private:
 
 typedef StringBuilderImpl<SharedBufferAllocator> StringBuilder;
 typedef StringBuilderImpl<StackAllocator> StackStringBuilder;
+typedef StringBuilderImpl<SmallStackAllocator> SmallStackStringBuilder;
 }  // namespace mongo
@@ -83,6 +83,36 @@ TEST(Builder, StackAllocatorShouldNotLeak) {
     // Let the builder go out of scope. If this leaks, it will trip the ASAN leak detector.
 }
 
+TEST(Builder, SmallStackAllocatorShouldNotLeak) {
+    SmallStackAllocator stackAlloc;
+    stackAlloc.malloc(SmallStackAllocator::SZ + 1);  // Force heap allocation.
+}
+
+TEST(Builder, SmallStackBufBuilderSpillsToHeap) {
+    SmallStackBufBuilder bb;
+    // Writes larger than the inline buffer must transparently move to the heap.
+    const std::string data(SmallStackAllocator::SZ * 3, 'x');
+    bb.appendStr(data, /*includeEndingNull*/ false);
+    ASSERT_EQUALS(bb.len(), static_cast<int>(data.size()));
+    ASSERT_EQUALS(StringData(bb.buf(), bb.len()), StringData(data));
+}
+
+TEST(Builder, SmallStackStringBuilder) {
+    SmallStackStringBuilder sb;
+    sb << "n" << 42;
+    ASSERT_EQUALS(sb.str(), "n42");
+
+    // Exceed the inline capacity and verify the contents survive the spill.
+    for (int i = 0; i < 100; i++) {
+        sb << i;
+    }
+    std::string expected = "n42";
+    for (int i = 0; i < 100; i++) {
+        expected += std::to_string(i);
+    }
+    ASSERT_EQUALS(sb.str(), expected);
+}
+
 template <typename T>
 void testStringBuilderIntegral() {
     auto check = [](T num) { ASSERT_EQ(std::string(str::stream() << num), std::to_string(num)); };
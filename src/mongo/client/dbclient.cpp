@@ -32,6 +32,7 @@
 #include "mongo/platform/basic.h"
 
 #include <algorithm>
+#include <deque>
 #include <utility>
 
 #include "mongo/base/status.h"
@@ -906,6 +907,67 @@ std::pair<rpc::UniqueReply, DBClientWithCommands*> DBClientConnection::runComman
     return out;
 }
 
+void DBClientConnection::runCommandsPipelined(
+    std::vector<OpMsgRequest> requests,
+    const stdx::function<void(const rpc::UniqueReply&)>& callback,
+    size_t maxInFlight) {
+    uassert(ErrorCodes::BadValue, "pipeline window must be at least 1", maxInFlight >= 1);
+
+    // Make sure to reconnect if needed before building any requests, since the requests depend on
+    // the negotiated protocol which can change due to a reconnect.
+    checkConnection();
+
+    auto host = getServerAddress();
+
+    // Protocols of the requests that have been sent but whose replies have not been read yet,
+    // in submission order.
+    std::deque<rpc::Protocol> inFlight;
+    size_t nextToSend = 0;
+    size_t numDelivered = 0;
+
+    while (numDelivered < requests.size()) {
+        // Fill the window before blocking on the next reply.
+        while (nextToSend < requests.size() && inFlight.size() < maxInFlight) {
+            auto& request = requests[nextToSend++];
+
+            if (getRequestMetadataWriter()) {
+                BSONObjBuilder metadataBob(std::move(request.body));
+                uassertStatusOK(getRequestMetadataWriter()(
+                    (haveClient() ? cc().getOperationContext() : nullptr), &metadataBob));
+                request.body = metadataBob.obj();
+            }
+
+            auto requestMsg = rpc::messageFromOpMsgRequest(
+                getClientRPCProtocols(), getServerRPCProtocols(), request);
+            inFlight.push_back(rpc::protocolForMessage(requestMsg));
+            say(requestMsg);
+        }
+
+        Message replyMsg;
+        uassert(ErrorCodes::HostUnreachable,
+                str::stream() << "network error while awaiting pipelined command reply from host '"
+                              << host
+                              << "' ",
+                recv(replyMsg));
+
+        auto commandReply = rpc::makeReply(&replyMsg);
+
+        uassert(ErrorCodes::RPCProtocolNegotiationFailed,
+                str::stream() << "Mismatched RPC protocols - pipelined reply '"
+                              << networkOpToString(replyMsg.operation())
+                              << "' does not match the protocol of its request",
+                inFlight.front() == commandReply->getProtocol());
+        inFlight.pop_front();
+
+        if (getReplyMetadataReader()) {
+            uassertStatusOK(getReplyMetadataReader()(commandReply->getMetadata(), host));
+        }
+
+        ++numDelivered;
+        callback(rpc::UniqueReply(std::move(replyMsg), std::move(commandReply)));
+    }
+}
+
 void DBClientConnection::_checkConnection() {
     if (!_failed)
         return;
@@ -239,7 +239,8 @@ void DBClientCursor::commandDataReceived(const Message& reply) {
                                                           _client->getServerAddress()));
     }
 
-    batch.objs.push_back(commandReply->getCommandReply().getOwned());
+    batch.objs.push_back(commandReply->getCommandReply());
+    batch.objs.back().shareOwnershipWith(reply.sharedBuffer());
 }
 
 void DBClientCursor::dataReceived(const Message& reply, bool& retry, string& host) {
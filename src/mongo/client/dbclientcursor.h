@@ -81,6 +81,12 @@ public:
        on an error at the remote server, you will get back:
          { $err: <std::string> }
        if you do not want to handle that yourself, call nextSafe().
+
+       Each returned object shares ownership of the reply message it was parsed from, so it
+       remains valid for as long as the caller holds it — no defensive getOwned() is needed.
+       Note that holding any document pins the entire batch's buffer; callers that retain a
+       small subset of documents long past the batch should copy those via getOwned() to let
+       the batch be freed.
     */
     BSONObj next();
 
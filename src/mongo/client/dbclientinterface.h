@@ -1048,6 +1048,22 @@ public:
     std::pair<rpc::UniqueReply, DBClientWithCommands*> runCommandWithTarget(
         OpMsgRequest request) override;
 
+    /**
+     * Runs a batch of commands over this connection, keeping up to 'maxInFlight' requests on the
+     * wire at once rather than waiting for each reply before sending the next request. 'callback'
+     * is invoked with each command's reply in the order the requests were submitted; the server
+     * processes one request per connection at a time, so replies arrive in submission order.
+     *
+     * The connection's socket must not be shared with any other concurrent operation while a
+     * pipelined batch is running. Throws on network errors; replies received before the error
+     * will already have been delivered to 'callback'.
+     */
+    void runCommandsPipelined(std::vector<OpMsgRequest> requests,
+                              const stdx::function<void(const rpc::UniqueReply&)>& callback,
+                              size_t maxInFlight = kDefaultPipelineMaxInFlight);
+
+    static const size_t kDefaultPipelineMaxInFlight = 16;
+
     /**
        @return true if this connection is currently in a failed state.  When autoreconnect is on,
                a connection will transition back to an ok state after reconnecting.
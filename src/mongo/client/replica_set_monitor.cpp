@@ -318,11 +318,58 @@ Refresher ReplicaSetMonitor::startOrContinueRefresh() {
 }
 
 void ReplicaSetMonitor::failedHost(const HostAndPort& host, const Status& status) {
-    stdx::lock_guard<stdx::mutex> lk(_state->mutex);
-    Node* node = _state->findNode(host);
-    if (node)
-        node->markFailed(status);
-    DEV _state->checkInvariants();
+    bool wasMaster = false;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_state->mutex);
+        Node* node = _state->findNode(host);
+        if (node) {
+            wasMaster = node->isMaster;
+            node->markFailed(status);
+        }
+        DEV _state->checkInvariants();
+    }
+
+    // Losing the primary is what blocked callers are waiting out, so kick off rediscovery right
+    // away rather than waiting for the next periodic refresh. Failures of nodes that were already
+    // known to be down don't re-expedite, since markFailed clears isMaster.
+    if (wasMaster) {
+        _expediteRefresh();
+    }
+}
+
+void ReplicaSetMonitor::_expediteRefresh() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (!_executor || _isRemovedFromManager.load()) {
+        return;
+    }
+
+    if (_refresherHandle) {
+        // The canceled callback will run with a CallbackCanceled status and return without
+        // rescheduling, leaving the immediate refresh below as the only one pending.
+        _executor->cancel(_refresherHandle);
+        _refresherHandle = {};
+    }
+
+    std::weak_ptr<ReplicaSetMonitor> that(shared_from_this());
+    auto status = _executor->scheduleWork([=](const CallbackArgs& cbArgs) {
+        if (auto ptr = that.lock()) {
+            ptr->_refresh(cbArgs);
+        }
+    });
+
+    if (status.getStatus() == ErrorCodes::ShutdownInProgress) {
+        LOG(1) << "Couldn't schedule expedited refresh for " << getName()
+               << ". Executor shutdown in progress";
+        return;
+    }
+
+    if (!status.isOK()) {
+        severe() << "Can't schedule expedited refresh for replica set " << getName()
+                 << causedBy(redact(status.getStatus()));
+        fassertFailed(40441);
+    }
+
+    _refresherHandle = status.getValue();
 }
 
 bool ReplicaSetMonitor::isPrimary(const HostAndPort& host) const {
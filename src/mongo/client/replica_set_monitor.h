@@ -267,12 +267,19 @@ private:
      */
     void _refresh(const executor::TaskExecutor::CallbackArgs&);
 
+    /**
+     * Cancels the periodic refresh scheduled for the future and replaces it with one that runs
+     * immediately. Called when the cached primary is reported failed, so rediscovery does not
+     * have to wait out the remainder of the refresh period.
+     */
+    void _expediteRefresh();
+
     // Serializes refresh and protects _refresherHandle
     stdx::mutex _mutex;
     executor::TaskExecutor::CallbackHandle _refresherHandle;
 
     const SetStatePtr _state;
-    executor::TaskExecutor* _executor;
+    executor::TaskExecutor* _executor = nullptr;
     AtomicBool _isRemovedFromManager{false};
 };
 
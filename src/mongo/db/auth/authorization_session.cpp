@@ -410,6 +410,11 @@ Status AuthorizationSession::_addPrivilegesForPipeline(const NamespaceString& ns
         } else if (str::equals("$collStats", firstStageSpec.fieldName())) {
             firstStagePrivilege =
                 Privilege(ResourcePattern::forExactNamespace(nss), ActionType::collStats);
+        } else if (str::equals("$diagnosticData", firstStageSpec.fieldName())) {
+            // Reading recorded diagnostic data requires the same privilege as the
+            // getDiagnosticData command.
+            firstStagePrivilege =
+                Privilege(ResourcePattern::forClusterResource(), ActionType::serverStatus);
         } else if (str::equals("$currentOp", firstStageSpec.fieldName())) {
             // Need to check the value of allUsers; if true then inprog privilege is required.
             // {$currentOp: {idleConnections: <boolean|false>, allUsers: <boolean|false>}}
@@ -967,11 +972,13 @@ bool AuthorizationSession::isAuthenticatedAsUserWithRole(const RoleName& roleNam
 
 void AuthorizationSession::_refreshUserInfoAsNeeded(OperationContext* opCtx) {
     AuthorizationManager& authMan = getAuthorizationManager();
+    bool usersChanged = false;
     UserSet::iterator it = _authenticatedUsers.begin();
     while (it != _authenticatedUsers.end()) {
         User* user = *it;
 
         if (!user->isValid()) {
+            usersChanged = true;
             // Make a good faith effort to acquire an up-to-date user object, since the one
             // we've cached is marked "out-of-date."
             UserName name = user->getName();
@@ -1033,7 +1040,11 @@ void AuthorizationSession::_refreshUserInfoAsNeeded(OperationContext* opCtx) {
         }
         ++it;
     }
-    _buildAuthenticatedRolesVector();
+    // Rebuilding the roles vector requires heap allocation, so skip it on the common path
+    // where no cached user was marked out-of-date. This runs at the start of every request.
+    if (usersChanged) {
+        _buildAuthenticatedRolesVector();
+    }
 }
 
 void AuthorizationSession::_buildAuthenticatedRolesVector() {
@@ -38,7 +38,6 @@
 #include "mongo/db/auth/user_name.h"
 #include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
-#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/dbhelpers.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
@@ -66,9 +65,9 @@ Status AuthzManagerExternalStateMongod::query(
     const BSONObj& projection,
     const stdx::function<void(const BSONObj&)>& resultProcessor) {
     try {
-        DBDirectClient client(opCtx);
-        client.query(resultProcessor, collectionName.ns(), query, &projection);
-        return Status::OK();
+        AutoGetCollectionForReadCommand ctx(opCtx, collectionName);
+        return Helpers::forEachMatch(
+            opCtx, ctx.getCollection(), query, projection, resultProcessor);
     } catch (const DBException& e) {
         return e.toStatus();
     }
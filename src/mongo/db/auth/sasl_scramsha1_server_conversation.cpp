@@ -39,6 +39,8 @@
 #include "mongo/crypto/sha1_block.h"
 #include "mongo/db/auth/sasl_options.h"
 #include "mongo/platform/random.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/base64.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
@@ -51,6 +53,54 @@ namespace mongo {
 using std::unique_ptr;
 using std::string;
 
+namespace {
+
+/**
+ * Cache of SCRAM credentials generated on the fly for users which have only MONGODB-CR
+ * credentials (mixed authSchema mode). Generating them runs the full PBKDF2 key derivation, so
+ * without a cache every connection from such a user repeats that work, turning a reconnection
+ * storm into an authentication pileup. Entries are keyed by user name, password digest and
+ * iteration count, so distinct users never share a salt and a password change makes the old
+ * entry unreachable.
+ */
+class MixedModeScramCredentialsCache {
+public:
+    BSONObj getOrGenerate(const std::string& user,
+                          const std::string& hashedPassword,
+                          int iterationCount) {
+        const std::string key =
+            user + '\0' + hashedPassword + '\0' + std::to_string(iterationCount);
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            auto it = _cache.find(key);
+            if (it != _cache.end()) {
+                return it->second;
+            }
+        }
+
+        // Run the key derivation without holding the mutex; concurrent callers for the same
+        // user may both derive, and the loser's entry simply replaces the winner's.
+        BSONObj scramCreds = scram::generateCredentials(hashedPassword, iterationCount);
+
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_cache.size() >= kMaxEntries) {
+            _cache.clear();
+        }
+        _cache[key] = scramCreds;
+        return scramCreds;
+    }
+
+private:
+    static const size_t kMaxEntries = 100;
+
+    stdx::mutex _mutex;
+    stdx::unordered_map<std::string, BSONObj> _cache;
+};
+
+MixedModeScramCredentialsCache mixedModeScramCredentialsCache;
+
+}  // namespace
+
 SaslSCRAMSHA1ServerConversation::SaslSCRAMSHA1ServerConversation(
     SaslAuthenticationSession* saslAuthSession)
     : SaslServerConversation(saslAuthSession), _step(0), _authMessage(""), _nonce("") {}
@@ -190,8 +240,8 @@ StatusWith<bool> SaslSCRAMSHA1ServerConversation::_firstStep(std::vector<string>
         // Use a default value of 5000 for the scramIterationCount when in mixed mode,
         // overriding the default value (10000) used for SCRAM mode or the user-given value.
         const int mixedModeScramIterationCount = 5000;
-        BSONObj scramCreds =
-            scram::generateCredentials(_creds.password, mixedModeScramIterationCount);
+        BSONObj scramCreds = mixedModeScramCredentialsCache.getOrGenerate(
+            _user, _creds.password, mixedModeScramIterationCount);
         _creds.scram.iterationCount = scramCreds[scram::iterationCountFieldName].Int();
         _creds.scram.salt = scramCreds[scram::saltFieldName].String();
         _creds.scram.storedKey = scramCreds[scram::storedKeyFieldName].String();
@@ -148,8 +148,14 @@ std::string CompactOptions::toString() const {
 CappedInsertNotifier::CappedInsertNotifier() : _version(0), _dead(false) {}
 
 void CappedInsertNotifier::notifyAll() {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    ++_version;
+    // Notify outside the mutex so that woken waiters don't immediately block on it again; with
+    // many tailing cursors on one collection, notifying under the lock makes every wakeup
+    // serialize against the inserting thread. Waiters recheck '_version' under the mutex, so a
+    // wakeup between the increment and their recheck is never lost.
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        ++_version;
+    }
     _notifier.notify_all();
 }
 
@@ -1302,14 +1302,14 @@ Status CollectionImpl::validate(OperationContext* opCtx,
 
         // Validate index key count.
         if (results->valid) {
+            const int64_t numRecs = _recordStore->numRecords(opCtx);
             IndexCatalog::IndexIterator i = _indexCatalog.getIndexIterator(opCtx, false);
             while (i.more()) {
                 IndexDescriptor* descriptor = i.next();
                 ValidateResults& curIndexResults = indexNsResultsMap[descriptor->indexNamespace()];
 
                 if (curIndexResults.valid) {
-                    indexValidator->validateIndexKeyCount(
-                        descriptor, _recordStore->numRecords(opCtx), curIndexResults);
+                    indexValidator->validateIndexKeyCount(descriptor, numRecs, curIndexResults);
                 }
             }
         }
@@ -30,6 +30,7 @@
 
 #include "mongo/db/collection_index_usage_tracker.h"
 #include "mongo/db/query/plan_cache.h"
+#include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/query_settings.h"
 #include "mongo/db/update_index_data.h"
 #include "mongo/stdx/functional.h"
@@ -66,7 +67,7 @@ public:
         virtual void clearQueryCache() = 0;
 
         virtual void notifyOfQuery(OperationContext* opCtx,
-                                   const std::set<std::string>& indexesUsed) = 0;
+                                   const PlanSummaryStats& summaryStats) = 0;
     };
 
 private:
@@ -149,12 +150,12 @@ public:
     }
 
     /**
-     * Signal to the cache that a query operation has completed.  'indexesUsed' should list the
-     * set of indexes used by the winning plan, if any.
+     * Signal to the cache that a query operation has completed.  'summaryStats.indexesUsed'
+     * should list the set of indexes used by the winning plan, if any.
      */
     inline void notifyOfQuery(OperationContext* const opCtx,
-                              const std::set<std::string>& indexesUsed) {
-        return this->_impl().notifyOfQuery(opCtx, indexesUsed);
+                              const PlanSummaryStats& summaryStats) {
+        return this->_impl().notifyOfQuery(opCtx, summaryStats);
     }
 
     std::unique_ptr<Impl> _pimpl;
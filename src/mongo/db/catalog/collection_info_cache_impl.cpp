@@ -151,7 +151,9 @@ void CollectionInfoCacheImpl::computeIndexKeys(OperationContext* opCtx) {
 }
 
 void CollectionInfoCacheImpl::notifyOfQuery(OperationContext* opCtx,
-                                            const std::set<std::string>& indexesUsed) {
+                                            const PlanSummaryStats& summaryStats) {
+    const std::set<std::string>& indexesUsed = summaryStats.indexesUsed;
+
     // Record indexes used to fulfill query.
     for (auto it = indexesUsed.begin(); it != indexesUsed.end(); ++it) {
         // This index should still exist, since the PlanExecutor would have been killed if the
@@ -160,6 +162,15 @@ void CollectionInfoCacheImpl::notifyOfQuery(OperationContext* opCtx,
 
         _indexUsageTracker.recordIndexAccess(*it);
     }
+
+    // When exactly one index served the plan, the plan-wide keys examined and documents
+    // returned tallies belong to that index unambiguously, so attribute them to it. Plans
+    // combining several indexes (index intersection, rooted $or) only bump 'accesses'.
+    if (indexesUsed.size() == 1) {
+        _indexUsageTracker.recordIndexScanStats(*indexesUsed.begin(),
+                                                summaryStats.totalKeysExamined,
+                                                summaryStats.nReturned);
+    }
 }
 
 void CollectionInfoCacheImpl::clearQueryCache() {
@@ -102,10 +102,10 @@ public:
     void clearQueryCache();
 
     /**
-     * Signal to the cache that a query operation has completed.  'indexesUsed' should list the
-     * set of indexes used by the winning plan, if any.
+     * Signal to the cache that a query operation has completed.  'summaryStats.indexesUsed'
+     * should list the set of indexes used by the winning plan, if any.
      */
-    void notifyOfQuery(OperationContext* opCtx, const std::set<std::string>& indexesUsed);
+    void notifyOfQuery(OperationContext* opCtx, const PlanSummaryStats& summaryStats);
 
 private:
     void computeIndexKeys(OperationContext* opCtx);
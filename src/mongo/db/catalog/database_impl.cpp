@@ -46,6 +46,7 @@
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/namespace_uuid_cache.h"
 #include "mongo/db/catalog/uuid_catalog.h"
+#include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
@@ -66,8 +67,11 @@
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/system_index.h"
 #include "mongo/db/views/view_catalog.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 namespace {
@@ -80,6 +84,32 @@ MONGO_INITIALIZER(InitializeDatabaseFactory)(InitializerContext* const) {
     });
     return Status::OK();
 }
+
+// Number of threads used to instantiate the collections of a database when it is opened. Zero
+// (the default) sizes the pool from the number of cores.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(numCollectionLoadingThreads, int, 0);
+
+// Databases with fewer collections than this are always loaded on the opening thread; spawning
+// loader threads is not worth it below this point.
+const size_t kMinCollectionsForParallelLoad = 64;
+
+// Cap for the automatically sized loader pool. Collection instantiation is mostly catalog reads,
+// which stop scaling well past this.
+const size_t kMaxCollectionLoadingThreads = 8;
+
+size_t numCollectionLoadingThreadsToUse(size_t numCollections) {
+    if (numCollections < kMinCollectionsForParallelLoad) {
+        return 1;
+    }
+
+    if (numCollectionLoadingThreads > 0) {
+        return static_cast<size_t>(numCollectionLoadingThreads);
+    }
+
+    return std::max<size_t>(
+        std::min(static_cast<size_t>(ProcessInfo().getNumCores()), kMaxCollectionLoadingThreads),
+        1);
+}
 }  // namespace
 
 using std::unique_ptr;
@@ -248,10 +278,15 @@ void DatabaseImpl::init(OperationContext* const opCtx) {
     list<string> collections;
     _dbEntry->getCollectionNamespaces(&collections);
 
-    for (list<string>::const_iterator it = collections.begin(); it != collections.end(); ++it) {
-        const string ns = *it;
-        NamespaceString nss(ns);
-        _collections[ns] = _getOrCreateCollectionInstance(opCtx, nss);
+    const std::vector<string> namespaces(collections.begin(), collections.end());
+    const size_t numLoaderThreads = numCollectionLoadingThreadsToUse(namespaces.size());
+
+    if (numLoaderThreads <= 1) {
+        for (const auto& ns : namespaces) {
+            _collections[ns] = _getOrCreateCollectionInstance(opCtx, NamespaceString(ns));
+        }
+    } else {
+        _loadCollectionsInParallel(namespaces, numLoaderThreads);
     }
 
     // At construction time of the viewCatalog, the _collections map wasn't initialized yet, so no
@@ -268,6 +303,63 @@ void DatabaseImpl::init(OperationContext* const opCtx) {
     }
 }
 
+void DatabaseImpl::_loadCollectionsInParallel(const std::vector<std::string>& namespaces,
+                                              size_t numThreads) {
+    LOG(1) << "loading " << namespaces.size() << " collections for database " << _name << " with "
+           << numThreads << " threads";
+
+    // The opening thread holds the global lock in exclusive mode, so the loader threads must not
+    // take any locks. They only perform read-only catalog lookups through their own operation
+    // contexts and each instantiates a disjoint set of collections, so no further synchronization
+    // is needed; the results are registered in the _collections map by this thread after the
+    // loaders are joined.
+    std::vector<std::vector<std::pair<std::string, Collection*>>> loaded(numThreads);
+
+    stdx::mutex statusMutex;
+    Status loadStatus = Status::OK();
+
+    std::vector<stdx::thread> loaderThreads;
+    for (size_t threadId = 0; threadId < numThreads; threadId++) {
+        loaderThreads.emplace_back([&, threadId] {
+            Client::initThread(str::stream() << "collectionLoader" << threadId);
+            auto loaderOpCtx = Client::getCurrent()->makeOperationContext();
+
+            try {
+                for (size_t i = threadId; i < namespaces.size(); i += numThreads) {
+                    const std::string& ns = namespaces[i];
+                    loaded[threadId].emplace_back(
+                        ns, _getOrCreateCollectionInstance(loaderOpCtx.get(), NamespaceString(ns)));
+                }
+            } catch (const DBException& ex) {
+                stdx::lock_guard<stdx::mutex> lk(statusMutex);
+                if (loadStatus.isOK()) {
+                    loadStatus = ex.toStatus();
+                }
+            }
+        });
+    }
+
+    for (auto& loaderThread : loaderThreads) {
+        loaderThread.join();
+    }
+
+    if (!loadStatus.isOK()) {
+        for (auto& threadCollections : loaded) {
+            for (auto& entry : threadCollections) {
+                delete entry.second;
+            }
+        }
+
+        uassertStatusOK(loadStatus);
+    }
+
+    for (auto& threadCollections : loaded) {
+        for (auto& entry : threadCollections) {
+            _collections[entry.first] = entry.second;
+        }
+    }
+}
+
 void DatabaseImpl::clearTmpCollections(OperationContext* opCtx) {
     invariant(opCtx->lockState()->isDbLockedForMode(name(), MODE_X));
 
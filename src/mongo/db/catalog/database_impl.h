@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
@@ -240,6 +241,14 @@ private:
      */
     Collection* _getOrCreateCollectionInstance(OperationContext* opCtx, const NamespaceString& nss);
 
+    /**
+     * Instantiates the given collections across a pool of loader threads and registers them in
+     * the _collections map. Only called from init(), while the opening thread holds the global
+     * lock exclusively. Throws the first error any loader encountered.
+     */
+    void _loadCollectionsInParallel(const std::vector<std::string>& namespaces,
+                                    size_t numThreads);
+
     /**
      * Throws if there is a reason 'ns' cannot be created as a user collection.
      */
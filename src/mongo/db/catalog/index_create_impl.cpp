@@ -55,6 +55,7 @@
 #include "mongo/util/processinfo.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/quick_exit.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -99,6 +100,31 @@ public:
 
 } exportedMaxIndexBuildMemoryUsageParameter;
 
+// Microseconds to sleep after each document indexed by a background build. Zero (the default)
+// disables the throttle. Settable at runtime, so an operator can slow a build down while it is
+// hurting foreground latency and speed it back up off-peak.
+AtomicInt32 backgroundIndexBuildThrottleMicros(0);
+
+class ExportedBackgroundIndexBuildThrottleParameter
+    : public ExportedServerParameter<std::int32_t, ServerParameterType::kStartupAndRuntime> {
+public:
+    ExportedBackgroundIndexBuildThrottleParameter()
+        : ExportedServerParameter<std::int32_t, ServerParameterType::kStartupAndRuntime>(
+              ServerParameterSet::getGlobal(),
+              "backgroundIndexBuildThrottleMicros",
+              &backgroundIndexBuildThrottleMicros) {}
+
+    virtual Status validate(const std::int32_t& potentialNewValue) {
+        if (potentialNewValue < 0 || potentialNewValue > 1000 * 1000) {
+            return Status(ErrorCodes::BadValue,
+                          "backgroundIndexBuildThrottleMicros must be between 0 and 1000000");
+        }
+
+        return Status::OK();
+    }
+
+} exportedBackgroundIndexBuildThrottleParameter;
+
 
 /**
  * On rollback sets MultiIndexBlockImpl::_needToCleanup to true.
@@ -350,9 +376,19 @@ Status MultiIndexBlockImpl::insertAllDocumentsInCollection(std::set<RecordId>* d
                 // Fail the index build hard.
                 return ret;
             }
-            if (_buildInBackground)
+            if (_buildInBackground) {
                 exec->restoreState();  // Handles any WCEs internally.
 
+                // Give foreground operations on the collection some breathing room if the
+                // operator asked for it. We sleep here, after the unit of work committed and
+                // outside of it, so no writes are pending while we wait. The plan executor's
+                // automatic yielding still releases our locks periodically.
+                const int throttleMicros = backgroundIndexBuildThrottleMicros.load();
+                if (throttleMicros > 0) {
+                    sleepmicros(throttleMicros);
+                }
+            }
+
             // Go to the next document
             progress->hit();
             n++;
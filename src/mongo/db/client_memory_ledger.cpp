@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/client_memory_ledger.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+namespace {
+
+// Field names for each Category, in enum order.
+const char* const kCategoryFieldNames[ClientMemoryLedger::kNumCategories] = {
+    "sortBytes",
+};
+
+}  // namespace
+
+const Client::Decoration<ClientMemoryLedger> ClientMemoryLedger::get =
+    Client::declareDecoration<ClientMemoryLedger>();
+
+void ClientMemoryLedger::adjust(Category category, long long delta) {
+    _bytesByCategory[category].fetchAndAdd(delta);
+}
+
+long long ClientMemoryLedger::bytes(Category category) const {
+    return _bytesByCategory[category].load();
+}
+
+long long ClientMemoryLedger::totalBytes() const {
+    long long total = 0;
+    for (int i = 0; i < kNumCategories; i++) {
+        total += _bytesByCategory[i].load();
+    }
+    return total;
+}
+
+void ClientMemoryLedger::report(BSONObjBuilder* builder) const {
+    const long long total = totalBytes();
+    if (total == 0) {
+        return;
+    }
+
+    BSONObjBuilder ledger(builder->subobjStart("memoryLedger"));
+    for (int i = 0; i < kNumCategories; i++) {
+        ledger.appendNumber(kCategoryFieldNames[i], _bytesByCategory[i].load());
+    }
+    ledger.appendNumber("totalBytes", total);
+    ledger.doneFast();
+}
+
+namespace {
+
+class MemoryLedgerServerStatusSection : public ServerStatusSection {
+public:
+    MemoryLedgerServerStatusSection() : ServerStatusSection("memoryLedger") {}
+
+    virtual bool includeByDefault() const {
+        return false;
+    }
+
+    virtual BSONObj generateSection(OperationContext* opCtx,
+                                    const BSONElement& configElement) const {
+        long long bytesByCategory[ClientMemoryLedger::kNumCategories] = {};
+        long long totalBytes = 0;
+        long long clientsWithCharges = 0;
+
+        for (ServiceContext::LockedClientsCursor cursor(opCtx->getServiceContext());
+             Client* client = cursor.next();) {
+            const ClientMemoryLedger& ledger = ClientMemoryLedger::get(client);
+            const long long total = ledger.totalBytes();
+            if (total == 0) {
+                continue;
+            }
+            clientsWithCharges++;
+            totalBytes += total;
+            for (int i = 0; i < ClientMemoryLedger::kNumCategories; i++) {
+                bytesByCategory[i] +=
+                    ledger.bytes(static_cast<ClientMemoryLedger::Category>(i));
+            }
+        }
+
+        BSONObjBuilder result;
+        result.appendNumber("clientsWithCharges", clientsWithCharges);
+        for (int i = 0; i < ClientMemoryLedger::kNumCategories; i++) {
+            result.appendNumber(kCategoryFieldNames[i], bytesByCategory[i]);
+        }
+        result.appendNumber("totalBytes", totalBytes);
+        return result.obj();
+    }
+} memoryLedgerServerStatusSection;
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/client.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * Per-client accounting of notable server-side memory, so that heap consumption can be
+ * attributed to the connection driving it. Subsystems that hold significant memory on behalf of
+ * an operation charge their usage here and release it when done; the balance is reported per
+ * client through currentOp and in aggregate through the "memoryLedger" serverStatus section.
+ *
+ * Charges are made by the thread running the owning client's operation, but may be read at any
+ * time by concurrent currentOp and serverStatus observers, hence the atomic counters.
+ */
+class ClientMemoryLedger {
+public:
+    static const Client::Decoration<ClientMemoryLedger> get;
+
+    /**
+     * New categories slot in above kNumCategories as more subsystems adopt the ledger.
+     */
+    enum Category {
+        kSort = 0,
+
+        kNumCategories,
+    };
+
+    /**
+     * Adjusts the balance for 'category' by 'delta' bytes. Callers are responsible for
+     * eventually releasing what they charge, including when their operation detaches from the
+     * client.
+     */
+    void adjust(Category category, long long delta);
+
+    /**
+     * Returns the current balance for 'category'.
+     */
+    long long bytes(Category category) const;
+
+    /**
+     * Returns the sum of all category balances.
+     */
+    long long totalBytes() const;
+
+    /**
+     * Appends a "memoryLedger" subdocument describing the current balances to 'builder'.
+     * Appends nothing if the ledger is empty, so idle connections' currentOp entries are
+     * unchanged.
+     */
+    void report(BSONObjBuilder* builder) const;
+
+private:
+    AtomicInt64 _bytesByCategory[kNumCategories];
+};
+
+}  // namespace mongo
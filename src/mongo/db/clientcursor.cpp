@@ -30,6 +30,7 @@
 
 #include "mongo/db/clientcursor.h"
 
+#include <algorithm>
 #include <string>
 #include <time.h>
 #include <vector>
@@ -49,9 +50,9 @@
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/repl/replication_coordinator_global.h"
 #include "mongo/db/server_parameters.h"
-#include "mongo/util/background.h"
-#include "mongo/util/concurrency/idle_thread_block.h"
-#include "mongo/util/exit.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/periodic_runner.h"
 
 namespace mongo {
 
@@ -73,6 +74,22 @@ static ServerStatusMetricField<Counter64> dCursorStatusTimedout("cursor.timedOut
 
 MONGO_EXPORT_SERVER_PARAMETER(clientCursorMonitorFrequencySecs, int, 4);
 
+// When positive, getMore requests without an explicit batchSize have their batches sized to
+// cover roughly this many milliseconds of client consumption, based on how quickly the client
+// returned for the previous batch. Zero keeps the default fill-to-the-byte-limit behavior.
+MONGO_EXPORT_SERVER_PARAMETER(adaptiveGetMoreBatchSizeTargetMillis, int, 0);
+
+namespace {
+
+// An adaptive hint never suggests fewer documents than this. It matches the default initial
+// find batch, so a consumer that stalls once is not stuck with tiny batches forever.
+const long long kMinAdaptiveBatchNumDocs = 101;
+
+// Cap on growth per step, so one anomalously quick getMore does not balloon the next batch.
+const long long kMaxAdaptiveBatchGrowthFactor = 4;
+
+}  // namespace
+
 long long ClientCursor::totalOpen() {
     return cursorStatsOpen.get();
 }
@@ -128,6 +145,33 @@ void ClientCursor::dispose(OperationContext* opCtx) {
     _disposed = true;
 }
 
+void ClientCursor::recordBatchReturned(Date_t now, long long numResults) {
+    _lastBatchReturnedDate = now;
+    _lastBatchNumResults = numResults;
+}
+
+boost::optional<long long> ClientCursor::getNextBatchSizeHint(Date_t now) const {
+    const long long targetMillis = adaptiveGetMoreBatchSizeTargetMillis.load();
+    if (targetMillis <= 0 || _lastBatchReturnedDate == Date_t() || _lastBatchNumResults <= 0) {
+        return boost::none;
+    }
+
+    // For awaitData cursors the gap between batches is dominated by server-side waiting for new
+    // data, not by the client, so it says nothing about the consumption rate.
+    if (isAwaitData()) {
+        return boost::none;
+    }
+
+    // The gap between handing the previous batch back and this request covers the round trip
+    // plus however long the client spent consuming that batch, which bounds the rate we can
+    // usefully feed it at.
+    const long long intervalMillis =
+        std::max(1LL, durationCount<Milliseconds>(now - _lastBatchReturnedDate));
+    long long hint = _lastBatchNumResults * targetMillis / intervalMillis;
+    hint = std::min(hint, _lastBatchNumResults * kMaxAdaptiveBatchGrowthFactor);
+    return std::max(hint, kMinAdaptiveBatchNumDocs);
+}
+
 void ClientCursor::updateSlaveLocation(OperationContext* opCtx) {
     if (_slaveReadTill.isNull())
         return;
@@ -268,32 +312,27 @@ namespace {
 // ClientCursorMonitor
 //
 
+// The time at which the cursor monitor job last swept for timed-out cursors. Only accessed by
+// the periodic runner's thread.
+Date_t clientCursorMonitorLastSweep;
+
 /**
- * Thread for timing out inactive cursors.
+ * Times out inactive cursors. Runs on the global periodic runner at a fixed one second cadence
+ * and only sweeps once 'clientCursorMonitorFrequencySecs' has elapsed since the previous sweep,
+ * so that the parameter remains adjustable at runtime.
  */
-class ClientCursorMonitor : public BackgroundJob {
-public:
-    std::string name() const {
-        return "ClientCursorMonitor";
-    }
-
-    void run() {
-        Client::initThread("clientcursormon");
-        while (!globalInShutdownDeprecated()) {
-            {
-                const ServiceContext::UniqueOperationContext opCtx = cc().makeOperationContext();
-                auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
-                cursorStatsTimedOut.increment(
-                    CursorManager::timeoutCursorsGlobal(opCtx.get(), now));
-            }
-            MONGO_IDLE_THREAD_BLOCK;
-            sleepsecs(clientCursorMonitorFrequencySecs.load());
-        }
+void clientCursorMonitorJob() {
+    auto serviceContext = getGlobalServiceContext();
+    const Date_t now = serviceContext->getPreciseClockSource()->now();
+    if (now - clientCursorMonitorLastSweep < Seconds(clientCursorMonitorFrequencySecs.load())) {
+        return;
     }
-};
+    clientCursorMonitorLastSweep = now;
 
-// Only one instance of the ClientCursorMonitor exists
-ClientCursorMonitor clientCursorMonitor;
+    const ServiceContext::UniqueOperationContext opCtx =
+        Client::getCurrent()->makeOperationContext();
+    cursorStatsTimedOut.increment(CursorManager::timeoutCursorsGlobal(opCtx.get(), now));
+}
 
 void _appendCursorStats(BSONObjBuilder& b) {
     b.append("note", "deprecated, use server status metrics");
@@ -306,7 +345,9 @@ void _appendCursorStats(BSONObjBuilder& b) {
 }
 
 void startClientCursorMonitor() {
-    clientCursorMonitor.go();
+    auto periodicRunner = getGlobalServiceContext()->getPeriodicRunner();
+    invariant(periodicRunner);
+    periodicRunner->scheduleJob({"ClientCursorMonitor", &clientCursorMonitorJob, Seconds(1)});
 }
 
 }  // namespace mongo
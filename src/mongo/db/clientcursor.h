@@ -183,6 +183,23 @@ public:
         _pos = n;
     }
 
+    /**
+     * Records that a batch of 'numResults' documents was handed back to the client at 'now'.
+     * Used together with getNextBatchSizeHint() to adapt the size of unhinted getMore batches
+     * to the rate at which the client actually consumes them.
+     */
+    void recordBatchReturned(Date_t now, long long numResults);
+
+    /**
+     * Returns a document-count limit to apply to the next getMore batch for clients that did
+     * not specify an explicit batchSize, or boost::none if adaptive batch sizing is disabled or
+     * there is not yet enough history to make a suggestion. The hint targets batches worth
+     * roughly 'adaptiveGetMoreBatchSizeTargetMillis' of client consumption: consumers that come
+     * straight back for more get bigger batches (fewer round trips), while consumers that
+     * linger over each batch get smaller ones.
+     */
+    boost::optional<long long> getNextBatchSizeHint(Date_t now) const;
+
     //
     // Timing.
     //
@@ -318,6 +335,12 @@ private:
     // Unused maxTime budget for this cursor.
     Microseconds _leftoverMaxTimeMicros = Microseconds::max();
 
+    // Time at which the most recent batch was handed back to the client, and the number of
+    // documents it held. Together these give the consumption rate behind
+    // getNextBatchSizeHint().
+    Date_t _lastBatchReturnedDate;
+    long long _lastBatchNumResults = 0;
+
     // The underlying query execution machinery. Must be non-null.
     std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> _exec;
 
@@ -49,6 +49,17 @@ void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName) {
     _indexUsageMap[indexName].accesses.fetchAndAdd(1);
 }
 
+void CollectionIndexUsageTracker::recordIndexScanStats(StringData indexName,
+                                                       long long keysExamined,
+                                                       long long docsReturned) {
+    invariant(!indexName.empty());
+    dassert(_indexUsageMap.find(indexName) != _indexUsageMap.end());
+
+    IndexUsageStats& stats = _indexUsageMap[indexName];
+    stats.keysExamined.fetchAndAdd(keysExamined);
+    stats.docsReturned.fetchAndAdd(docsReturned);
+}
+
 void CollectionIndexUsageTracker::registerIndex(StringData indexName, const BSONObj& indexKey) {
     invariant(!indexName.empty());
     dassert(_indexUsageMap.find(indexName) == _indexUsageMap.end());
@@ -57,11 +57,15 @@ public:
 
         IndexUsageStats(const IndexUsageStats& other)
             : accesses(other.accesses.load()),
+              keysExamined(other.keysExamined.load()),
+              docsReturned(other.docsReturned.load()),
               trackerStartTime(other.trackerStartTime),
               indexKey(other.indexKey) {}
 
         IndexUsageStats& operator=(const IndexUsageStats& other) {
             accesses.store(other.accesses.load());
+            keysExamined.store(other.keysExamined.load());
+            docsReturned.store(other.docsReturned.load());
             trackerStartTime = other.trackerStartTime;
             indexKey = other.indexKey;
             return *this;
@@ -70,6 +74,13 @@ public:
         // Number of operations that have used this index.
         AtomicInt64 accesses;
 
+        // Total number of index keys examined and documents returned by operations that used
+        // this index as the only index in their winning plan. Plans that combine several
+        // indexes are counted in 'accesses' only, since their per-index split is unknown.
+        // Comparing the two numbers shows how selective the index is for its workload.
+        AtomicInt64 keysExamined;
+        AtomicInt64 docsReturned;
+
         // Date/Time that we started tracking index usage.
         Date_t trackerStartTime;
 
@@ -91,6 +102,15 @@ public:
      */
     void recordIndexAccess(StringData indexName);
 
+    /**
+     * Record that an operation which used index 'indexName' as the only index in its winning
+     * plan examined 'keysExamined' index keys and returned 'docsReturned' documents. Safe to
+     * be called by multiple threads concurrently.
+     */
+    void recordIndexScanStats(StringData indexName,
+                              long long keysExamined,
+                              long long docsReturned);
+
     /**
      * Add map entry for 'indexName' stats collection. Must be called under exclusive collection
      * lock.
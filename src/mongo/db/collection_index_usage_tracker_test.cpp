@@ -83,6 +83,17 @@ TEST_F(CollectionIndexUsageTrackerTest, MultipleHit) {
     ASSERT_EQUALS(2, statsMap["foo"].accesses.loadRelaxed());
 }
 
+// Test that recorded scan statistics accumulate in the stats map.
+TEST_F(CollectionIndexUsageTrackerTest, ScanStats) {
+    getTracker()->registerIndex("foo", BSON("foo" << 1));
+    getTracker()->recordIndexScanStats("foo", 10, 2);
+    getTracker()->recordIndexScanStats("foo", 5, 5);
+    CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
+    ASSERT(statsMap.find("foo") != statsMap.end());
+    ASSERT_EQUALS(15, statsMap["foo"].keysExamined.loadRelaxed());
+    ASSERT_EQUALS(7, statsMap["foo"].docsReturned.loadRelaxed());
+}
+
 TEST_F(CollectionIndexUsageTrackerTest, IndexKey) {
     getTracker()->registerIndex("foo", BSON("foo" << 1));
     CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
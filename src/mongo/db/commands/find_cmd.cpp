@@ -53,6 +53,7 @@
 #include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
@@ -389,6 +390,8 @@ public:
                     opCtx->getRemainingMaxTimeMicros());
             }
             pinnedCursor.getCursor()->setPos(numResults);
+            pinnedCursor.getCursor()->recordBatchReturned(
+                opCtx->getServiceContext()->getPreciseClockSource()->now(), numResults);
 
             // Fill out curop based on the results.
             endQueryOp(opCtx, collection, *cursorExec, numResults, cursorId);
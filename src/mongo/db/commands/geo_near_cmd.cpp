@@ -318,7 +318,7 @@ public:
                             durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()));
         stats.done();
 
-        collection->infoCache()->notifyOfQuery(opCtx, summary.indexesUsed);
+        collection->infoCache()->notifyOfQuery(opCtx, summary);
 
         curOp->debug().setPlanSummaryMetrics(summary);
 
@@ -57,6 +57,7 @@
 #include "mongo/db/stats/top.h"
 #include "mongo/s/chunk_version.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
@@ -379,6 +380,8 @@ public:
             }
 
             cursor->incPos(numResults);
+            cursor->recordBatchReturned(opCtx->getServiceContext()->getPreciseClockSource()->now(),
+                                        numResults);
         } else {
             curOp->debug().cursorExhausted = true;
         }
@@ -440,9 +443,20 @@ public:
         // If an awaitData getMore is killed during this process due to our max time expiring at
         // an interrupt point, we just continue as normal and return rather than reporting a
         // timeout to the user.
+        // Clients that do not ask for a specific batchSize may have their batches bounded by
+        // the cursor's adaptive hint, derived from how quickly they consumed earlier batches.
+        long long effectiveBatchSize = request.batchSize.value_or(0);
+        if (!request.batchSize) {
+            auto hint = cursor->getNextBatchSizeHint(
+                opCtx->getServiceContext()->getPreciseClockSource()->now());
+            if (hint) {
+                effectiveBatchSize = *hint;
+            }
+        }
+
         BSONObj obj;
         try {
-            while (!FindCommon::enoughForGetMore(request.batchSize.value_or(0), *numResults) &&
+            while (!FindCommon::enoughForGetMore(effectiveBatchSize, *numResults) &&
                    PlanExecutor::ADVANCED == (*state = exec->getNext(&obj, NULL))) {
                 // If adding this object will cause us to exceed the message size limit, then we
                 // stash it for later.
@@ -1567,7 +1567,7 @@ public:
 
                 Collection* coll = scopedAutoDb->getDb()->getCollection(opCtx, config.nss);
                 invariant(coll);  // 'exec' hasn't been killed, so collection must be alive.
-                coll->infoCache()->notifyOfQuery(opCtx, stats.indexesUsed);
+                coll->infoCache()->notifyOfQuery(opCtx, stats);
 
                 if (curOp->shouldDBProfile()) {
                     BSONObjBuilder execStatsBob;
@@ -405,7 +405,7 @@ Status PlanCacheListPlans::list(OperationContext* opCtx,
         // Currently, simple string representationg of
         // SolutionCacheData. Need to revisit format when we
         // need to parse user-provided plan details for planCacheAddPlan.
-        SolutionCacheData* scd = entry->plannerData[i];
+        const SolutionCacheData* scd = entry->plannerData[i].get();
         BSONObjBuilder detailsBob(planBob.subobjStart("details"));
         detailsBob.append("solution", scd->toString());
         detailsBob.doneFast();
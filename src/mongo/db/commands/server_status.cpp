@@ -47,7 +47,9 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/process_id.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/transport/message_compressor_registry.h"
+#include "mongo/transport/service_executor_base.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/log.h"
 #include "mongo/util/net/hostname_canonicalization.h"
@@ -134,7 +136,14 @@ public:
                 continue;
             }
 
-            section->appendSection(opCtx, elem, &result);
+            // Serve cacheable sections from the section cache when the invocation passes no
+            // explicit configuration for them, so concurrent monitoring pollers share one
+            // generated result.
+            if (!elem.type() && section->cacheTTL() > Milliseconds(0)) {
+                _appendCachedSection(opCtx, section, elem, &result, clock);
+            } else {
+                section->appendSection(opCtx, elem, &result);
+            }
             timeBuilder.appendNumber(
                 static_cast<string>(str::stream() << "after " << section->getSectionName()),
                 durationCount<Milliseconds>(clock->now() - runStart));
@@ -179,11 +188,51 @@ public:
     }
 
 private:
+    /**
+     * Appends the output of "section" from the section cache, regenerating it first if the
+     * cached copy is missing or older than the section's TTL.
+     */
+    void _appendCachedSection(OperationContext* opCtx,
+                              ServerStatusSection* section,
+                              const BSONElement& configElement,
+                              BSONObjBuilder* result,
+                              ClockSource* clock) {
+        const auto now = clock->now();
+        {
+            stdx::lock_guard<stdx::mutex> lk(_sectionCacheMutex);
+            auto it = _sectionCache.find(section->getSectionName());
+            if (it != _sectionCache.end() && now - it->second.generatedAt < section->cacheTTL()) {
+                result->appendElements(it->second.data);
+                return;
+            }
+        }
+
+        // Generate without holding the cache mutex; concurrent callers may both generate, and
+        // the last one to finish refreshes the cache.
+        BSONObjBuilder sectionBuilder;
+        section->appendSection(opCtx, configElement, &sectionBuilder);
+        BSONObj data = sectionBuilder.obj();
+        result->appendElements(data);
+
+        stdx::lock_guard<stdx::mutex> lk(_sectionCacheMutex);
+        auto& entry = _sectionCache[section->getSectionName()];
+        entry.generatedAt = now;
+        entry.data = data;
+    }
+
+    struct CachedSection {
+        Date_t generatedAt;
+        BSONObj data;
+    };
+
     const Date_t _started;
     bool _runCalled;
 
     typedef map<string, ServerStatusSection*> SectionMap;
     SectionMap _sections;
+
+    stdx::mutex _sectionCacheMutex;
+    std::map<std::string, CachedSection> _sectionCache;
 };
 
 namespace {
@@ -296,6 +345,9 @@ public:
         BSONObjBuilder b;
         networkCounter.append(b);
         appendMessageCompressionStats(&b);
+        if (auto executor = opCtx->getServiceContext()->getServiceExecutor()) {
+            executor->appendStats(&b);
+        }
         return b.obj();
     }
 
@@ -34,6 +34,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/duration.h"
 #include <string>
 
 namespace mongo {
@@ -71,6 +72,18 @@ public:
      */
     virtual void addRequiredPrivileges(std::vector<Privilege>* out){};
 
+    /**
+     * How long the generated output of this section may be served from a cache. The default of
+     * zero means the section is regenerated on every serverStatus invocation. Sections that are
+     * expensive to generate (taking locks, marshalling storage engine statistics) can override
+     * this so that all invocations within the TTL share one generated result, and the cost of
+     * monitoring stops scaling with the number of polling agents. The cache is bypassed
+     * whenever the invocation passes explicit configuration for the section.
+     */
+    virtual Milliseconds cacheTTL() const {
+        return Milliseconds(0);
+    }
+
     /**
      * actually generate the result
      *
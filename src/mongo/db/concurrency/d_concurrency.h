@@ -362,6 +362,31 @@ public:
         Locker* const _lockState;
         const bool _orginalShouldConflict;
     };
+
+    /**
+     * Scoped opt-out from conflicting with the ParallelBatchWriterMode lock. While one of these
+     * is in scope, global lock acquisitions do not wait for oplog batch application. Only safe
+     * for operations whose view of the data cannot observe a half-applied batch, e.g. reads from
+     * a majority committed snapshot.
+     */
+    class ShouldNotConflictWithSecondaryBatchApplicationBlock {
+        MONGO_DISALLOW_COPYING(ShouldNotConflictWithSecondaryBatchApplicationBlock);
+
+    public:
+        explicit ShouldNotConflictWithSecondaryBatchApplicationBlock(Locker* lockState)
+            : _lockState(lockState),
+              _originalShouldConflict(_lockState->shouldConflictWithSecondaryBatchApplication()) {
+            _lockState->setShouldConflictWithSecondaryBatchApplication(false);
+        }
+
+        ~ShouldNotConflictWithSecondaryBatchApplicationBlock() {
+            _lockState->setShouldConflictWithSecondaryBatchApplication(_originalShouldConflict);
+        }
+
+    private:
+        Locker* const _lockState;
+        const bool _originalShouldConflict;
+    };
 };
 
 /**
@@ -32,6 +32,7 @@
 
 #include "mongo/db/concurrency/lock_manager.h"
 
+#include <algorithm>
 #include <third_party/murmurhash3/MurmurHash3.h>
 
 #include "mongo/base/data_type_endian.h"
@@ -41,6 +42,7 @@
 #include "mongo/config.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/locker.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 #include "mongo/util/stringutils.h"
@@ -407,14 +409,29 @@ void LockHead::migratePartitionedLockHeads() {
 // LockManager
 //
 
-// Have more buckets than CPUs to reduce contention on lock and caches
-const unsigned LockManager::_numLockBuckets(128);
+namespace {
+
+unsigned roundUpToPowerOfTwo(unsigned n) {
+    unsigned result = 1;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
 
-// Balance scalability of intent locks against potential added cost of conflicting locks.
-// The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+// May return 0 if the core count cannot be determined; callers apply a floor anyway.
+unsigned numCores() {
+    return stdx::thread::hardware_concurrency();
+}
+
+}  // namespace
 
-LockManager::LockManager() {
+LockManager::LockManager()
+    // Have more buckets than CPUs to reduce contention on lock and caches. The historical
+    // value of 128 remains the floor so small machines keep the same layout.
+    : _numLockBuckets(std::max(128u, roundUpToPowerOfTwo(4 * numCores()))),
+      // Balance scalability of intent locks against potential added cost of conflicting locks.
+      // The exact value doesn't appear very important, but should be power of two.
+      _numPartitions(std::max(32u, roundUpToPowerOfTwo(numCores()))) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
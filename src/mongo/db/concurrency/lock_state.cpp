@@ -32,12 +32,15 @@
 
 #include "mongo/db/concurrency/lock_state.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/pause.h"
 #include "mongo/stdx/new.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/debug_util.h"
@@ -50,11 +53,25 @@ namespace {
 /**
  * Partitioned global lock statistics, so we don't hit the same bucket.
  */
+unsigned roundUpToPowerOfTwo(unsigned n) {
+    unsigned result = 1;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
+
 class PartitionedInstanceWideLockStats {
     MONGO_DISALLOW_COPYING(PartitionedInstanceWideLockStats);
 
 public:
-    PartitionedInstanceWideLockStats() {}
+    // The partition count scales with the core count so that concurrently running lockers
+    // rarely share a stats cell. The historical value of 8 remains the floor; the array
+    // itself is statically sized since over-aligned types cannot be dynamically allocated
+    // with their alignment honored.
+    PartitionedInstanceWideLockStats()
+        : _numPartitions(
+              std::min(unsigned(kMaxPartitions),
+                       std::max(8u, roundUpToPowerOfTwo(stdx::thread::hardware_concurrency())))) {}
 
     void recordAcquisition(LockerId id, ResourceId resId, LockMode mode) {
         _get(id).recordAcquisition(resId, mode);
@@ -73,13 +90,13 @@ public:
     }
 
     void report(SingleThreadedLockStats* outStats) const {
-        for (int i = 0; i < NumPartitions; i++) {
+        for (unsigned i = 0; i < _numPartitions; i++) {
             outStats->append(_partitions[i].stats);
         }
     }
 
     void reset() {
-        for (int i = 0; i < NumPartitions; i++) {
+        for (unsigned i = 0; i < _numPartitions; i++) {
             _partitions[i].stats.reset();
         }
     }
@@ -91,15 +108,16 @@ private:
         AtomicLockStats stats;
     };
 
-    enum { NumPartitions = 8 };
+    enum { kMaxPartitions = 64 };
 
 
     AtomicLockStats& _get(LockerId id) {
-        return _partitions[id % NumPartitions].stats;
+        return _partitions[id % _numPartitions].stats;
     }
 
 
-    AlignedLockStats _partitions[NumPartitions];
+    const unsigned _numPartitions;
+    AlignedLockStats _partitions[kMaxPartitions];
 };
 
 
@@ -218,21 +236,35 @@ CondVarLockGrantNotification::CondVarLockGrantNotification() {
 }
 
 void CondVarLockGrantNotification::clear() {
-    _result = LOCK_INVALID;
+    _result.store(LOCK_INVALID);
 }
 
 LockResult CondVarLockGrantNotification::wait(Milliseconds timeout) {
+    // Lock conflicts frequently resolve within microseconds, in which case parking on the
+    // condition variable costs more than the conflict itself (a futex round trip both here
+    // and in notify). Spin briefly before sleeping; the bound keeps waiters on long
+    // conflicts from burning more than a few microseconds of CPU.
+    static const int kMaxSpinIterations = 1000;
+    for (int i = 0; i < kMaxSpinIterations; i++) {
+        const LockResult result = _result.load();
+        if (result != LOCK_INVALID) {
+            return result;
+        }
+        MONGO_YIELD_CORE_FOR_SMT();
+    }
+
     stdx::unique_lock<stdx::mutex> lock(_mutex);
-    return _cond.wait_for(
-               lock, timeout.toSystemDuration(), [this] { return _result != LOCK_INVALID; })
-        ? _result
+    return _cond.wait_for(lock,
+                          timeout.toSystemDuration(),
+                          [this] { return _result.load() != LOCK_INVALID; })
+        ? _result.load()
         : LOCK_TIMEOUT;
 }
 
 void CondVarLockGrantNotification::notify(ResourceId resId, LockResult result) {
     stdx::unique_lock<stdx::mutex> lock(_mutex);
-    invariant(_result == LOCK_INVALID);
-    _result = result;
+    invariant(_result.load() == LOCK_INVALID);
+    _result.store(result);
 
     _cond.notify_all();
 }
@@ -253,6 +285,11 @@ void Locker::setGlobalThrottling(class TicketHolder* reading, class TicketHolder
     ticketHolders[MODE_IX] = writing;
 }
 
+/* static */
+TicketHolder* Locker::getGlobalThrottling(LockMode mode) {
+    return ticketHolders[mode];
+}
+
 template <bool IsForMMAPV1>
 LockerImpl<IsForMMAPV1>::LockerImpl()
     : _id(idCounter.addAndFetch(1)), _wuowNestingLevel(0), _threadId(stdx::this_thread::get_id()) {}
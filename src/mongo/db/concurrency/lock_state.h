@@ -66,8 +66,9 @@ private:
     stdx::mutex _mutex;
     stdx::condition_variable _cond;
 
-    // Result from the last call to notify
-    LockResult _result;
+    // Result from the last call to notify. Atomic so that wait() can spin on it briefly
+    // without taking '_mutex' before parking on the condition variable.
+    AtomicWord<LockResult> _result;
 };
 
 
@@ -70,6 +70,12 @@ public:
      */
     static void setGlobalThrottling(class TicketHolder* reading, class TicketHolder* writing);
 
+    /**
+     * Returns the ticket holder which throttles global lock attempts in the given mode, or
+     * nullptr if the mode is not throttled. For diagnostics/reporting only.
+     */
+    static class TicketHolder* getGlobalThrottling(LockMode mode);
+
     /**
      * State for reporting the number of active and queued reader and writer clients.
      */
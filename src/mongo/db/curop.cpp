@@ -45,6 +45,7 @@
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/stringutils.h"
 
 namespace mongo {
@@ -263,6 +264,17 @@ void CurOp::setNS_inlock(StringData ns) {
 void CurOp::ensureStarted() {
     if (_start == 0) {
         _start = curTimeMicros64();
+        _cpuStart = getThreadCpuTimeMicros();
+    }
+}
+
+void CurOp::done() {
+    _end = curTimeMicros64();
+    if (_cpuStart >= 0) {
+        const long long cpuEnd = getThreadCpuTimeMicros();
+        if (cpuEnd >= 0) {
+            _debug.cpuTimeMicros = cpuEnd - _cpuStart;
+        }
     }
 }
 
@@ -530,6 +542,8 @@ string OpDebug::report(Client* client,
         s << " protocol:" << getProtoString(networkOp);
     }
 
+    OPDEBUG_TOSTRING_HELP(cpuTimeMicros);
+
     s << " " << (executionTimeMicros / 1000) << "ms";
 
     return s.str();
@@ -615,6 +629,7 @@ void OpDebug::append(const CurOp& curop,
         b.append("protocol", getProtoString(networkOp));
     }
     b.appendIntOrLL("millis", executionTimeMicros / 1000);
+    OPDEBUG_APPEND_NUMBER(cpuTimeMicros);
 
     if (!curop.getPlanSummary().empty()) {
         b.append("planSummary", curop.getPlanSummary());
@@ -125,6 +125,12 @@ public:
 
     // response info
     long long executionTimeMicros{0};
+
+    // CPU time consumed by the thread while running this operation, or -1 if the platform does
+    // not support cheap thread CPU time reads. Unlike executionTimeMicros this excludes time
+    // blocked on locks and I/O, so the two together separate compute-bound from wait-bound ops.
+    long long cpuTimeMicros{-1};
+
     long long nreturned{-1};
     int responseLength{-1};
 };
@@ -284,9 +290,7 @@ public:
         ensureStarted();
         return _start;
     }
-    void done() {
-        _end = curTimeMicros64();
-    }
+    void done();
     bool isDone() const {
         return _end > 0;
     }
@@ -460,6 +464,10 @@ private:
     // The time at which this CurOp instance was marked as started.
     long long _start{0};
 
+    // The thread CPU time at which this CurOp instance was marked as started, or -1 if the
+    // platform does not support reading it.
+    long long _cpuStart{-1};
+
     // The time at which this CurOp instance was marked as done.
     long long _end{0};
 
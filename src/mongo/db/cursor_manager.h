@@ -207,7 +207,11 @@ public:
     static std::size_t timeoutCursorsGlobal(OperationContext* opCtx, Date_t now);
 
 private:
-    static constexpr int kNumPartitions = 16;
+    // Pin and unpin each lock one partition on the getMore path, so the partition count bounds
+    // how many concurrent getMores can touch a manager without contending. 128 keeps the
+    // per-partition collision rate low even with tens of thousands of open tailing cursors,
+    // at the cost of one cache-aligned mutex and an empty map node per extra partition.
+    static constexpr int kNumPartitions = 128;
     friend class ClientCursorPin;
 
     struct PlanExecutorPartitioner {
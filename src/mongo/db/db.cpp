@@ -106,6 +106,7 @@
 #include "mongo/db/service_context_d.h"
 #include "mongo/db/service_entry_point_mongod.h"
 #include "mongo/db/session_catalog.h"
+#include "mongo/db/stall_watchdog.h"
 #include "mongo/db/startup_warnings_mongod.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/storage/encryption_hooks.h"
@@ -117,6 +118,7 @@
 #include "mongo/db/wire_version.h"
 #include "mongo/executor/network_connection_hook.h"
 #include "mongo/executor/network_interface_factory.h"
+#include "mongo/logger/persistent_ramlog.h"
 #include "mongo/platform/process_id.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
 #include "mongo/s/client/shard_registry.h"
@@ -141,6 +143,7 @@
 #include "mongo/util/net/listen.h"
 #include "mongo/util/net/ssl_manager.h"
 #include "mongo/util/ntservice.h"
+#include "mongo/util/numa_placement.h"
 #include "mongo/util/options_parser/startup_options.h"
 #include "mongo/util/periodic_runner.h"
 #include "mongo/util/periodic_runner_factory.h"
@@ -178,6 +181,37 @@ namespace {
 const NamespaceString startupLogCollectionName("local.startup_log");
 const NamespaceString kSystemReplSetCollection("local.system.replset");
 
+// When true, spreads connection worker threads round-robin across the host's NUMA nodes so that
+// each connection's memory stays node-local. See util/numa_placement.h.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(numaWorkerThreadPlacement, bool, false);
+
+// Size in MB of the crash-surviving ring that mirrors the tail of the global log into a
+// memory-mapped file under the dbpath. 0 disables the ring. See PersistentRamLog.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(persistentRamLogSizeMB, int, 0);
+
+/**
+ * Recovers the previous incarnation's log tail from <dbpath>/diagnostic.ramlog into the RamLog
+ * named "recovered" and starts mirroring the global log into the file. Failure to set up the ring
+ * only costs us post-crash triage, so it is logged and otherwise ignored.
+ */
+void startPersistentRamLog() {
+    if (persistentRamLogSizeMB <= 0) {
+        return;
+    }
+
+    const std::string path =
+        (boost::filesystem::path(storageGlobalParams.dbpath) / "diagnostic.ramlog").string();
+    auto swRing = PersistentRamLog::start(
+        path, static_cast<size_t>(persistentRamLogSizeMB) * 1024 * 1024);
+    if (!swRing.isOK()) {
+        warning() << "Failed to start persistent ram log: " << redact(swRing.getStatus());
+        return;
+    }
+
+    logger::globalLogDomain()->attachAppender(logger::MessageLogDomain::AppenderAutoPtr(
+        new PersistentRamLogAppender(swRing.getValue())));
+}
+
 #ifdef _WIN32
 ntservice::NtServiceDefaultStrings defaultServiceStrings = {
     L"MongoDB", L"MongoDB", L"MongoDB Server"};
@@ -552,6 +586,12 @@ ExitCode _initAndListen(int listenPort) {
 
     logMongodStartupWarnings(storageGlobalParams, serverGlobalParams);
 
+    if (numaWorkerThreadPlacement) {
+        numa::enableWorkerThreadPlacement();
+        log() << "NUMA worker thread placement enabled across " << numa::getNumNodes()
+              << " node(s)";
+    }
+
     {
         stringstream ss;
         ss << endl;
@@ -573,6 +613,8 @@ ExitCode _initAndListen(int listenPort) {
 
     if (!storageGlobalParams.readOnly) {
         boost::filesystem::remove_all(storageGlobalParams.dbpath + "/_tmp/");
+
+        startPersistentRamLog();
     }
 
     if (mmapv1GlobalOptions.journalOptions & MMAPV1Options::JournalRecoverOnly)
@@ -651,6 +693,7 @@ ExitCode _initAndListen(int listenPort) {
                             ->initializeShardingAwarenessIfNeeded(startupOpCtx.get()));
     if (shardingInitialized) {
         waitForShardRegistryReload(startupOpCtx.get()).transitional_ignore();
+        ShardingState::get(startupOpCtx.get())->prewarmHotCollections(startupOpCtx.get());
     }
 
     if (!storageGlobalParams.readOnly) {
@@ -693,6 +736,8 @@ ExitCode _initAndListen(int listenPort) {
             startTTLBackgroundJob();
         }
 
+        startStallWatchdog();
+
         if (!replSettings.usingReplSets() && !replSettings.isSlave() &&
             storageGlobalParams.engine != "devnull") {
             Lock::GlobalWrite lk(startupOpCtx.get());
@@ -706,8 +751,6 @@ ExitCode _initAndListen(int listenPort) {
         }
     }
 
-    startClientCursorMonitor();
-
     PeriodicTask::startRunningPeriodicTasks();
 
     // Set up the periodic runner for background job execution
@@ -715,6 +758,10 @@ ExitCode _initAndListen(int listenPort) {
     runner->startup().transitional_ignore();
     globalServiceContext->setPeriodicRunner(std::move(runner));
 
+    // The cursor monitor runs on the periodic runner, so it must be scheduled after the runner
+    // is installed on the service context.
+    startClientCursorMonitor();
+
     // Set up the logical session cache
     LogicalSessionCacheServer kind = LogicalSessionCacheServer::kStandalone;
     if (shardingInitialized) {
@@ -37,13 +37,20 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/repl/replication_coordinator_global.h"
 #include "mongo/db/s/collection_sharding_state.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/stats/top.h"
+#include "mongo/db/storage/recovery_unit.h"
 #include "mongo/util/fail_point_service.h"
 
 namespace mongo {
 
 namespace {
 MONGO_FP_DECLARE(setAutoGetCollectionWait);
+
+// When true, reads from a majority committed snapshot do not wait for oplog batch application
+// to finish on secondaries. Such reads cannot observe a half-applied batch, since the committed
+// snapshot only advances at batch boundaries.
+MONGO_EXPORT_SERVER_PARAMETER(allowSecondaryReadsDuringBatchApplication, bool, false);
 }  // namespace
 
 AutoGetDb::AutoGetDb(OperationContext* opCtx, StringData ns, LockMode mode)
@@ -126,6 +133,15 @@ AutoStatsTracker::~AutoStatsTracker() {
 AutoGetCollectionForRead::AutoGetCollectionForRead(OperationContext* opCtx,
                                                    const NamespaceString& nss,
                                                    AutoGetCollection::ViewMode viewMode) {
+    // Reads from the majority committed snapshot see the data as of a batch boundary, so they
+    // cannot observe a half-applied oplog batch and need not wait behind batch application. DDL
+    // performed while applying still takes stronger database locks, which the IS locks acquired
+    // below continue to conflict with.
+    if (allowSecondaryReadsDuringBatchApplication.load() &&
+        opCtx->recoveryUnit()->isReadingFromMajorityCommittedSnapshot()) {
+        _shouldNotConflictBlock.emplace(opCtx->lockState());
+    }
+
     _autoColl.emplace(opCtx, nss, MODE_IS, MODE_IS, viewMode);
 
     // Note: this can yield.
@@ -284,6 +284,12 @@ private:
     void _ensureMajorityCommittedSnapshotIsValid(const NamespaceString& nss,
                                                  OperationContext* opCtx);
 
+    // Engaged for majority committed snapshot reads when the server is configured to let them
+    // proceed during oplog batch application. Must precede '_autoColl' so the opt-out is in
+    // effect while the locks below are acquired, including the relocks during yields.
+    boost::optional<Lock::ShouldNotConflictWithSecondaryBatchApplicationBlock>
+        _shouldNotConflictBlock;
+
     boost::optional<AutoGetCollection> _autoColl;
 };
 
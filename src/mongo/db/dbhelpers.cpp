@@ -133,6 +133,49 @@ RecordId Helpers::findOne(OperationContext* opCtx,
     return RecordId();
 }
 
+Status Helpers::forEachMatch(OperationContext* opCtx,
+                             Collection* collection,
+                             const BSONObj& query,
+                             const BSONObj& projection,
+                             const stdx::function<void(const BSONObj&)>& resultProcessor) {
+    if (!collection)
+        return Status::OK();
+
+    const ExtensionsCallbackReal extensionsCallback(opCtx, &collection->ns());
+
+    auto qr = stdx::make_unique<QueryRequest>(collection->ns());
+    qr->setFilter(query);
+    if (!projection.isEmpty()) {
+        qr->setProj(projection);
+    }
+
+    auto statusWithCQ = CanonicalQuery::canonicalize(opCtx, std::move(qr), extensionsCallback);
+    if (!statusWithCQ.isOK()) {
+        return statusWithCQ.getStatus();
+    }
+
+    auto statusWithExec = getExecutor(opCtx,
+                                      collection,
+                                      std::move(statusWithCQ.getValue()),
+                                      PlanExecutor::YIELD_AUTO,
+                                      QueryPlannerParams::DEFAULT);
+    if (!statusWithExec.isOK()) {
+        return statusWithExec.getStatus();
+    }
+    auto exec = std::move(statusWithExec.getValue());
+
+    PlanExecutor::ExecState state;
+    BSONObj obj;
+    while (PlanExecutor::ADVANCED == (state = exec->getNext(&obj, nullptr))) {
+        resultProcessor(obj);
+    }
+    if (PlanExecutor::IS_EOF != state) {
+        return Status(ErrorCodes::OperationFailed,
+                      "Plan executor error: " + WorkingSetCommon::toStatusString(obj));
+    }
+    return Status::OK();
+}
+
 bool Helpers::findById(OperationContext* opCtx,
                        Database* database,
                        StringData ns,
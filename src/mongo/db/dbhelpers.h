@@ -31,9 +31,11 @@
 #include <boost/filesystem/path.hpp>
 #include <memory>
 
+#include "mongo/base/status.h"
 #include "mongo/db/db.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/data_protector.h"
+#include "mongo/stdx/functional.h"
 
 namespace mongo {
 
@@ -75,6 +77,21 @@ struct Helpers {
                             const BSONObj& query,
                             bool requireIndex);
 
+    /**
+     * Runs 'query' against 'collection', applying 'projection' if non-empty, and invokes
+     * 'resultProcessor' for each matching document. Goes straight from canonical query to
+     * PlanExecutor with no wire-protocol marshalling, so internal readers (auth cache refresh,
+     * metadata loads) should prefer this over DBDirectClient::query.
+     *
+     * The caller must hold the collection lock in at least MODE_IS. The executor yields, so the
+     * processor must not rely on state that a yield may invalidate.
+     */
+    static Status forEachMatch(OperationContext* opCtx,
+                               Collection* collection,
+                               const BSONObj& query,
+                               const BSONObj& projection,
+                               const stdx::function<void(const BSONObj&)>& resultProcessor);
+
     /**
      * @param foundIndex if passed in will be set to 1 if ns and index found
      * @return true if object found
@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/embedded_read_api.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/index/index_access_method.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+namespace embedded {
+namespace {
+
+/**
+ * Shared tail of the point lookups: resolves "key" through "desc" and fetches the document.
+ */
+StatusWith<BSONObj> fetchByIndexKey(OperationContext* opCtx,
+                                    Collection* collection,
+                                    const IndexDescriptor* desc,
+                                    const BSONObj& key) {
+    RecordId loc = collection->getIndexCatalog()->getIndex(desc)->findSingle(opCtx, key);
+    if (loc.isNull()) {
+        return Status(ErrorCodes::NoSuchKey,
+                      str::stream() << "no document in " << collection->ns().ns()
+                                    << " matches the requested key");
+    }
+    return collection->docFor(opCtx, loc).value().getOwned();
+}
+
+}  // namespace
+
+StatusWith<BSONObj> findById(OperationContext* opCtx,
+                             const NamespaceString& nss,
+                             const BSONElement& idValue) {
+    AutoGetCollectionForRead autoColl(opCtx, nss);
+    Collection* collection = autoColl.getCollection();
+    if (!collection) {
+        return Status(ErrorCodes::NamespaceNotFound,
+                      str::stream() << "collection " << nss.ns() << " does not exist");
+    }
+
+    const IndexDescriptor* desc = collection->getIndexCatalog()->findIdIndex(opCtx);
+    if (!desc) {
+        return Status(ErrorCodes::IndexNotFound,
+                      str::stream() << "collection " << nss.ns() << " has no _id index");
+    }
+
+    return fetchByIndexKey(opCtx, collection, desc, idValue.wrap("_id"));
+}
+
+StatusWith<BSONObj> findByIndex(OperationContext* opCtx,
+                                const NamespaceString& nss,
+                                StringData indexName,
+                                const BSONObj& key) {
+    AutoGetCollectionForRead autoColl(opCtx, nss);
+    Collection* collection = autoColl.getCollection();
+    if (!collection) {
+        return Status(ErrorCodes::NamespaceNotFound,
+                      str::stream() << "collection " << nss.ns() << " does not exist");
+    }
+
+    const IndexDescriptor* desc =
+        collection->getIndexCatalog()->findIndexByName(opCtx, indexName);
+    if (!desc) {
+        return Status(ErrorCodes::IndexNotFound,
+                      str::stream() << "collection " << nss.ns() << " has no index named "
+                                    << indexName);
+    }
+
+    return fetchByIndexKey(opCtx, collection, desc, key);
+}
+
+}  // namespace embedded
+}  // namespace mongo
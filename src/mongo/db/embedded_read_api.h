@@ -0,0 +1,79 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/base/status_with.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/namespace_string.h"
+
+namespace mongo {
+
+class OperationContext;
+
+/**
+ * Minimal in-process point-read API for trusted code linked into the server.
+ *
+ * These functions go straight from an index lookup to a record fetch, skipping the transport
+ * layer, authorization, and command dispatch. They are intended for embedders that co-locate
+ * with mongod, are fully trusted, and need microsecond-class lookups; everything else should go
+ * through DBDirectClient or the wire protocol, which enforce the layers these bypass.
+ *
+ * Callers provide their own OperationContext. A thread that does not already have one creates it
+ * the usual way: Client::initThread(...) followed by Client::getCurrent()->makeOperationContext().
+ * Locking is handled internally; callers must not hold locks on the target namespace.
+ */
+namespace embedded {
+
+/**
+ * Returns the document in "nss" whose _id equals "idValue", as an owned object.
+ *
+ * Returns NamespaceNotFound if the collection does not exist, IndexNotFound if it has no _id
+ * index, and NoSuchKey if no document matches.
+ */
+StatusWith<BSONObj> findById(OperationContext* opCtx,
+                             const NamespaceString& nss,
+                             const BSONElement& idValue);
+
+/**
+ * Returns the first document in "nss" whose entry in the index named "indexName" exactly equals
+ * "key", as an owned object. "key" must have one element per field of the index key pattern, in
+ * pattern order; field names are ignored. For non-unique indexes an arbitrary matching document
+ * is returned.
+ *
+ * Returns NamespaceNotFound if the collection does not exist, IndexNotFound if no index has that
+ * name, and NoSuchKey if no document matches.
+ */
+StatusWith<BSONObj> findByIndex(OperationContext* opCtx,
+                                const NamespaceString& nss,
+                                StringData indexName,
+                                const BSONObj& key);
+
+}  // namespace embedded
+}  // namespace mongo
@@ -61,6 +61,7 @@ CollectionScan::CollectionScan(OperationContext* opCtx,
     : PlanStage(kStageType, opCtx),
       _workingSet(workingSet),
       _filter(filter),
+      _flatFilter(FlatFilter::compile(filter)),
       _params(params),
       _isDead(false),
       _wsidForFetch(_workingSet->allocate()) {
@@ -184,9 +185,19 @@ PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
                                                       WorkingSetID* out) {
     ++_specificStats.docsTested;
 
-    if (Filter::passes(member, _filter)) {
+    bool passes;
+    boost::optional<bool> flatResult;
+    if (_filter && _flatFilter && member->hasObj() &&
+        (flatResult = _flatFilter->matches(member->obj.value()))) {
+        passes = *flatResult;
+    } else {
+        passes = Filter::passes(member, _filter);
+    }
+
+    if (passes) {
         if (_params.stopApplyingFilterAfterFirstMatch) {
             _filter = nullptr;
+            _flatFilter.reset();
         }
         *out = memberID;
         return PlanStage::ADVANCED;
@@ -31,6 +31,7 @@
 #include <memory>
 
 #include "mongo/db/exec/collection_scan_common.h"
+#include "mongo/db/exec/flat_filter.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/record_id.h"
@@ -86,6 +87,10 @@ private:
     // The filter is not owned by us.
     const MatchExpression* _filter;
 
+    // Compiled fast path for simple conjunctive filters. Null if '_filter' is null or does
+    // not have a supported shape.
+    std::unique_ptr<FlatFilter> _flatFilter;
+
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
     CollectionScanParams _params;
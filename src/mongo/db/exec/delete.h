@@ -45,6 +45,7 @@ struct DeleteStageParams {
           fromMigrate(false),
           isExplain(false),
           returnDeleted(false),
+          limit(0),
           canonicalQuery(nullptr),
           opDebug(nullptr) {}
 
@@ -62,6 +63,10 @@ struct DeleteStageParams {
     // Should we return the document we just deleted?
     bool returnDeleted;
 
+    // When nonzero, the maximum number of documents a multi delete will remove before reporting
+    // EOF. Used by internal callers (e.g. the TTL monitor) to delete in bounded batches.
+    long long limit;
+
     // The parsed query predicate for this delete. Not owned here.
     CanonicalQuery* canonicalQuery;
 
@@ -0,0 +1,128 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/flat_filter.h"
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/db/matcher/expression_leaf.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Returns true if 'expr' is a comparison leaf whose semantics are fully reproduced by a
+ * getField() extraction plus matchesSingleElement(): a simple comparison on a top-level
+ * path with a plain constant.
+ */
+bool isSupportedLeaf(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+            break;
+        default:
+            return false;
+    }
+
+    // Dotted paths implicitly traverse arrays and subobjects; leave those to the general
+    // matcher's ElementPath machinery.
+    const StringData path = expr->path();
+    if (path.empty() || path.find('.') != std::string::npos) {
+        return false;
+    }
+
+    // Comparisons with null match missing fields and explicit undefined, which getField()
+    // extraction does not model. Comparisons with MinKey/MaxKey are rare enough not to be
+    // worth auditing here.
+    const BSONElement& rhs = static_cast<const ComparisonMatchExpression*>(expr)->getData();
+    switch (rhs.type()) {
+        case jstNULL:
+        case Undefined:
+        case MinKey:
+        case MaxKey:
+            return false;
+        default:
+            return true;
+    }
+}
+
+}  // namespace
+
+std::unique_ptr<FlatFilter> FlatFilter::compile(const MatchExpression* expr) {
+    if (!expr) {
+        return nullptr;
+    }
+
+    std::unique_ptr<FlatFilter> filter(new FlatFilter());
+
+    if (expr->matchType() == MatchExpression::AND) {
+        if (expr->numChildren() == 0) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < expr->numChildren(); i++) {
+            const MatchExpression* child = expr->getChild(i);
+            if (!isSupportedLeaf(child)) {
+                return nullptr;
+            }
+            filter->_predicates.push_back({child->path(), child});
+        }
+    } else {
+        if (!isSupportedLeaf(expr)) {
+            return nullptr;
+        }
+        filter->_predicates.push_back({expr->path(), expr});
+    }
+
+    return filter;
+}
+
+boost::optional<bool> FlatFilter::matches(const BSONObj& obj) const {
+    for (std::vector<Predicate>::const_iterator it = _predicates.begin(); it != _predicates.end();
+         ++it) {
+        BSONElement elt = obj.getField(it->path);
+        if (elt.type() == Array) {
+            // Array values match if any element matches; punt to the general matcher.
+            return boost::none;
+        }
+        if (elt.eoo()) {
+            // A missing field cannot satisfy a non-null comparison.
+            return false;
+        }
+        if (!it->expr->matchesSingleElement(elt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace mongo
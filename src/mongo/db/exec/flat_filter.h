@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/matcher/expression.h"
+
+namespace mongo {
+
+/**
+ * A compiled fast path for the common conjunctive filter shape: a single comparison, or an
+ * AND of comparisons ($eq, $lt, $lte, $gt, $gte), each on a non-dotted path with a non-null
+ * constant. Evaluating through the general matcher walks a MatchableDocument and allocates
+ * an ElementIterator per predicate per document; this class instead extracts each path once
+ * with BSONObj::getField() and runs matchesSingleElement() directly against the stored leaf
+ * expressions.
+ *
+ * The fast path preserves matcher semantics by refusing at compile time the shapes it
+ * cannot reproduce (dotted paths, null comparisons, non-comparison predicates) and by
+ * punting at runtime on documents where the extracted value is an array, since array
+ * predicates match against individual array elements.
+ *
+ * The compiled filter holds pointers into the source MatchExpression tree, which must
+ * outlive it.
+ */
+class FlatFilter {
+public:
+    /**
+     * Compiles 'expr' if it has a supported shape, otherwise returns nullptr and callers
+     * should evaluate the expression through the general matcher.
+     */
+    static std::unique_ptr<FlatFilter> compile(const MatchExpression* expr);
+
+    /**
+     * Evaluates the compiled predicates against 'obj'. Returns the match result, or
+     * boost::none if this document requires the general matcher (an array value was
+     * encountered on a predicate path).
+     */
+    boost::optional<bool> matches(const BSONObj& obj) const;
+
+private:
+    struct Predicate {
+        StringData path;              // Points into the expression's backing storage.
+        const MatchExpression* expr;  // The comparison leaf; not owned.
+    };
+
+    FlatFilter() = default;
+
+    std::vector<Predicate> _predicates;
+};
+
+}  // namespace mongo
@@ -0,0 +1,109 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+/**
+ * This file contains tests for mongo/db/exec/flat_filter.cpp
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/flat_filter.h"
+
+#include "mongo/db/json.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/matcher/extensions_callback_disallow_extensions.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+
+namespace {
+
+constexpr CollatorInterface* kSimpleCollator = nullptr;
+
+std::unique_ptr<MatchExpression> parse(const char* queryStr) {
+    BSONObj query = fromjson(queryStr);
+    StatusWithMatchExpression result = MatchExpressionParser::parse(
+        query, ExtensionsCallbackDisallowExtensions(), kSimpleCollator);
+    ASSERT_OK(result.getStatus());
+    return std::move(result.getValue());
+}
+
+TEST(FlatFilterTest, CompilesSimpleComparisons) {
+    auto expr = parse("{a: {$gt: 5}}");
+    ASSERT_TRUE(FlatFilter::compile(expr.get()));
+
+    expr = parse("{a: 1, b: {$lte: 'abc'}}");
+    ASSERT_TRUE(FlatFilter::compile(expr.get()));
+}
+
+TEST(FlatFilterTest, RefusesUnsupportedShapes) {
+    // Dotted path.
+    auto expr = parse("{'a.b': 1}");
+    ASSERT_FALSE(FlatFilter::compile(expr.get()));
+
+    // Null comparison matches missing fields.
+    expr = parse("{a: null}");
+    ASSERT_FALSE(FlatFilter::compile(expr.get()));
+
+    // Non-comparison predicate.
+    expr = parse("{a: {$exists: true}}");
+    ASSERT_FALSE(FlatFilter::compile(expr.get()));
+
+    // Disjunction.
+    expr = parse("{$or: [{a: 1}, {b: 1}]}");
+    ASSERT_FALSE(FlatFilter::compile(expr.get()));
+
+    ASSERT_FALSE(FlatFilter::compile(nullptr));
+}
+
+TEST(FlatFilterTest, MatchesConjunction) {
+    auto expr = parse("{a: {$gte: 5}, b: {$lt: 10}}");
+    auto filter = FlatFilter::compile(expr.get());
+    ASSERT_TRUE(filter);
+
+    ASSERT_TRUE(*filter->matches(fromjson("{a: 5, b: 9}")));
+    ASSERT_FALSE(*filter->matches(fromjson("{a: 4, b: 9}")));
+    ASSERT_FALSE(*filter->matches(fromjson("{a: 5, b: 10}")));
+    // Missing field cannot satisfy a non-null comparison.
+    ASSERT_FALSE(*filter->matches(fromjson("{a: 5}")));
+}
+
+TEST(FlatFilterTest, PuntsOnArrayValues) {
+    auto expr = parse("{a: 2}");
+    auto filter = FlatFilter::compile(expr.get());
+    ASSERT_TRUE(filter);
+
+    ASSERT_TRUE(*filter->matches(fromjson("{a: 2}")));
+    // The general matcher would match {a: [1, 2]} elementwise, so the fast path must
+    // decline rather than answer.
+    ASSERT_FALSE(filter->matches(fromjson("{a: [1, 2]}")));
+}
+
+}  // namespace
+
+}  // namespace mongo
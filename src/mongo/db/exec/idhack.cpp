@@ -134,7 +134,6 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
         id = _workingSet->allocate();
         WorkingSetMember* member = _workingSet->get(id);
         member->recordId = recordId;
-        _workingSet->transitionToRecordIdAndIdx(id);
 
         if (!_recordCursor)
             _recordCursor = _collection->getCursor(getOpCtx());
@@ -143,14 +142,19 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
         if (auto fetcher = _recordCursor->fetcherForId(recordId)) {
             // There's something to fetch. Hand the fetcher off to the WSM, and pass up a
             // fetch request.
+            _workingSet->transitionToRecordIdAndIdx(id);
             _idBeingPagedIn = id;
             member->setFetcher(fetcher.release());
             *out = id;
             return NEED_YIELD;
         }
 
-        // The doc was already in memory, so we go ahead and return it.
-        if (!WorkingSetCommon::fetch(getOpCtx(), _workingSet, id, _recordCursor)) {
+        // The doc was already in memory, so go straight from the index lookup to the record
+        // fetch and return it. The member skips the intermediate RID_AND_IDX state: it carries
+        // no index keys, so registering it as yield-sensitive would only add bookkeeping to
+        // this hot path.
+        auto record = _recordCursor->seekExact(recordId);
+        if (!record) {
             // _id is immutable so the index would return the only record that could
             // possibly match the query.
             _workingSet->free(id);
@@ -159,6 +163,8 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
             return IS_EOF;
         }
 
+        member->obj = {getOpCtx()->recoveryUnit()->getSnapshotId(), record->data.releaseToBson()};
+        _workingSet->transitionToRecordIdAndObj(id);
         return advance(id, member, out);
     } catch (const WriteConflictException& wce) {
         // Restart at the beginning on retry.
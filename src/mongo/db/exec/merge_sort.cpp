@@ -31,7 +31,9 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/collation/collation_index_key.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/mongoutils/str.h"
 
@@ -54,9 +56,9 @@ MergeSortStage::MergeSortStage(OperationContext* opCtx,
       _collection(collection),
       _ws(ws),
       _pattern(params.pattern),
+      _ordering(Ordering::make(params.pattern)),
       _collator(params.collator),
-      _dedup(params.dedup),
-      _merging(StageWithValueComparison(ws, params.pattern, params.collator)) {}
+      _dedup(params.dedup) {}
 
 void MergeSortStage::addChild(PlanStage* child) {
     _children.emplace_back(child);
@@ -118,9 +120,12 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
             StageWithValue value;
             value.id = id;
             value.stage = child;
+            // Encode the sort key up front so that picking the min is a bytewise comparison
+            // rather than a BSON comparison per heap level.
+            value.encodedKey = encodeSortKey(member);
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
-            _mergingData.push_front(value);
+            _mergingData.push_front(std::move(value));
 
             // Insert the result (indirectly) into our priority queue.
             _merging.push(_mergingData.begin());
@@ -196,38 +201,37 @@ void MergeSortStage::doInvalidate(OperationContext* opCtx,
     }
 }
 
-// Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
-// the return from the expected value.
-bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
-                                                          const MergingRef& rhs) {
-    WorkingSetMember* lhsMember = _ws->get(lhs->id);
-    WorkingSetMember* rhsMember = _ws->get(rhs->id);
-
+std::string MergeSortStage::encodeSortKey(const WorkingSetMember* member) const {
+    // Pull out the fields the pattern sorts on.  The stage's preconditions guarantee that
+    // every child can produce each of these via getFieldDotted.
+    BSONObjBuilder keyBob;
     BSONObjIterator it(_pattern);
     while (it.more()) {
         BSONElement patternElt = it.next();
-        string fn = patternElt.fieldName();
-
-        BSONElement lhsElt;
-        verify(lhsMember->getFieldDotted(fn, &lhsElt));
 
-        BSONElement rhsElt;
-        verify(rhsMember->getFieldDotted(fn, &rhsElt));
+        BSONElement elt;
+        verify(member->getFieldDotted(patternElt.fieldName(), &elt));
 
-        // false means don't compare field name.
-        int x = lhsElt.woCompare(rhsElt, false, _collator);
-        if (-1 == patternElt.number()) {
-            x = -x;
-        }
-        if (x != 0) {
-            return x > 0;
-        }
+        // Substitute the collation comparison key for strings so that the encoded keys order
+        // strings correctly under '_collator'.
+        CollationIndexKey::collationAwareIndexKeyAppend(elt, _collator, &keyBob);
     }
 
-    // A comparator for use with sort is required to model a strict weak ordering, so
-    // to satisfy irreflexivity we must return 'false' for elements that we consider
-    // equivalent under the pattern.
-    return false;
+    // Encode with the pattern's sort directions baked in so that comparing two encoded keys
+    // is a plain bytewise comparison.
+    KeyString keyString(KeyString::kLatestVersion, keyBob.obj(), _ordering);
+    return std::string(keyString.getBuffer(), keyString.getSize());
+}
+
+// Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
+// the return from the expected value.
+bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
+                                                          const MergingRef& rhs) {
+    // The encoded keys have the sort directions baked in, so a bytewise comparison orders
+    // them according to the pattern.  A comparator for use with sort is required to model a
+    // strict weak ordering, so to satisfy irreflexivity we must return 'false' for keys that
+    // compare equivalent under the pattern.
+    return lhs->encodedKey.compare(rhs->encodedKey) > 0;
 }
 
 unique_ptr<PlanStageStats> MergeSortStage::getStats() {
@@ -30,8 +30,10 @@
 
 #include <list>
 #include <queue>
+#include <string>
 #include <vector>
 
+#include "mongo/bson/ordering.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
@@ -79,6 +81,13 @@ public:
     static const char* kStageType;
 
 private:
+    /**
+     * Encodes the sort key of 'member' (per '_pattern' and '_collator') as a KeyString and
+     * returns its raw bytes. The pattern's sort directions are baked into the encoding, so
+     * comparing two encoded keys is a single bytewise comparison.
+     */
+    std::string encodeSortKey(const WorkingSetMember* member) const;
+
     // Not owned by us.
     const Collection* _collection;
 
@@ -88,6 +97,9 @@ private:
     // The pattern that we're sorting by.
     BSONObj _pattern;
 
+    // The sort directions of _pattern, used when encoding sort keys.
+    const Ordering _ordering;
+
     // Null if this merge sort stage orders strings according to simple binary compare. If non-null,
     // represents the collator used to compare strings.
     const CollatorInterface* _collator;
@@ -119,6 +131,10 @@ private:
         StageWithValue() : id(WorkingSet::INVALID_ID), stage(NULL) {}
         WorkingSetID id;
         PlanStage* stage;
+        // The KeyString-encoded sort key of the buffered result.  Computed once when the
+        // result is buffered so each heap comparison is a memcmp rather than a field
+        // extraction plus a collation-aware BSON comparison.
+        std::string encodedKey;
     };
 
     // We have a priority queue of these.
@@ -127,17 +143,9 @@ private:
     // The comparison function used in our priority queue.
     class StageWithValueComparison {
     public:
-        StageWithValueComparison(WorkingSet* ws, BSONObj pattern, const CollatorInterface* collator)
-            : _ws(ws), _pattern(pattern), _collator(collator) {}
-
         // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
         // the return from the expected value.
         bool operator()(const MergingRef& lhs, const MergingRef& rhs);
-
-    private:
-        WorkingSet* _ws;
-        BSONObj _pattern;
-        const CollatorInterface* _collator;
     };
 
     // The min heap of the results we're returning.
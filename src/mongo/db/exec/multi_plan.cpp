@@ -45,6 +45,7 @@
 #include "mongo/db/query/explain.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/plan_ranker.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/storage/record_fetcher.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/log.h"
@@ -61,6 +62,22 @@ using stdx::make_unique;
 // static
 const char* MultiPlanStage::kStageType = "MULTI_PLAN";
 
+namespace {
+
+// How often, in round-robin works, the trial period checks for candidate plans that have
+// fallen too far behind the leader.
+const size_t kEliminationCheckInterval = 128;
+
+// The leader must have buffered at least this many results before any laggard is
+// eliminated; below this the productivity gap may just be noise.
+const size_t kEliminationMinLeaderResults = 16;
+
+// A live plan is eliminated when the leader has produced more than this multiple of the
+// plan's results.
+const size_t kEliminationFactor = 4;
+
+}  // namespace
+
 MultiPlanStage::MultiPlanStage(OperationContext* opCtx,
                                const Collection* collection,
                                CanonicalQuery* cq,
@@ -79,6 +96,7 @@ MultiPlanStage::MultiPlanStage(OperationContext* opCtx,
 
 void MultiPlanStage::addPlan(QuerySolution* solution, PlanStage* root, WorkingSet* ws) {
     _candidates.push_back(CandidatePlan(solution, root, ws));
+    _eliminated.push_back(false);
     _children.emplace_back(root);
 }
 
@@ -211,11 +229,18 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
 
     // Work the plans, stopping when a plan hits EOF or returns some
     // fixed number of results.
+    const bool earlyElimination = internalQueryPlanEvaluationEarlyElimination.load();
     for (size_t ix = 0; ix < numWorks; ++ix) {
         bool moreToDo = workAllPlans(numResults, yieldPolicy);
         if (!moreToDo) {
             break;
         }
+
+        // Periodically stop working plans that have clearly lost the competition, so a
+        // long trial period is spent on the contenders rather than on obvious losers.
+        if (earlyElimination && (ix + 1) % kEliminationCheckInterval == 0) {
+            eliminateLaggingPlans();
+        }
     }
 
     if (_failure) {
@@ -333,14 +358,48 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     return Status::OK();
 }
 
+void MultiPlanStage::eliminateLaggingPlans() {
+    // Find the most productive live plan.
+    size_t leaderResults = 0;
+    size_t numLive = 0;
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        if (_candidates[ix].failed || _eliminated[ix]) {
+            continue;
+        }
+        ++numLive;
+        leaderResults = std::max(leaderResults, _candidates[ix].results.size());
+    }
+
+    // With fewer than two live plans there is no competition left to prune, and until the
+    // leader has buffered enough results the productivity gap is not meaningful.
+    if (numLive < 2 || leaderResults < kEliminationMinLeaderResults) {
+        return;
+    }
+
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        CandidatePlan& candidate = _candidates[ix];
+        if (candidate.failed || _eliminated[ix]) {
+            continue;
+        }
+        if (candidate.results.size() * kEliminationFactor < leaderResults) {
+            LOG(2) << "Stopping trial execution of lagging candidate plan ("
+                   << candidate.results.size() << " results vs leader's " << leaderResults
+                   << "): " << redact(Explain::getPlanSummary(candidate.root));
+            _eliminated[ix] = true;
+        }
+    }
+}
+
 bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy) {
     bool doneWorking = false;
+    size_t numWorked = 0;
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
         CandidatePlan& candidate = _candidates[ix];
-        if (candidate.failed) {
+        if (candidate.failed || _eliminated[ix]) {
             continue;
         }
+        ++numWorked;
 
         // Might need to yield between calls to work due to the timer elapsing.
         if (!(tryYield(yieldPolicy)).isOK()) {
@@ -403,7 +462,8 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
         }
     }
 
-    return !doneWorking;
+    // If no live plans remain there is nothing left to work.
+    return !doneWorking && numWorked > 0;
 }
 
 namespace {
@@ -168,6 +168,14 @@ private:
      */
     bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy);
 
+    /**
+     * Stops working candidate plans whose productivity (buffered results) has fallen far
+     * behind the most productive live plan's. Eliminated plans keep the stats they have
+     * accrued so far and still participate in ranking; they just receive no further works
+     * during the trial period. Never eliminates the last live plan.
+     */
+    void eliminateLaggingPlans();
+
     /**
      * Checks whether we need to perform either a timing-based yield or a yield for a document
      * fetch. If so, then uses 'yieldPolicy' to actually perform the yield.
@@ -194,6 +202,10 @@ private:
     // one-to-one with _candidates.
     std::vector<CandidatePlan> _candidates;
 
+    // Parallel to _candidates. True for plans that eliminateLaggingPlans() has stopped
+    // working before the end of the trial period.
+    std::vector<bool> _eliminated;
+
     // index into _candidates, of the winner of the plan competition
     // uses -1 / kNoSuchPlan when best plan is not (yet) known
     int _bestPlanIdx;
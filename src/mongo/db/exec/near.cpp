@@ -30,6 +30,8 @@
 
 #include "mongo/db/exec/near.h"
 
+#include <algorithm>
+
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/stdx/memory.h"
@@ -140,6 +142,12 @@ PlanStage::StageState NearStage::bufferNext(WorkingSetID* toReturn, Status* erro
     //
 
     if (!_nextInterval) {
+        // Any intervals searched so far are exhausted: every result their coverings produced
+        // has either been returned or is sitting in '_resultBuffer' (where members own their
+        // documents). Retire them before building the next interval so we don't keep an EOF
+        // covering stage alive per interval for the remainder of the search.
+        retireExhaustedIntervals();
+
         StatusWith<CoveredInterval*> intervalStatus =
             nextInterval(getOpCtx(), _workingSet, _collection);
         if (!intervalStatus.isOK()) {
@@ -301,9 +309,25 @@ void NearStage::doInvalidate(OperationContext* opCtx, const RecordId& dl, Invali
     }
 }
 
+void NearStage::retireExhaustedIntervals() {
+    for (auto& interval : _childrenIntervals) {
+        auto childIt = std::find_if(
+            _children.begin(), _children.end(), [&interval](const unique_ptr<PlanStage>& child) {
+                return child.get() == interval->covering;
+            });
+        invariant(childIt != _children.end());
+        _exhaustedIntervalStats.emplace_back((*childIt)->getStats());
+        _children.erase(childIt);
+    }
+    _childrenIntervals.clear();
+}
+
 unique_ptr<PlanStageStats> NearStage::getStats() {
     unique_ptr<PlanStageStats> ret = make_unique<PlanStageStats>(_commonStats, _stageType);
     ret->specific.reset(_specificStats.clone());
+    for (size_t i = 0; i < _exhaustedIntervalStats.size(); ++i) {
+        ret->children.emplace_back(_exhaustedIntervalStats[i]->clone());
+    }
     for (size_t i = 0; i < _childrenIntervals.size(); ++i) {
         ret->children.emplace_back(_childrenIntervals[i]->covering->getStats());
     }
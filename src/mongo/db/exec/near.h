@@ -165,6 +165,13 @@ private:
     StageState bufferNext(WorkingSetID* toReturn, Status* error);
     StageState advanceNext(WorkingSetID* toReturn);
 
+    /**
+     * Snapshots the stats of all intervals searched so far and releases their covering
+     * stages. Called before constructing the next interval, when every result the previous
+     * coverings produced has either been returned or buffered in '_resultBuffer'.
+     */
+    void retireExhaustedIntervals();
+
     //
     // Generic state for progressive near search
     //
@@ -201,11 +208,17 @@ private:
     // Pointer to the last interval in _childrenIntervals. Owned by _childrenIntervals.
     CoveredInterval* _nextInterval;
 
-    // All children CoveredIntervals and the sub-stages owned by them.
-    //
-    // All children intervals except the last active one are only used by getStats(),
-    // because they are all EOF.
+    // All children CoveredIntervals which have not yet been exhausted, and the sub-stages
+    // owned by them. In practice this holds at most the currently searched interval; once an
+    // interval is exhausted its stats are snapshotted into '_exhaustedIntervalStats' and the
+    // interval and its sub-stages are freed, so that a search spanning many intervals does
+    // not accumulate an EOF index scan and fetch stage per interval (which both grows memory
+    // and lengthens the child walk done on every save/restore for yield).
     std::vector<std::unique_ptr<CoveredInterval>> _childrenIntervals;
+
+    // Stats snapshots of the covering stages of exhausted intervals, in search order.
+    // Reported by getStats() ahead of the still-live intervals.
+    std::vector<std::unique_ptr<PlanStageStats>> _exhaustedIntervalStats;
 };
 
 /**
@@ -32,8 +32,11 @@
 
 #include "mongo/db/exec/plan_stage.h"
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/service_context.h"
 
 namespace mongo {
@@ -41,6 +44,18 @@ namespace mongo {
 PlanStage::StageState PlanStage::work(WorkingSetID* out) {
     invariant(_opCtx);
     ScopedTimer timer(getClock(), &_commonStats.executionTimeMillis);
+
+    // Fine-grained timing is sampled on every Nth call rather than all of them: two tick
+    // source reads per work() would cost more than many of the work() bodies they measure.
+    // Explain scales the sampled total back up by works / timedWorks.
+    const int timingInterval = internalQueryExecStageTimingSampleInterval.load();
+    boost::optional<ScopedTickTimer> sampledTimer;
+    if (timingInterval > 0 && _commonStats.works % timingInterval == 0) {
+        ++_commonStats.timedWorks;
+        sampledTimer.emplace(_opCtx->getServiceContext()->getTickSource(),
+                             &_commonStats.executionTimeNanosSampled);
+    }
+
     ++_commonStats.works;
 
     StageState workResult = doWork(out);
@@ -56,6 +71,36 @@ PlanStage::StageState PlanStage::work(WorkingSetID* out) {
     return workResult;
 }
 
+PlanStage::StageState PlanStage::workBatch(size_t maxToReturn,
+                                           std::vector<WorkingSetID>* results,
+                                           WorkingSetID* out) {
+    invariant(maxToReturn > 0);
+
+    // Cap the number of work() calls absorbed by one batch. Without this a filter that
+    // rejects most documents could starve the caller's yield and interrupt checks.
+    size_t worksRemaining = 4 * maxToReturn;
+
+    while (worksRemaining--) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = work(&id);
+
+        if (StageState::ADVANCED == state) {
+            results->push_back(id);
+            if (results->size() >= maxToReturn) {
+                break;
+            }
+        } else if (StageState::NEED_TIME == state) {
+            continue;
+        } else {
+            // IS_EOF, NEED_YIELD, DEAD and FAILURE end the batch immediately.
+            *out = id;
+            return state;
+        }
+    }
+
+    return results->empty() ? StageState::NEED_TIME : StageState::ADVANCED;
+}
+
 void PlanStage::saveState() {
     ++_commonStats.yields;
     for (auto&& child : _children) {
@@ -188,6 +188,27 @@ public:
      */
     StageState work(WorkingSetID* out);
 
+    /**
+     * Works the stage repeatedly, appending up to 'maxToReturn' produced members to
+     * 'results'. This amortizes the per-document virtual call and state-machine overhead of
+     * the one-at-a-time work() protocol for consumers that can handle results in batches.
+     *
+     * Returns ADVANCED if the batch was ended with at least one collected result because
+     * 'maxToReturn' was reached or the internal work budget was exhausted, and NEED_TIME
+     * if the budget was exhausted without producing any. Any other return value has the same
+     * meaning as it does for work(), with *out set accordingly (e.g. the fetch request
+     * member for NEED_YIELD or the error member for FAILURE); members already appended to
+     * 'results' remain valid and must be consumed before acting on that state.
+     *
+     * The number of underlying work() calls per batch is bounded so that callers still
+     * reach their yield and interrupt checks promptly even when most documents are
+     * filtered out. Stages may override this to produce batches more efficiently than the
+     * default work() loop.
+     */
+    virtual StageState workBatch(size_t maxToReturn,
+                                 std::vector<WorkingSetID>* results,
+                                 WorkingSetID* out);
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -65,6 +65,8 @@ struct CommonStats {
           needTime(0),
           needYield(0),
           executionTimeMillis(0),
+          executionTimeNanosSampled(0),
+          timedWorks(0),
           isEOF(false) {}
     // String giving the type of the stage. Not owned.
     const char* stageTypeStr;
@@ -87,6 +89,13 @@ struct CommonStats {
     // Time elapsed while working inside this stage.
     long long executionTimeMillis;
 
+    // Nanoseconds spent inside the sampled subset of this stage's work() calls, and the number
+    // of calls that were sampled. Scaling the former by works / timedWorks estimates the
+    // stage's total time at a resolution executionTimeMillis cannot provide. See
+    // PlanStage::work() for the sampling policy.
+    long long executionTimeNanosSampled;
+    size_t timedWorks;
+
     // TODO: have some way of tracking WSM sizes (or really any series of #s).  We can measure
     // the size of our inputs and the size of our outputs.  We can do a lot with the WS here.
 
@@ -94,6 +94,7 @@ ProjectionStage::ProjectionStage(OperationContext* opCtx,
                     // If we are including this key field store its field name.
                     _keyFieldNames.push_back(fieldIt->first);
                     _includeKey.push_back(true);
+                    _keyFieldNameSize += fieldIt->first.size() + 1;
                 }
             }
         } else {
@@ -148,7 +149,7 @@ Status ProjectionStage::transform(WorkingSetMember* member) {
         return _exec->transform(member);
     }
 
-    BSONObjBuilder bob;
+    BSONObj newObj;
 
     // Note that even if our fast path analysis is bug-free something that is
     // covered might be invalidated and just be an obj.  In this case we just go
@@ -160,12 +161,22 @@ Status ProjectionStage::transform(WorkingSetMember* member) {
         // If we got here because of SIMPLE_DOC the planner shouldn't have messed up.
         invariant(member->hasObj());
 
+        // The projected document is a subset of the source document, so the source's size
+        // bounds the output and a single buffer allocation suffices.
+        BSONObjBuilder bob(member->obj.value().objsize());
+
         // Apply the SIMPLE_DOC projection.
         transformSimpleInclusion(member->obj.value(), _includedFields, bob);
+        newObj = bob.obj();
     } else {
         invariant(ProjectionStageParams::COVERED_ONE_INDEX == _projImpl);
         // We're pulling data out of the key.
         invariant(1 == member->keyData.size());
+
+        // The output is the included key values plus the projected field names, whose total
+        // size we precomputed at construction. Size the builder so it never regrows.
+        BSONObjBuilder bob(member->keyData[0].keyData.objsize() +
+                           static_cast<int>(_keyFieldNameSize));
         size_t keyIndex = 0;
 
         // Look at every key element...
@@ -179,11 +190,12 @@ Status ProjectionStage::transform(WorkingSetMember* member) {
             }
             ++keyIndex;
         }
+        newObj = bob.obj();
     }
 
     member->keyData.clear();
     member->recordId = RecordId();
-    member->obj = Snapshotted<BSONObj>(SnapshotId(), bob.obj());
+    member->obj = Snapshotted<BSONObj>(SnapshotId(), newObj);
     member->transitionToOwnedObj();
     return Status::OK();
 }
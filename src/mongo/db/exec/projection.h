@@ -150,6 +150,11 @@ private:
 
     // If the i-th entry of _includeKey is true this is the field name for the i-th key field.
     std::vector<StringData> _keyFieldNames;
+
+    // Total bytes of the included key fields' names (each with its NUL terminator). Together
+    // with the key's size this bounds the projected document's size, so transform() can size
+    // its builder to avoid buffer regrowth.
+    size_t _keyFieldNameSize = 0;
 };
 
 }  // namespace mongo
@@ -41,4 +41,16 @@ ScopedTimer::~ScopedTimer() {
     *_counter += elapsed;
 }
 
+ScopedTickTimer::ScopedTickTimer(TickSource* tickSource, long long* counter)
+    : _tickSource(tickSource),
+      _counter(counter),
+      _nanosPerTick(static_cast<double>(durationCount<Nanoseconds>(Seconds(1))) /
+                    tickSource->getTicksPerSecond()),
+      _start(tickSource->getTicks()) {}
+
+ScopedTickTimer::~ScopedTickTimer() {
+    const TickSource::Tick elapsed = _tickSource->getTicks() - _start;
+    *_counter += static_cast<long long>(elapsed * _nanosPerTick);
+}
+
 }  // namespace mongo
@@ -30,6 +30,7 @@
 
 #include "mongo/base/disallow_copying.h"
 
+#include "mongo/util/tick_source.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -57,4 +58,30 @@ private:
     const Date_t _start;
 };
 
+/**
+ * Like ScopedTimer, but measures with a TickSource and increments its counter in nanoseconds.
+ * Used for the sampled per-stage timing in PlanStage::work(), where the intervals being
+ * measured are far below the resolution of a Date_t clock.
+ */
+class ScopedTickTimer {
+    MONGO_DISALLOW_COPYING(ScopedTickTimer);
+
+public:
+    ScopedTickTimer(TickSource* tickSource, long long* counter);
+
+    ~ScopedTickTimer();
+
+private:
+    TickSource* const _tickSource;
+
+    // Reference to the counter that we are incrementing with the elapsed nanoseconds.
+    long long* _counter;
+
+    // Conversion factor from ticks to nanoseconds for '_tickSource'.
+    const double _nanosPerTick;
+
+    // Tick count at which the timer was constructed.
+    const TickSource::Tick _start;
+};
+
 }  // namespace mongo
@@ -31,8 +31,10 @@
 #include "mongo/db/exec/sort.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "mongo/db/catalog/collection.h"
+#include "mongo/db/client_memory_ledger.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/exec/working_set_computed_data.h"
@@ -58,8 +60,20 @@ SortStage::WorkingSetComparator::WorkingSetComparator(BSONObj p) : pattern(p) {}
 
 bool SortStage::WorkingSetComparator::operator()(const SortableDataItem& lhs,
                                                  const SortableDataItem& rhs) const {
+    // Fast path: byte-identical sort keys are equal under any ordering or collation, and
+    // memcmp() bails on the first differing byte, so this is cheap for unequal keys too.
+    // Sort-heavy workloads commonly have many duplicate keys, where this skips the full
+    // type-dispatching comparison below.
+    const BSONObj& lhsKey = lhs.sortKey;
+    const BSONObj& rhsKey = rhs.sortKey;
+    if (lhsKey.objsize() == rhsKey.objsize() &&
+        memcmp(lhsKey.objdata(), rhsKey.objdata(), lhsKey.objsize()) == 0) {
+        // Indices use RecordId as an additional sort key so we must as well.
+        return lhs.recordId < rhs.recordId;
+    }
+
     // False means ignore field names.
-    int result = lhs.sortKey.woCompare(rhs.sortKey, pattern, false);
+    int result = lhsKey.woCompare(rhsKey, pattern, false);
     if (0 != result) {
         return result < 0;
     }
@@ -84,15 +98,25 @@ SortStage::SortStage(OperationContext* opCtx,
     BSONObj sortComparator = FindCommon::transformSortSpec(_pattern);
     _sortKeyComparator = stdx::make_unique<WorkingSetComparator>(sortComparator);
 
-    // If limit > 1, we need to initialize _dataSet here to maintain ordered set of data items while
-    // fetching from the child stage.
+    // If limit > 1, we keep the best _limit items in a bounded heap while fetching from the
+    // child stage, so we never hold more than _limit candidates. Cap the reservation: _limit
+    // is limit + skip straight from the query, so reserving it verbatim would let a huge
+    // limit allocate unbounded memory up front, before the blocking-sort memory cap in
+    // doWork() ever sees a document. Beyond the cap the vector grows as items arrive, under
+    // that same memory cap.
     if (_limit > 1) {
-        const WorkingSetComparator& cmp = *_sortKeyComparator;
-        _dataSet.reset(new SortableDataItemSet(cmp));
+        static const size_t kMaxReserve = 4096;
+        _data.reserve(std::min(_limit, kMaxReserve));
     }
 }
 
-SortStage::~SortStage() {}
+SortStage::~SortStage() {
+    // If we are destroyed while attached to an operation context (the common, non-cursor case),
+    // hand back the charge for the buffered data. A detached stage has no charge outstanding.
+    if (_ledger && _ledgerBytesCharged != 0) {
+        _ledger->adjust(ClientMemoryLedger::kSort, -_ledgerBytesCharged);
+    }
+}
 
 bool SortStage::isEOF() {
     // We're done when our child has no more results, we've sorted the child's results, and
@@ -149,6 +173,7 @@ PlanStage::StageState SortStage::doWork(WorkingSetID* out) {
             }
 
             addToBuffer(item);
+            updateMemoryLedger();
 
             return PlanStage::NEED_TIME;
         } else if (PlanStage::IS_EOF == code) {
@@ -217,6 +242,31 @@ void SortStage::doInvalidate(OperationContext* opCtx, const RecordId& dl, Invali
     }
 }
 
+void SortStage::doDetachFromOperationContext() {
+    // The ledger charge is attributed to the client driving the current operation, so drop it
+    // while the plan is saved in the cursor manager and no client owns the memory.
+    if (_ledgerBytesCharged != 0) {
+        _ledger->adjust(ClientMemoryLedger::kSort, -_ledgerBytesCharged);
+        _ledgerBytesCharged = 0;
+    }
+    _ledger = nullptr;
+}
+
+void SortStage::doReattachToOperationContext() {
+    updateMemoryLedger();
+}
+
+void SortStage::updateMemoryLedger() {
+    const long long current = static_cast<long long>(_memUsage);
+    if (current == _ledgerBytesCharged) {
+        return;
+    }
+    ClientMemoryLedger& ledger = ClientMemoryLedger::get(getOpCtx()->getClient());
+    ledger.adjust(ClientMemoryLedger::kSort, current - _ledgerBytesCharged);
+    _ledger = &ledger;
+    _ledgerBytesCharged = current;
+}
+
 unique_ptr<PlanStageStats> SortStage::getStats() {
     _commonStats.isEOF = isEOF();
     const size_t maxBytes = static_cast<size_t>(internalQueryExecMaxBlockingSortBytes.load());
@@ -250,10 +300,13 @@ const SpecificStats* SortStage::getSpecificStats() const {
  *                     Updates memory usage if item was replaced.
  *     sortBuffer() - Does nothing.
  * limit > 1:
- *     addToBuffer() - Does not update vector. Adds item to set.
- *                     If size of set exceeds limit, remove item from set
- *                     with lowest key. Updates memory usage accordingly.
- *     sortBuffer() - Copies items from set to vectors.
+ *     addToBuffer() - Maintains vector as a max-heap of the best
+ *                     'limit' items, with the item with the highest
+ *                     key at the front. Items that do not beat the
+ *                     current worst retained item are rejected with a
+ *                     single comparison. Updates memory usage when an
+ *                     item is admitted or evicted.
+ *     sortBuffer() - Converts the heap to sorted order in place.
  */
 void SortStage::addToBuffer(const SortableDataItem& item) {
     // Holds ID of working set member to be freed at end of this function.
@@ -282,33 +335,27 @@ void SortStage::addToBuffer(const SortableDataItem& item) {
             _memUsage = member->getMemUsage();
         }
     } else {
-        // Update data item set instead of vector
-        // Limit not reached - insert and return
-        vector<SortableDataItem>::size_type limit(_limit);
-        if (_dataSet->size() < limit) {
+        const WorkingSetComparator& cmp = *_sortKeyComparator;
+        // Limit not reached - push onto the heap and return.
+        if (_data.size() < _limit) {
             member->makeObjOwnedIfNeeded();
-            _dataSet->insert(item);
+            _data.push_back(item);
+            std::push_heap(_data.begin(), _data.end(), cmp);
             _memUsage += member->getMemUsage();
             return;
         }
-        // Limit will be exceeded - compare with item with lowest key
-        // If new item does not have a lower key value than last item,
-        // do nothing.
+        // Limit will be exceeded - compare with the item with the highest key, which sits at
+        // the front of the heap. If the new item does not have a lower key, do nothing.
         wsidToFree = item.wsid;
-        SortableDataItemSet::const_iterator lastItemIt = --(_dataSet->end());
-        const SortableDataItem& lastItem = *lastItemIt;
-        const WorkingSetComparator& cmp = *_sortKeyComparator;
-        if (cmp(item, lastItem)) {
-            _memUsage -= _ws->get(lastItem.wsid)->getMemUsage();
+        if (cmp(item, _data.front())) {
+            std::pop_heap(_data.begin(), _data.end(), cmp);
+            const SortableDataItem& evicted = _data.back();
+            _memUsage -= _ws->get(evicted.wsid)->getMemUsage();
             _memUsage += member->getMemUsage();
-            wsidToFree = lastItem.wsid;
-            // According to std::set iterator validity rules,
-            // it does not matter which of erase()/insert() happens first.
-            // Here, we choose to erase first to release potential resources
-            // used by the last item and to keep the scope of the iterator to a minimum.
-            _dataSet->erase(lastItemIt);
+            wsidToFree = evicted.wsid;
             member->makeObjOwnedIfNeeded();
-            _dataSet->insert(item);
+            _data.back() = item;
+            std::push_heap(_data.begin(), _data.end(), cmp);
         }
     }
 
@@ -331,12 +378,10 @@ void SortStage::sortBuffer() {
         // Buffer contains either 0 or 1 item so it is already in a sorted state.
         return;
     } else {
-        // Set already contains items in sorted order, so we simply copy the items
-        // from the set to the vector.
-        // Release the memory for the set after the copy.
-        vector<SortableDataItem> newData(_dataSet->begin(), _dataSet->end());
-        _data.swap(newData);
-        _dataSet.reset();
+        // The vector is heap-ordered; sort_heap() produces ascending order under cmp, which
+        // repeatedly pops the highest key to the back.
+        const WorkingSetComparator& cmp = *_sortKeyComparator;
+        std::sort_heap(_data.begin(), _data.end(), cmp);
     }
 }
 
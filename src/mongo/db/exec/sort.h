@@ -28,7 +28,6 @@
 
 #pragma once
 
-#include <set>
 #include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
@@ -42,6 +41,7 @@
 namespace mongo {
 
 class BtreeKeyGenerator;
+class ClientMemoryLedger;
 
 // Parameters that must be provided to a SortStage
 class SortStageParams {
@@ -79,6 +79,9 @@ public:
 
     void doInvalidate(OperationContext* opCtx, const RecordId& dl, InvalidationType type) final;
 
+    void doDetachFromOperationContext() final;
+    void doReattachToOperationContext() final;
+
     StageType stageType() const final {
         return STAGE_SORT;
     }
@@ -139,16 +142,16 @@ private:
     };
 
     /**
-     * Inserts one item into data buffer (vector or set).
-     * If limit is exceeded, remove item with lowest key.
+     * Inserts one item into the data buffer.
+     * If limit is exceeded, evict the item with the highest key.
      */
     void addToBuffer(const SortableDataItem& item);
 
     /**
      * Sorts data buffer.
      * Assumes no more items will be added to buffer.
-     * If data is stored in set, copy set
-     * contents to vector and clear set.
+     * If data is heap-ordered (limit > 1), converts the heap
+     * to sorted order in place.
      */
     void sortBuffer();
 
@@ -159,13 +162,13 @@ private:
     // The data we buffer and sort.
     // _data will contain sorted data when all data is gathered
     // and sorted.
-    // When _limit is greater than 1 and not all data has been gathered from child stage,
-    // _dataSet is used instead to maintain an ordered set of the incomplete data set.
-    // When the data set is complete, we copy the items from _dataSet to _data which will
-    // be used to provide the results of this stage through _resultIterator.
+    // When _limit is greater than 1 and not all data has been gathered from the child stage,
+    // _data is instead kept as a bounded max-heap of the best _limit items seen so far, with
+    // the item with the highest key at the front. An incoming item that does not beat the
+    // current worst retained item costs a single comparison and is freed immediately, so only
+    // _limit candidates are ever resident. When the data set is complete, sortBuffer()
+    // converts the heap to sorted order in place.
     std::vector<SortableDataItem> _data;
-    typedef std::set<SortableDataItem, WorkingSetComparator> SortableDataItemSet;
-    std::unique_ptr<SortableDataItemSet> _dataSet;
 
     // Iterates through _data post-sort returning it.
     std::vector<SortableDataItem>::iterator _resultIterator;
@@ -178,6 +181,20 @@ private:
 
     // The usage in bytes of all buffered data that we're sorting.
     size_t _memUsage;
+
+    /**
+     * Syncs the owning client's memory ledger to the current value of _memUsage. May only be
+     * called while attached to an operation context.
+     */
+    void updateMemoryLedger();
+
+    // The ledger currently charged for the buffered data, or null if nothing is charged.
+    // Charges are dropped while the stage is detached from an operation context, since the
+    // memory is then held by the cursor manager rather than any particular client.
+    ClientMemoryLedger* _ledger = nullptr;
+
+    // Bytes currently charged to _ledger.
+    long long _ledgerBytesCharged = 0;
 };
 
 }  // namespace mongo
@@ -44,11 +44,7 @@ WorkingSet::MemberHolder::~MemberHolder() {}
 
 WorkingSet::WorkingSet() : _freeList(INVALID_ID) {}
 
-WorkingSet::~WorkingSet() {
-    for (size_t i = 0; i < _data.size(); i++) {
-        delete _data[i].member;
-    }
-}
+WorkingSet::~WorkingSet() {}
 
 WorkingSetID WorkingSet::allocate() {
     if (_freeList == INVALID_ID) {
@@ -58,7 +54,15 @@ WorkingSetID WorkingSet::allocate() {
         WorkingSetID id = _data.size();
         _data.resize(_data.size() + 1);
         _data.back().nextFreeOrSelf = id;
-        _data.back().member = new WorkingSetMember();
+
+        // Hand out the next member from the current slab, starting a new slab if the
+        // previous one is exhausted. Slab members have stable addresses, so the pointer
+        // stored in the holder stays valid across later allocations.
+        const size_t offsetInSlab = id % kMembersPerSlab;
+        if (offsetInSlab == 0) {
+            _memberSlabs.emplace_back(new WorkingSetMember[kMembersPerSlab]);
+        }
+        _data.back().member = &_memberSlabs.back()[offsetInSlab];
         return id;
     }
 
@@ -96,10 +100,8 @@ bool WorkingSet::isFlagged(WorkingSetID id) const {
 }
 
 void WorkingSet::clear() {
-    for (size_t i = 0; i < _data.size(); i++) {
-        delete _data[i].member;
-    }
     _data.clear();
+    _memberSlabs.clear();
 
     // Since working set is now empty, the free list pointer should
     // point to nothing.
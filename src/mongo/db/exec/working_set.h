@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -147,14 +148,24 @@ private:
         // Free list link if freed. Points to self if in use.
         WorkingSetID nextFreeOrSelf;
 
-        // Owning pointer
+        // Points into one of the slabs in _memberSlabs. Not owned.
         WorkingSetMember* member;
     };
 
+    // Number of members allocated per slab.
+    static const size_t kMembersPerSlab = 64;
+
     // All WorkingSetIDs are indexes into this, except for INVALID_ID.
     // Elements are added to _freeList rather than removed when freed.
     std::vector<MemberHolder> _data;
 
+    // Backing storage for the members referenced by _data. Members are allocated a slab at
+    // a time and their addresses remain stable for the life of this WorkingSet; freed
+    // members are recycled through _freeList rather than deleted, so a plan execution pays
+    // one allocation per kMembersPerSlab members and releases them all at once in clear()
+    // or at destruction.
+    std::vector<std::unique_ptr<WorkingSetMember[]>> _memberSlabs;
+
     // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
     // link. INVALID_ID is the list terminator since 0 is a valid index.
     // If _freeList == INVALID_ID, the free list is empty and all elements in _data are in use.
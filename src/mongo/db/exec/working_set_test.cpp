@@ -154,4 +154,32 @@ TEST_F(WorkingSetFixture, getDottedFieldFromIndex) {
     ASSERT_FALSE(member->getFieldDotted("y", &elt));
 }
 
+TEST_F(WorkingSetFixture, MemberPointersStableAcrossSlabGrowth) {
+    // Allocate enough members to force several slabs and check that earlier members'
+    // addresses and contents are unaffected by later allocations.
+    std::vector<WorkingSetID> ids;
+    std::vector<WorkingSetMember*> members;
+    for (int i = 0; i < 300; i++) {
+        WorkingSetID newId = ws->allocate();
+        WorkingSetMember* newMember = ws->get(newId);
+        newMember->recordId = RecordId(i + 1);
+        ids.push_back(newId);
+        members.push_back(newMember);
+    }
+    for (size_t i = 0; i < ids.size(); i++) {
+        ASSERT_EQUALS(ws->get(ids[i]), members[i]);
+        ASSERT_EQUALS(members[i]->recordId, RecordId(static_cast<int64_t>(i) + 1));
+    }
+}
+
+TEST_F(WorkingSetFixture, FreedIdsAreRecycled) {
+    WorkingSetID a = ws->allocate();
+    WorkingSetID b = ws->allocate();
+    ws->free(b);
+    ws->free(a);
+    // LIFO recycling from the free list.
+    ASSERT_EQUALS(ws->allocate(), a);
+    ASSERT_EQUALS(ws->allocate(), b);
+}
+
 }  // namespace
@@ -125,6 +125,13 @@ public:
      */
     static FTDCController* get(ServiceContext* serviceContext);
 
+    /**
+     * Get the directory diagnostic data files are written to.
+     */
+    const boost::filesystem::path& getDirectory() const {
+        return _path;
+    }
+
     /**
      * Get a reference to most recent document from the periodic collectors.
      */
@@ -94,10 +94,13 @@ public:
               &localPeriodMillis) {}
 
     virtual Status validate(const std::int32_t& potentialNewValue) {
-        if (potentialNewValue < 100) {
+        // Periods well below the 1000ms default are supported so that transient stalls can be
+        // captured at high resolution, but each sample pays the full collection cost, so
+        // sub-100ms periods should only be used while actively diagnosing an issue.
+        if (potentialNewValue < 10) {
             return Status(
                 ErrorCodes::BadValue,
-                "diagnosticDataCollectionPeriodMillis must be greater than or equal to 100ms");
+                "diagnosticDataCollectionPeriodMillis must be greater than or equal to 10ms");
         }
 
         auto controller = getGlobalFTDCController();
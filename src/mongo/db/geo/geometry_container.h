@@ -65,6 +65,11 @@ public:
      */
     bool isPoint() const;
 
+    /**
+     * Returns the contained point. Valid only to call if isPoint().
+     */
+    const PointWithCRS& getPoint() const;
+
     /**
      * Reports the CRS of the contained geometry.
      * TODO: Rework once we have collections of multiple CRSes
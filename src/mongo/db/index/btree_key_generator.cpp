@@ -29,6 +29,7 @@
 #include "mongo/db/index/btree_key_generator.h"
 
 #include <boost/optional.hpp>
+#include <cstring>
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/bson/dotted_path_support.h"
@@ -65,6 +66,7 @@ BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
     _nullKey = nullKeyBuilder.obj();
 
     _isIdIndex = fieldNames.size() == 1 && std::string("_id") == fieldNames[0];
+    _isSingleFieldIndex = fieldNames.size() == 1 && !strchr(fieldNames[0], '.');
 }
 
 std::unique_ptr<BtreeKeyGenerator> BtreeKeyGenerator::make(IndexVersion indexVersion,
@@ -252,7 +254,12 @@ BSONElement BtreeKeyGeneratorV1::extractNextElement(const BSONObj& obj,
                                                     const PositionalPathInfo& positionalInfo,
                                                     const char** field,
                                                     bool* arrayNestedArray) const {
-    std::string firstField = mongoutils::str::before(*field, '.');
+    // Get the first path component as a view into '*field' rather than a copy; this runs once
+    // per indexed field per document (and again per array recursion level), so a std::string
+    // here is a per-key-generation allocation.
+    const char* firstDot = std::strchr(*field, '.');
+    const StringData firstField =
+        firstDot ? StringData(*field, firstDot - *field) : StringData(*field);
     bool haveObjField = !obj.getField(firstField).eoo();
     BSONElement arrField = positionalInfo.positionallyIndexedElt;
 
@@ -339,6 +346,31 @@ void BtreeKeyGeneratorV1::getKeysImpl(std::vector<const char*> fieldNames,
         return;
     }
 
+    if (_isSingleFieldIndex) {
+        // Single-field patterns without a dotted path - the vast majority of indexes - have a
+        // direct extract-and-encode path for non-array values. Array values fall through to the
+        // general machinery below, which handles key expansion and multikey accounting.
+        BSONElement e = obj.getField(fieldNames[0]);
+        if (e.type() != Array) {
+            if (multikeyPaths) {
+                invariant(multikeyPaths->empty());
+                multikeyPaths->resize(1);
+            }
+
+            if (e.eoo()) {
+                // A missing field indexes as null unless the index is sparse, in which case the
+                // document produces no key; both cases are handled by the caller when 'keys' is
+                // left empty.
+                return;
+            }
+
+            BSONObjBuilder b(_sizeTracker);
+            CollationIndexKey::collationAwareIndexKeyAppend(e, _collator, &b);
+            keys->insert(b.obj());
+            return;
+        }
+    }
+
     if (multikeyPaths) {
         invariant(multikeyPaths->empty());
         multikeyPaths->resize(fieldNames.size());
@@ -65,6 +65,9 @@ protected:
     // These are used by the getKeysImpl(s) below.
     std::vector<const char*> _fieldNames;
     bool _isIdIndex;
+    // True for single-field patterns without a dotted path, e.g. {field: 1}. Such patterns have a
+    // direct extract-and-encode path for non-array values.
+    bool _isSingleFieldIndex;
     bool _isSparse;
     BSONObj _nullKey;  // a full key with all fields null
     BSONSizeTracker _sizeTracker;
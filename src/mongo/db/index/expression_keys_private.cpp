@@ -89,9 +89,6 @@ Status S2GetKeysForElement(const BSONElement& element,
     if (!status.isOK())
         return status;
 
-    S2RegionCoverer coverer;
-    params.configureCoverer(geoContainer, &coverer);
-
     // Don't index big polygon
     if (geoContainer.getNativeCRS() == STRICT_SPHERE) {
         return Status(ErrorCodes::BadValue, "can't index geometry with strict winding order");
@@ -114,6 +111,17 @@ Status S2GetKeysForElement(const BSONElement& element,
 
     invariant(geoContainer.hasS2Region());
 
+    // Points in a version 3 (or later) index are always covered by their single cell at
+    // kPointIndexedLevel (the leaf level, per configureCoverer), so compute that cell directly
+    // rather than running the general covering machinery. Point inserts dominate most 2dsphere
+    // write workloads.
+    if (params.indexVersion >= S2_INDEX_VERSION_3 && geoContainer.isPoint()) {
+        out->push_back(S2CellId::FromPoint(geoContainer.getPoint().point));
+        return Status::OK();
+    }
+
+    S2RegionCoverer coverer;
+    params.configureCoverer(geoContainer, &coverer);
     coverer.GetCovering(geoContainer.getS2Region(), out);
     return Status::OK();
 }
@@ -351,9 +359,10 @@ void ExpressionKeysPrivate::getHashKeys(const BSONObj& obj,
     const char* cstr = hashedField.c_str();
     BSONElement fieldVal = dps::extractElementAtPath(obj, cstr);
 
-    // Convert strings to comparison keys.
+    // Convert strings to comparison keys. Without a collator the append would copy the element
+    // unchanged, so only pay for the rebuild when there is actually a collation to apply.
     BSONObj fieldValObj;
-    if (!fieldVal.eoo()) {
+    if (!fieldVal.eoo() && collator) {
         BSONObjBuilder bob;
         CollationIndexKey::collationAwareIndexKeyAppend(fieldVal, collator, &bob);
         fieldValObj = bob.obj();
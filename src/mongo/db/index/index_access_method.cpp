@@ -486,18 +486,25 @@ Status IndexAccessMethod::commitBulk(OperationContext* opCtx,
         wunit.commit();
     });
 
+    // Wrap many keys in each WriteUnitOfWork rather than committing per key. The builders
+    // write through their own bulk interface (WiredTiger uses a dedicated bulk cursor on a
+    // separate session), so the unit of work itself stays small; a per-key commit just adds a
+    // storage transaction begin/commit for every key of the index.
+    const int kKeysPerWriteUnit = 1000;
+    int keysInWriteUnit = 0;
+
+    std::unique_ptr<WriteUnitOfWork> wunit(new WriteUnitOfWork(opCtx));
+    // Improve performance in the btree-building phase by disabling rollback tracking.
+    // This avoids copying all the written bytes to a buffer that is only used to roll back.
+    // Note that this is safe to do, as this entire index-build-in-progress will be cleaned
+    // up by the index system.
+    opCtx->recoveryUnit()->setRollbackWritesDisabled();
+
     while (i->more()) {
         if (mayInterrupt) {
             opCtx->checkForInterrupt();
         }
 
-        WriteUnitOfWork wunit(opCtx);
-        // Improve performance in the btree-building phase by disabling rollback tracking.
-        // This avoids copying all the written bytes to a buffer that is only used to roll back.
-        // Note that this is safe to do, as this entire index-build-in-progress will be cleaned
-        // up by the index system.
-        opCtx->recoveryUnit()->setRollbackWritesDisabled();
-
         // Get the next datum and add it to the builder.
         BulkBuilder::Sorter::Data d = i->next();
         Status status = builder->addKey(d.first, d.second);
@@ -524,9 +531,17 @@ Status IndexAccessMethod::commitBulk(OperationContext* opCtx,
         // If we're here either it's a dup and we're cool with it or the addKey went just
         // fine.
         pm.hit();
-        wunit.commit();
+
+        if (++keysInWriteUnit >= kKeysPerWriteUnit) {
+            wunit->commit();
+            wunit.reset(new WriteUnitOfWork(opCtx));
+            opCtx->recoveryUnit()->setRollbackWritesDisabled();
+            keysInWriteUnit = 0;
+        }
     }
 
+    wunit->commit();
+
     pm.finished();
 
     {
@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/ingress_admission.h"
+
+#include <algorithm>
+
+#include "mongo/base/counter.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+
+namespace {
+
+// Maximum number of external client operations allowed to execute concurrently. Values <= 0
+// disable admission control entirely, which is the default.
+MONGO_EXPORT_SERVER_PARAMETER(ingressAdmissionMaxConcurrentOperations, int, 0);
+
+// Fraction of the concurrency budget a single tenant may hold; a tenant at its share is
+// rejected even while the server as a whole still has headroom, which is what isolates the
+// remaining tenants from a misbehaving one.
+MONGO_EXPORT_SERVER_PARAMETER(ingressAdmissionMaxTenantFraction, double, 0.5);
+
+const auto getIngressAdmissionController =
+    ServiceContext::declareDecoration<IngressAdmissionController>();
+
+Counter64 admittedCounter;
+Counter64 rejectedCounter;
+
+ServerStatusMetricField<Counter64> displayAdmitted("ingressAdmission.admitted",
+                                                   &admittedCounter);
+ServerStatusMetricField<Counter64> displayRejected("ingressAdmission.rejected",
+                                                   &rejectedCounter);
+
+}  // namespace
+
+IngressAdmissionController& IngressAdmissionController::get(ServiceContext* service) {
+    return getIngressAdmissionController(service);
+}
+
+IngressAdmissionController::Ticket IngressAdmissionController::admit(StringData tenant) {
+    const int maxConcurrent = ingressAdmissionMaxConcurrentOperations.load();
+    if (maxConcurrent <= 0) {
+        return {};
+    }
+
+    const auto tenantLimit = std::max<long long>(
+        1, static_cast<long long>(maxConcurrent * ingressAdmissionMaxTenantFraction.load()));
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    auto it = _tenantInFlight.find(tenant);
+    const long long tenantCount = (it != _tenantInFlight.end()) ? it->second : 0;
+
+    if (tenantCount >= tenantLimit) {
+        rejectedCounter.increment();
+        uasserted(ErrorCodes::TooManyRequests,
+                  str::stream() << "tenant '" << tenant << "' has reached its limit of "
+                                << tenantLimit
+                                << " concurrent operations; retry after backing off");
+    }
+
+    if (_totalInFlight >= maxConcurrent) {
+        rejectedCounter.increment();
+        uasserted(ErrorCodes::TooManyRequests,
+                  str::stream() << "server has reached its limit of " << maxConcurrent
+                                << " concurrent operations; retry after backing off");
+    }
+
+    if (it != _tenantInFlight.end()) {
+        it->second++;
+    } else {
+        _tenantInFlight[tenant] = 1;
+    }
+    _totalInFlight++;
+
+    admittedCounter.increment();
+    return Ticket(this, tenant.toString());
+}
+
+void IngressAdmissionController::_releaseTicket(const std::string& tenant) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    auto it = _tenantInFlight.find(tenant);
+    invariant(it != _tenantInFlight.end() && it->second > 0);
+    if (--it->second == 0) {
+        _tenantInFlight.erase(tenant);
+    }
+
+    invariant(_totalInFlight > 0);
+    _totalInFlight--;
+}
+
+}  // namespace mongo
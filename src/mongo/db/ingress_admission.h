@@ -0,0 +1,126 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/string_data.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Caps the number of operations executing concurrently on behalf of external clients, with a
+ * per-tenant share so that one saturating workload cannot consume the entire budget. A tenant
+ * is the client's application name when provided in the connection metadata, otherwise the
+ * database the command targets. Over-budget requests fail immediately with TooManyRequests
+ * rather than queueing behind the backlog they would otherwise join; the client is expected to
+ * back off and retry. Disabled by default (see ingressAdmissionMaxConcurrentOperations).
+ */
+class IngressAdmissionController {
+    MONGO_DISALLOW_COPYING(IngressAdmissionController);
+
+public:
+    /**
+     * Represents one admitted operation. Releases its slot on destruction. A
+     * default-constructed Ticket holds no slot and is what admit() returns while admission
+     * control is disabled.
+     */
+    class Ticket {
+    public:
+        Ticket() = default;
+
+        Ticket(Ticket&& other) : _controller(other._controller), _tenant(std::move(other._tenant)) {
+            other._controller = nullptr;
+        }
+
+        Ticket& operator=(Ticket&& other) {
+            if (this != &other) {
+                _release();
+                _controller = other._controller;
+                _tenant = std::move(other._tenant);
+                other._controller = nullptr;
+            }
+            return *this;
+        }
+
+        ~Ticket() {
+            _release();
+        }
+
+    private:
+        friend class IngressAdmissionController;
+
+        Ticket(IngressAdmissionController* controller, std::string tenant)
+            : _controller(controller), _tenant(std::move(tenant)) {}
+
+        void _release() {
+            if (_controller) {
+                _controller->_releaseTicket(_tenant);
+                _controller = nullptr;
+            }
+        }
+
+        IngressAdmissionController* _controller = nullptr;
+        std::string _tenant;
+    };
+
+    IngressAdmissionController() = default;
+
+    /**
+     * Retrieves the IngressAdmissionController decoration on 'service'.
+     */
+    static IngressAdmissionController& get(ServiceContext* service);
+
+    /**
+     * Admits one operation for 'tenant', returning the Ticket that holds its slot. Throws a
+     * TooManyRequests assertion when the tenant is over its share of the concurrency budget or
+     * the budget as a whole is exhausted.
+     */
+    Ticket admit(StringData tenant);
+
+private:
+    friend class Ticket;
+
+    void _releaseTicket(const std::string& tenant);
+
+    stdx::mutex _mutex;
+
+    // Number of admitted operations still executing, in total and per tenant. Tenant entries
+    // are erased when their count drops to zero so the map stays bounded by the number of
+    // concurrently active tenants.
+    long long _totalInFlight = 0;
+    StringMap<long long> _tenantInFlight;
+};
+
+}  // namespace mongo
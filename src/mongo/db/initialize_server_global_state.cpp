@@ -51,6 +51,8 @@
 #include "mongo/db/auth/internal_user_auth.h"
 #include "mongo/db/auth/security_key.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/logger/async_message_appender.h"
 #include "mongo/logger/console_appender.h"
 #include "mongo/logger/logger.h"
 #include "mongo/logger/message_event.h"
@@ -202,6 +204,28 @@ void forkServerOrDie() {
         quickExit(EXIT_FAILURE);
 }
 
+namespace {
+
+// Startup-only parameter.  When true, messages logged to the global log domain are queued and
+// written to the configured destination by a dedicated thread, rather than written
+// synchronously by the thread that produced them.  If the destination cannot keep up with the
+// log volume, queued messages are dropped and counted instead of stalling operations.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(asynchronousLogWrites, bool, false);
+
+/**
+ * Wraps "appender" in an AsyncMessageAppender when asynchronous log writes are enabled.
+ */
+logger::MessageLogDomain::AppenderAutoPtr maybeMakeAsync(
+    logger::MessageLogDomain::AppenderAutoPtr appender) {
+    if (!asynchronousLogWrites) {
+        return appender;
+    }
+    return logger::MessageLogDomain::AppenderAutoPtr(
+        new logger::AsyncMessageAppender(std::move(appender)));
+}
+
+}  // namespace
+
 MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
                           ("GlobalLogManager", "EndStartupOptionHandling", "ForkServer"),
                           ("default"))
@@ -226,8 +250,10 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         openlog(strdup(sb.str().c_str()), LOG_PID | LOG_CONS, serverGlobalParams.syslogFacility);
         LogManager* manager = logger::globalLogManager();
         manager->getGlobalDomain()->clearAppenders();
-        manager->getGlobalDomain()->attachAppender(MessageLogDomain::AppenderAutoPtr(
-            new SyslogAppender<MessageEventEphemeral>(new logger::MessageEventWithContextEncoder)));
+        manager->getGlobalDomain()->attachAppender(
+            maybeMakeAsync(MessageLogDomain::AppenderAutoPtr(
+                new SyslogAppender<MessageEventEphemeral>(
+                    new logger::MessageEventWithContextEncoder))));
         manager->getNamedDomain("javascriptOutput")
             ->attachAppender(
                 MessageLogDomain::AppenderAutoPtr(new SyslogAppender<MessageEventEphemeral>(
@@ -287,8 +313,9 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         LogManager* manager = logger::globalLogManager();
         manager->getGlobalDomain()->clearAppenders();
         manager->getGlobalDomain()->attachAppender(
-            MessageLogDomain::AppenderAutoPtr(new RotatableFileAppender<MessageEventEphemeral>(
-                new MessageEventDetailsEncoder, writer.getValue())));
+            maybeMakeAsync(MessageLogDomain::AppenderAutoPtr(
+                new RotatableFileAppender<MessageEventEphemeral>(new MessageEventDetailsEncoder,
+                                                                 writer.getValue()))));
         manager->getNamedDomain("javascriptOutput")
             ->attachAppender(
                 MessageLogDomain::AppenderAutoPtr(new RotatableFileAppender<MessageEventEphemeral>(
@@ -301,6 +328,15 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
                 return status;
         }
     } else {
+        if (asynchronousLogWrites) {
+            // Replace the default synchronous console appender installed by GlobalLogManager.
+            LogManager* manager = logger::globalLogManager();
+            manager->getGlobalDomain()->clearAppenders();
+            manager->getGlobalDomain()->attachAppender(
+                maybeMakeAsync(MessageLogDomain::AppenderAutoPtr(
+                    new logger::ConsoleAppender<MessageEventEphemeral>(
+                        new MessageEventDetailsEncoder))));
+        }
         logger::globalLogManager()
             ->getNamedDomain("javascriptOutput")
             ->attachAppender(MessageLogDomain::AppenderAutoPtr(
@@ -63,7 +63,8 @@ LogicalSessionCache::LogicalSessionCache(std::unique_ptr<ServiceLiason> service,
       _service(std::move(service)),
       _sessionsColl(std::move(collection)),
       _cache(options.capacity) {
-    PeriodicRunner::PeriodicJob job{[this] { _refresh(); },
+    PeriodicRunner::PeriodicJob job{"LogicalSessionCacheRefresh",
+                                    [this] { _refresh(); },
                                     duration_cast<Milliseconds>(_refreshInterval)};
     _service->scheduleJob(std::move(job));
 }
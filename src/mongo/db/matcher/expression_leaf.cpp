@@ -30,6 +30,7 @@
 
 #include "mongo/db/matcher/expression_leaf.h"
 
+#include <algorithm>
 #include <cmath>
 #include <pcrecpp.h>
 
@@ -264,19 +265,110 @@ Status RegexMatchExpression::init(StringData path, StringData regex, StringData
     _regex = regex.toString();
     _flags = options.toString();
     _re.reset(new pcrecpp::RE(_regex.c_str(), flags2options(_flags.c_str())));
+    _extractPrefilter();
 
     return setPath(path);
 }
 
+namespace {
+
+bool isRegexMetacharacter(char c) {
+    switch (c) {
+        case '\\':
+        case '^':
+        case '$':
+        case '.':
+        case '|':
+        case '?':
+        case '*':
+        case '+':
+        case '(':
+        case ')':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+void RegexMatchExpression::_extractPrefilter() {
+    _prefilterType = Prefilter::kNone;
+    _prefilterLiteral.clear();
+
+    // Case-insensitive matching defeats a byte-wise literal check, and extended mode changes
+    // how the pattern itself is read.
+    if (_flags.find('i') != std::string::npos || _flags.find('x') != std::string::npos) {
+        return;
+    }
+
+    // A top-level alternation means no one literal is required, e.g. /^ab|cd/ can match
+    // strings not starting with "ab". Rather than parse grouping we give up on any '|'.
+    if (_regex.find('|') != std::string::npos) {
+        return;
+    }
+
+    if (std::find_if(_regex.begin(), _regex.end(), isRegexMetacharacter) == _regex.end()) {
+        // The pattern is a pure literal; any matching string must contain it.
+        if (!_regex.empty()) {
+            _prefilterType = Prefilter::kSubstring;
+            _prefilterLiteral = _regex;
+        }
+        return;
+    }
+
+    // In multiline mode '^' anchors to line starts rather than the string start, so a prefix
+    // check against the start of the string could reject strings that match on a later line.
+    if (_regex[0] != '^' || _flags.find('m') != std::string::npos) {
+        return;
+    }
+
+    std::string prefix;
+    for (size_t i = 1; i < _regex.size(); ++i) {
+        const char c = _regex[i];
+        if (isRegexMetacharacter(c)) {
+            // A quantifier makes the preceding character optional (or repeatable with a
+            // possibly-zero lower bound), so it is not part of the required prefix.
+            if ((c == '?' || c == '*' || c == '{') && !prefix.empty()) {
+                prefix.pop_back();
+            }
+            break;
+        }
+        prefix.push_back(c);
+    }
+
+    if (!prefix.empty()) {
+        _prefilterType = Prefilter::kPrefix;
+        _prefilterLiteral = std::move(prefix);
+    }
+}
+
 bool RegexMatchExpression::matchesSingleElement(const BSONElement& e) const {
     switch (e.type()) {
         case String:
         case Symbol: {
             // String values stored in documents can contain embedded NUL bytes. We construct a
-            // pcrecpp::StringPiece instance using the full length of the string to avoid truncating
+            // StringData instance using the full length of the string to avoid truncating
             // 'data' early.
-            pcrecpp::StringPiece data(e.valuestr(), e.valuestrsize() - 1);
-            return _re->PartialMatch(data);
+            StringData data(e.valuestr(), e.valuestrsize() - 1);
+
+            // Reject without running pcre when the string lacks a literal the pattern
+            // requires. This is a pure prefilter: strings that pass are still matched below.
+            if (_prefilterType == Prefilter::kPrefix) {
+                if (!data.startsWith(_prefilterLiteral)) {
+                    return false;
+                }
+            } else if (_prefilterType == Prefilter::kSubstring) {
+                if (data.find(_prefilterLiteral) == std::string::npos) {
+                    return false;
+                }
+            }
+
+            return _re->PartialMatch(pcrecpp::StringPiece(data.rawData(), data.size()));
         }
         case RegEx:
             return _regex == e.regex() && _flags == e.regexFlags();
@@ -499,7 +591,7 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     }
     next->_hasNull = _hasNull;
     next->_hasEmptyArray = _hasEmptyArray;
-    next->_equalitySet = _equalitySet;
+    next->_equalityVector = _equalityVector;
     next->_originalEqualityVector = _originalEqualityVector;
     for (auto&& regex : _regexes) {
         std::unique_ptr<RegexMatchExpression> clonedRegex(
@@ -513,7 +605,10 @@ bool InMatchExpression::matchesSingleElement(const BSONElement& e) const {
     if (_hasNull && e.eoo()) {
         return true;
     }
-    if (_equalitySet.find(e) != _equalitySet.end()) {
+    if (std::binary_search(_equalityVector.begin(),
+                           _equalityVector.end(),
+                           e,
+                           BSONElementCmpWithoutField(_collator))) {
         return true;
     }
     for (auto&& regex : _regexes) {
@@ -528,7 +623,7 @@ void InMatchExpression::debugString(StringBuilder& debug, int level) const {
     _debugAddSpace(debug, level);
     debug << path() << " $in ";
     debug << "[ ";
-    for (auto&& equality : _equalitySet) {
+    for (auto&& equality : _equalityVector) {
         debug << equality.toString(false) << " ";
     }
     for (auto&& regex : _regexes) {
@@ -547,7 +642,7 @@ void InMatchExpression::debugString(StringBuilder& debug, int level) const {
 void InMatchExpression::serialize(BSONObjBuilder* out) const {
     BSONObjBuilder inBob(out->subobjStart(path()));
     BSONArrayBuilder arrBob(inBob.subarrayStart("$in"));
-    for (auto&& _equality : _equalitySet) {
+    for (auto&& _equality : _equalityVector) {
         arrBob.append(_equality);
     }
     for (auto&& _regex : _regexes) {
@@ -581,34 +676,33 @@ bool InMatchExpression::equivalent(const MatchExpression* other) const {
     if (!CollatorInterface::collatorsMatch(_collator, realOther->_collator)) {
         return false;
     }
-    // We use an element-wise comparison to check equivalence of '_equalitySet'.  Unfortunately, we
-    // can't use BSONElementSet::operator==(), as it does not use the comparator object the set is
-    // initialized with (and as such, it is not collation-aware).
-    if (_equalitySet.size() != realOther->_equalitySet.size()) {
+    // We use an element-wise comparison to check equivalence of '_equalityVector'.  We can't
+    // use std::vector::operator==(), as it compares with BSONElement::operator==(), which is
+    // not collation-aware. Both vectors are sorted, so equivalent expressions compare equal
+    // position by position.
+    if (_equalityVector.size() != realOther->_equalityVector.size()) {
         return false;
     }
-    auto thisEqIt = _equalitySet.begin();
-    auto otherEqIt = realOther->_equalitySet.begin();
-    for (; thisEqIt != _equalitySet.end(); ++thisEqIt, ++otherEqIt) {
+    auto thisEqIt = _equalityVector.begin();
+    auto otherEqIt = realOther->_equalityVector.begin();
+    for (; thisEqIt != _equalityVector.end(); ++thisEqIt, ++otherEqIt) {
         const bool considerFieldName = false;
         if (thisEqIt->woCompare(*otherEqIt, considerFieldName, _collator)) {
             return false;
         }
     }
-    invariant(otherEqIt == realOther->_equalitySet.end());
+    invariant(otherEqIt == realOther->_equalityVector.end());
     return true;
 }
 
 void InMatchExpression::_doSetCollator(const CollatorInterface* collator) {
     _collator = collator;
 
-    // We need to re-compute '_equalitySet', since our set comparator has changed.
-    BSONElementSet equalitiesWithNewComparator(
-        _originalEqualityVector.begin(), _originalEqualityVector.end(), collator);
-    _equalitySet = std::move(equalitiesWithNewComparator);
+    // We need to re-compute '_equalityVector', since our comparator has changed.
+    _sortAndDedupEqualities();
 }
 
-Status InMatchExpression::addEquality(const BSONElement& elt) {
+Status InMatchExpression::_checkEquality(const BSONElement& elt) {
     if (elt.type() == BSONType::RegEx) {
         return Status(ErrorCodes::BadValue, "InMatchExpression equality cannot be a regex");
     }
@@ -622,11 +716,54 @@ Status InMatchExpression::addEquality(const BSONElement& elt) {
     if (elt.type() == BSONType::Array && elt.Obj().isEmpty()) {
         _hasEmptyArray = true;
     }
-    _equalitySet.insert(elt);
+    return Status::OK();
+}
+
+void InMatchExpression::_sortAndDedupEqualities() {
+    const BSONElementCmpWithoutField eltCmp(_collator);
+    _equalityVector = _originalEqualityVector;
+    std::sort(_equalityVector.begin(), _equalityVector.end(), eltCmp);
+    _equalityVector.erase(std::unique(_equalityVector.begin(),
+                                      _equalityVector.end(),
+                                      [this](const BSONElement& lhs, const BSONElement& rhs) {
+                                          const bool considerFieldName = false;
+                                          return lhs.woCompare(rhs, considerFieldName, _collator) ==
+                                              0;
+                                      }),
+                          _equalityVector.end());
+}
+
+Status InMatchExpression::addEquality(const BSONElement& elt) {
+    Status s = _checkEquality(elt);
+    if (!s.isOK()) {
+        return s;
+    }
+
+    // Insertion sort keeps '_equalityVector' ordered. Adding n elements one at a time costs
+    // O(n^2); callers with large lists should use setEqualities() instead.
+    const BSONElementCmpWithoutField eltCmp(_collator);
+    auto insertionPoint =
+        std::lower_bound(_equalityVector.begin(), _equalityVector.end(), elt, eltCmp);
+    if (insertionPoint == _equalityVector.end() || eltCmp(elt, *insertionPoint)) {
+        _equalityVector.insert(insertionPoint, elt);
+    }
     _originalEqualityVector.push_back(elt);
     return Status::OK();
 }
 
+Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
+    for (auto&& elt : equalities) {
+        Status s = _checkEquality(elt);
+        if (!s.isOK()) {
+            return s;
+        }
+    }
+
+    _originalEqualityVector = std::move(equalities);
+    _sortAndDedupEqualities();
+    return Status::OK();
+}
+
 Status InMatchExpression::addRegex(std::unique_ptr<RegexMatchExpression> expr) {
     _regexes.push_back(std::move(expr));
     return Status::OK();
@@ -225,9 +225,27 @@ public:
     }
 
 private:
+    /**
+     * Extracts a literal from the pattern which any matching string must contain, so that
+     * matchesSingleElement() can cheaply reject most non-matching strings without invoking
+     * pcre. Called by init() after the pattern has been compiled.
+     */
+    void _extractPrefilter();
+
+    // How '_prefilterLiteral' constrains matching strings. The prefilter only ever rejects;
+    // strings that pass it are still handed to pcre.
+    enum class Prefilter {
+        kNone,       // No usable literal could be extracted.
+        kPrefix,     // Matching strings must start with '_prefilterLiteral'.
+        kSubstring,  // Matching strings must contain '_prefilterLiteral'.
+    };
+
     std::string _regex;
     std::string _flags;
     std::unique_ptr<pcrecpp::RE> _re;
+
+    Prefilter _prefilterType = Prefilter::kNone;
+    std::string _prefilterLiteral;
 };
 
 class ModMatchExpression : public LeafMatchExpression {
@@ -315,10 +333,17 @@ public:
 
     Status addEquality(const BSONElement& elt);
 
+    /**
+     * Replaces the equality elements with 'equalities'. More efficient than repeated
+     * addEquality() calls for large lists, since the elements are sorted once rather than
+     * inserted one by one.
+     */
+    Status setEqualities(std::vector<BSONElement> equalities);
+
     Status addRegex(std::unique_ptr<RegexMatchExpression> expr);
 
-    const BSONElementSet& getEqualities() const {
-        return _equalitySet;
+    const std::vector<BSONElement>& getEqualities() const {
+        return _equalityVector;
     }
 
     const std::vector<std::unique_ptr<RegexMatchExpression>>& getRegexes() const {
@@ -338,21 +363,33 @@ public:
     }
 
 private:
-    // Whether or not '_equalities' has a jstNULL element in it.
+    /**
+     * Validates 'elt' as an equality element and records whether it is null or an empty array.
+     * Does not add it to '_equalityVector'.
+     */
+    Status _checkEquality(const BSONElement& elt);
+
+    /**
+     * Rebuilds '_equalityVector' from '_originalEqualityVector': sorted under '_collator' with
+     * duplicates removed, so membership checks can binary search.
+     */
+    void _sortAndDedupEqualities();
+
+    // Whether or not '_equalityVector' has a jstNULL element in it.
     bool _hasNull = false;
 
-    // Whether or not '_equalities' has an empty array element in it.
+    // Whether or not '_equalityVector' has an empty array element in it.
     bool _hasEmptyArray = false;
 
     // Collator used to compare elements. By default, simple binary comparison will be used.
     const CollatorInterface* _collator = nullptr;
 
-    // Set of equality elements associated with this expression. '_collator' is used as a comparator
-    // for this set.
-    BSONElementSet _equalitySet;
+    // Deduplicated equality elements associated with this expression, sorted using '_collator'
+    // so that membership checks can binary search rather than walk a node-based set.
+    std::vector<BSONElement> _equalityVector;
 
     // Original container of equality elements, including duplicates. Needed for re-computing
-    // '_equalitySet' in case '_collator' changes after elements have been added.
+    // '_equalityVector' in case '_collator' changes after elements have been added.
     std::vector<BSONElement> _originalEqualityVector;
 
     // Container of regex elements this object owns.
@@ -925,6 +925,42 @@ TEST(RegexMatchExpression, MatchesElementSimplePrefix) {
     ASSERT(!regex.matchesSingleElement(notMatch.firstElement()));
 }
 
+TEST(RegexMatchExpression, MatchesElementLiteralSubstring) {
+    BSONObj match = BSON("x"
+                         << "zabcz");
+    BSONObj notMatch = BSON("x"
+                            << "zabz");
+    RegexMatchExpression regex;
+    ASSERT(regex.init("", "abc", "").isOK());
+    ASSERT(regex.matchesSingleElement(match.firstElement()));
+    ASSERT(!regex.matchesSingleElement(notMatch.firstElement()));
+}
+
+TEST(RegexMatchExpression, MatchesElementPrefixWithOptionalCharacter) {
+    // The 'b' is optional, so "ac" must match even though the pattern starts with
+    // the literal characters "ab".
+    BSONObj match = BSON("x"
+                         << "abc");
+    BSONObj matchWithoutOptional = BSON("x"
+                                        << "ac");
+    BSONObj notMatch = BSON("x"
+                            << "zac");
+    RegexMatchExpression regex;
+    ASSERT(regex.init("", "^ab?c", "").isOK());
+    ASSERT(regex.matchesSingleElement(match.firstElement()));
+    ASSERT(regex.matchesSingleElement(matchWithoutOptional.firstElement()));
+    ASSERT(!regex.matchesSingleElement(notMatch.firstElement()));
+}
+
+TEST(RegexMatchExpression, MatchesElementPrefixWithAlternation) {
+    // With a top-level alternation, matches need not start with the leading literal.
+    BSONObj match = BSON("x"
+                         << "zcd");
+    RegexMatchExpression regex;
+    ASSERT(regex.init("", "^ab|cd", "").isOK());
+    ASSERT(regex.matchesSingleElement(match.firstElement()));
+}
+
 TEST(RegexMatchExpression, MatchesElementCaseSensitive) {
     BSONObj match = BSON("x"
                          << "abc");
@@ -1703,8 +1739,8 @@ TEST(InMatchExpression, ChangingCollationAfterAddingEqualitiesPreservesEqualitie
     ASSERT(in.getEqualities().size() == 1);
     in.setCollator(&collatorReverseString);
     ASSERT(in.getEqualities().size() == 2);
-    ASSERT(in.getEqualities().count(obj1.firstElement()));
-    ASSERT(in.getEqualities().count(obj2.firstElement()));
+    ASSERT(in.matchesSingleElement(obj1.firstElement()));
+    ASSERT(in.matchesSingleElement(obj2.firstElement()));
 }
 
 std::vector<uint32_t> bsonArrayToBitPositions(const BSONArray& ba) {
@@ -0,0 +1,100 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/operation_arena.h"
+
+#include "mongo/base/counter.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/operation_context.h"
+
+namespace mongo {
+
+namespace {
+
+Counter64 arenaBytesAllocated;
+Counter64 arenaOperationsTotal;
+
+// Coarse histogram of arena bytes consumed per operation, counted when the operation context
+// is destroyed. Operations that never touch the arena are not counted.
+Counter64 arenaOperationsUnder4KB;
+Counter64 arenaOperationsUnder64KB;
+Counter64 arenaOperationsUnder1MB;
+Counter64 arenaOperationsOver1MB;
+
+ServerStatusMetricField<Counter64> displayBytesAllocated("operationArena.bytesAllocated",
+                                                         &arenaBytesAllocated);
+ServerStatusMetricField<Counter64> displayOperationsTotal("operationArena.operationsTotal",
+                                                          &arenaOperationsTotal);
+ServerStatusMetricField<Counter64> displayUnder4KB("operationArena.operationsUnder4KB",
+                                                   &arenaOperationsUnder4KB);
+ServerStatusMetricField<Counter64> displayUnder64KB("operationArena.operationsUnder64KB",
+                                                    &arenaOperationsUnder64KB);
+ServerStatusMetricField<Counter64> displayUnder1MB("operationArena.operationsUnder1MB",
+                                                   &arenaOperationsUnder1MB);
+ServerStatusMetricField<Counter64> displayOver1MB("operationArena.operationsOver1MB",
+                                                  &arenaOperationsOver1MB);
+
+/**
+ * Decoration holding the arena so its destructor, which runs when the operation context is
+ * destroyed, can record how much the operation consumed.
+ */
+class OperationArena {
+public:
+    ~OperationArena() {
+        const size_t bytes = arena.bytesAllocated();
+        if (bytes == 0) {
+            return;
+        }
+
+        arenaBytesAllocated.increment(bytes);
+        arenaOperationsTotal.increment();
+        if (bytes <= 4 * 1024) {
+            arenaOperationsUnder4KB.increment();
+        } else if (bytes <= 64 * 1024) {
+            arenaOperationsUnder64KB.increment();
+        } else if (bytes <= 1024 * 1024) {
+            arenaOperationsUnder1MB.increment();
+        } else {
+            arenaOperationsOver1MB.increment();
+        }
+    }
+
+    Arena arena;
+};
+
+const auto getOperationArena = OperationContext::declareDecoration<OperationArena>();
+
+}  // namespace
+
+Arena& arenaForOperation(OperationContext* opCtx) {
+    return getOperationArena(opCtx).arena;
+}
+
+}  // namespace mongo
@@ -38,6 +38,7 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop_metrics.h"
@@ -59,12 +60,17 @@
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_state.h"
+#include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/sharding_state.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/db/stats/recent_slow_ops.h"
 #include "mongo/db/stats/top.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
@@ -79,6 +85,10 @@ MONGO_FP_DECLARE(failAllInserts);
 MONGO_FP_DECLARE(failAllUpdates);
 MONGO_FP_DECLARE(failAllRemoves);
 
+// Maximum number of worker threads an unordered insert batch may be spread across. Values <= 1
+// leave all batches running serially on the connection thread.
+MONGO_EXPORT_SERVER_PARAMETER(internalUnorderedInsertWorkers, int, 1);
+
 void finishCurOp(OperationContext* opCtx, CurOp* curOp) {
     try {
         curOp->done();
@@ -105,6 +115,10 @@ void finishCurOp(OperationContext* opCtx, CurOp* curOp) {
                                                                  logger::LogSeverity::Debug(1));
         const bool logSlow = executionTimeMicros > (serverGlobalParams.slowMS * 1000LL);
 
+        if (logSlow) {
+            RecentSlowOps::get(opCtx->getServiceContext()).record(curOp);
+        }
+
         const bool shouldSample = serverGlobalParams.sampleRate == 1.0
             ? true
             : opCtx->getClient()->getPrng().nextCanonicalDouble() < serverGlobalParams.sampleRate;
@@ -401,6 +415,168 @@ bool insertBatchAndHandleErrors(OperationContext* opCtx,
     return true;
 }
 
+/**
+ * Performs the insert statements in ['begin', 'end'), a subrange of 'wholeOp.getDocuments()', and
+ * appends a result per statement, in order, to 'out'. Returns true if the caller may continue with
+ * further statements.
+ */
+bool insertDocumentRange(OperationContext* opCtx,
+                         const InsertOp& wholeOp,
+                         std::vector<BSONObj>::const_iterator begin,
+                         std::vector<BSONObj>::const_iterator end,
+                         WriteResult* out) {
+    DisableDocumentValidationIfTrue docValidationDisabler(
+        opCtx, wholeOp.getWriteCommandBase().getBypassDocumentValidation());
+    LastOpFixer lastOpFixer(opCtx, wholeOp.getNamespace());
+
+    size_t bytesInBatch = 0;
+    std::vector<BSONObj> batch;
+    const size_t maxBatchSize = internalInsertMaxBatchSize.load();
+    batch.reserve(std::min(static_cast<size_t>(end - begin), maxBatchSize));
+
+    for (auto it = begin; it != end; ++it) {
+        const bool isLastDoc = (it + 1 == end);
+        auto fixedDoc = fixDocumentForInsert(opCtx->getServiceContext(), *it);
+        if (!fixedDoc.isOK()) {
+            // Handled after we insert anything in the batch to be sure we report errors in the
+            // correct order. In an ordered insert, if one of the docs ahead of us fails, we should
+            // behave as-if we never got to this document.
+        } else {
+            batch.push_back(fixedDoc.getValue().isEmpty() ? *it : std::move(fixedDoc.getValue()));
+            bytesInBatch += batch.back().objsize();
+            if (!isLastDoc && batch.size() < maxBatchSize && bytesInBatch < insertVectorMaxBytes)
+                continue;  // Add more to batch before inserting.
+        }
+
+        bool canContinue = insertBatchAndHandleErrors(opCtx, wholeOp, batch, &lastOpFixer, out);
+        batch.clear();  // We won't need the current batch any more.
+        bytesInBatch = 0;
+
+        if (canContinue && !fixedDoc.isOK()) {
+            globalOpCounters.gotInsert();
+            canContinue = handleError(
+                opCtx,
+                UserException(fixedDoc.getStatus().code(), fixedDoc.getStatus().reason()),
+                wholeOp.getNamespace(),
+                wholeOp.getWriteCommandBase(),
+                out);
+        }
+
+        if (!canContinue)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Returns the number of worker threads to spread an insert batch across, or 1 if the batch must
+ * run serially on the connection thread.
+ */
+size_t numWorkersForInserts(OperationContext* opCtx, const InsertOp& wholeOp) {
+    const int requested = internalUnorderedInsertWorkers.load();
+    if (requested <= 1)
+        return 1;
+
+    // Ordered batches stop at the first error, which only makes sense when statements run in
+    // sequence. Operations from a DBDirectClient share the caller's OperationContext, and
+    // statements that carry a shard version need the stale-config handling in handleError() to
+    // run on the connection thread.
+    if (wholeOp.getWriteCommandBase().getOrdered() || opCtx->getClient()->isInDirectClient() ||
+        OperationShardingState::get(opCtx).hasShardVersion()) {
+        return 1;
+    }
+
+    // Only fan out when every worker gets at least one full batch; smaller operations don't
+    // amortize the cost of spawning threads.
+    const size_t maxUseful =
+        wholeOp.getDocuments().size() / static_cast<size_t>(internalInsertMaxBatchSize.load());
+    if (maxUseful < 2)
+        return 1;
+
+    return std::min(static_cast<size_t>(requested), maxUseful);
+}
+
+/**
+ * Executes an unordered insert batch by splitting it into contiguous slices and running each slice
+ * on its own worker thread with its own OperationContext. Statement results are merged back in
+ * statement order, so the reply is indistinguishable from a serial execution.
+ */
+WriteResult performParallelInserts(OperationContext* opCtx,
+                                   const InsertOp& wholeOp,
+                                   size_t numWorkers) {
+    const auto& docs = wholeOp.getDocuments();
+    const size_t docsPerWorker = (docs.size() + numWorkers - 1) / numWorkers;
+
+    std::vector<WriteResult> sliceResults(numWorkers);
+    std::vector<repl::OpTime> sliceOpTimes(numWorkers);
+
+    stdx::mutex statusMutex;
+    Status workerStatus = Status::OK();
+
+    std::vector<stdx::thread> workers;
+    workers.reserve(numWorkers);
+    for (size_t workerId = 0; workerId < numWorkers; workerId++) {
+        const auto begin = docs.begin() + std::min(docs.size(), workerId * docsPerWorker);
+        const auto end = docs.begin() + std::min(docs.size(), (workerId + 1) * docsPerWorker);
+        workers.emplace_back([&, workerId, begin, end] {
+            Client::initThread("insertWorker" + std::to_string(workerId));
+            AuthorizationSession::get(cc())->grantInternalAuthorization();
+            auto workerOpCtx = Client::getCurrent()->makeOperationContext();
+            try {
+                insertDocumentRange(
+                    workerOpCtx.get(), wholeOp, begin, end, &sliceResults[workerId]);
+                sliceOpTimes[workerId] = repl::ReplClientInfo::forClient(cc()).getLastOp();
+            } catch (const DBException& ex) {
+                stdx::lock_guard<stdx::mutex> lk(statusMutex);
+                if (workerStatus.isOK()) {
+                    workerStatus = ex.toStatus();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // An exception from a worker failed its whole slice; surface it as a failure of the whole
+    // batch, as the serial path does for interruptions.
+    uassertStatusOK(workerStatus);
+    opCtx->checkForInterrupt();
+
+    WriteResult out;
+    out.results.reserve(docs.size());
+    repl::OpTime latestOpTime;
+    long long ninserted = 0;
+    for (size_t workerId = 0; workerId < numWorkers; workerId++) {
+        if (latestOpTime < sliceOpTimes[workerId]) {
+            latestOpTime = sliceOpTimes[workerId];
+        }
+        if (sliceResults[workerId].staleConfigException) {
+            // Should be unreachable since statements with a shard version aren't parallelized,
+            // but if it ever happens the caller must rethrow the SCE rather than use the results.
+            out.staleConfigException = std::move(sliceResults[workerId].staleConfigException);
+            break;
+        }
+        for (auto&& result : sliceResults[workerId].results) {
+            if (result.isOK()) {
+                ninserted++;
+            }
+            out.results.push_back(std::move(result));
+        }
+    }
+
+    // The writes happened on the workers' Clients; advance this Client's last optime so that the
+    // caller's write concern wait covers them.
+    auto& replClientInfo = repl::ReplClientInfo::forClient(opCtx->getClient());
+    if (replClientInfo.getLastOp() < latestOpTime) {
+        replClientInfo.setLastOp(latestOpTime);
+    }
+
+    CurOp::get(opCtx)->debug().ninserted = ninserted;
+    return out;
+}
+
 }  // namespace
 
 WriteResult performInserts(OperationContext* opCtx, const InsertOp& wholeOp) {
@@ -435,50 +611,15 @@ WriteResult performInserts(OperationContext* opCtx, const InsertOp& wholeOp) {
         return performCreateIndexes(opCtx, wholeOp);
     }
 
-    DisableDocumentValidationIfTrue docValidationDisabler(
-        opCtx, wholeOp.getWriteCommandBase().getBypassDocumentValidation());
-    LastOpFixer lastOpFixer(opCtx, wholeOp.getNamespace());
+    const size_t numWorkers = numWorkersForInserts(opCtx, wholeOp);
+    if (numWorkers > 1) {
+        return performParallelInserts(opCtx, wholeOp, numWorkers);
+    }
 
     WriteResult out;
     out.results.reserve(wholeOp.getDocuments().size());
-
-    size_t bytesInBatch = 0;
-    std::vector<BSONObj> batch;
-    const size_t maxBatchSize = internalInsertMaxBatchSize.load();
-    batch.reserve(std::min(wholeOp.getDocuments().size(), maxBatchSize));
-
-    for (auto&& doc : wholeOp.getDocuments()) {
-        const bool isLastDoc = (&doc == &wholeOp.getDocuments().back());
-        auto fixedDoc = fixDocumentForInsert(opCtx->getServiceContext(), doc);
-        if (!fixedDoc.isOK()) {
-            // Handled after we insert anything in the batch to be sure we report errors in the
-            // correct order. In an ordered insert, if one of the docs ahead of us fails, we should
-            // behave as-if we never got to this document.
-        } else {
-            batch.push_back(fixedDoc.getValue().isEmpty() ? doc : std::move(fixedDoc.getValue()));
-            bytesInBatch += batch.back().objsize();
-            if (!isLastDoc && batch.size() < maxBatchSize && bytesInBatch < insertVectorMaxBytes)
-                continue;  // Add more to batch before inserting.
-        }
-
-        bool canContinue = insertBatchAndHandleErrors(opCtx, wholeOp, batch, &lastOpFixer, &out);
-        batch.clear();  // We won't need the current batch any more.
-        bytesInBatch = 0;
-
-        if (canContinue && !fixedDoc.isOK()) {
-            globalOpCounters.gotInsert();
-            canContinue = handleError(
-                opCtx,
-                UserException(fixedDoc.getStatus().code(), fixedDoc.getStatus().reason()),
-                wholeOp.getNamespace(),
-                wholeOp.getWriteCommandBase(),
-                &out);
-        }
-
-        if (!canContinue)
-            break;
-    }
-
+    insertDocumentRange(
+        opCtx, wholeOp, wholeOp.getDocuments().begin(), wholeOp.getDocuments().end(), &out);
     return out;
 }
 
@@ -547,7 +688,7 @@ static SingleWriteResult performSingleUpdateOp(OperationContext* opCtx,
     PlanSummaryStats summary;
     Explain::getSummaryStats(*exec, &summary);
     if (collection->getCollection()) {
-        collection->getCollection()->infoCache()->notifyOfQuery(opCtx, summary.indexesUsed);
+        collection->getCollection()->infoCache()->notifyOfQuery(opCtx, summary);
     }
 
     if (curOp.shouldDBProfile()) {
@@ -666,7 +807,7 @@ static SingleWriteResult performSingleDeleteOp(OperationContext* opCtx,
     PlanSummaryStats summary;
     Explain::getSummaryStats(*exec, &summary);
     if (collection.getCollection()) {
-        collection.getCollection()->infoCache()->notifyOfQuery(opCtx, summary.indexesUsed);
+        collection.getCollection()->infoCache()->notifyOfQuery(opCtx, summary);
     }
     curOp.debug().setPlanSummaryMetrics(summary);
 
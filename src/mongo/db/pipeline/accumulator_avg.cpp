@@ -82,6 +82,9 @@ void AccumulatorAvg::processInternal(const Value& input, bool merging) {
             _nonDecimalTotal.addLong(input.getLong());
             break;
         case NumberInt:
+            // An int is exactly representable as a double, so no precision is lost here.
+            _nonDecimalTotal.addDouble(input.getInt());
+            break;
         case NumberDouble:
             _nonDecimalTotal.addDouble(input.getDouble());
             break;
@@ -66,18 +66,25 @@ void AccumulatorSum::processInternal(const Value& input, bool merging) {
         return;
     }
 
-    // Upgrade to the widest type required to hold the result.
-    totalType = Value::getWidestNumeric(totalType, input.getType());
-    switch (input.getType()) {
+    // Upgrade to the widest type required to hold the result. Every numeric type is its own
+    // widest type, so when the input type matches the running total's type (the common case for
+    // a homogeneous stream of metrics), the lattice walk can be skipped entirely.
+    const BSONType inputType = input.getType();
+    if (inputType != totalType) {
+        totalType = Value::getWidestNumeric(totalType, inputType);
+    }
+    switch (inputType) {
         case NumberInt:
+            nonDecimalTotal.addLong(input.getInt());
+            break;
         case NumberLong:
-            nonDecimalTotal.addLong(input.coerceToLong());
+            nonDecimalTotal.addLong(input.getLong());
             break;
         case NumberDouble:
             nonDecimalTotal.addDouble(input.getDouble());
             break;
         case NumberDecimal:
-            decimalTotal = decimalTotal.add(input.coerceToDecimal());
+            decimalTotal = decimalTotal.add(input.getDecimal());
             break;
         default:
             MONGO_UNREACHABLE;
@@ -46,10 +46,17 @@ using std::vector;
 const DocumentStorage DocumentStorage::kEmptyDoc;
 
 Position DocumentStorage::findField(StringData requested) const {
+    // The hash is only consulted once the field count reaches HASH_TAB_MIN; don't pay for it
+    // while a linear scan will be used anyway.
+    return findFieldWithHash(requested,
+                             _numFields >= HASH_TAB_MIN ? hashKey(requested) : 0);
+}
+
+Position DocumentStorage::findFieldWithHash(StringData requested, unsigned hash) const {
     int reqSize = requested.size();  // get size calculation out of the way if needed
 
     if (_numFields >= HASH_TAB_MIN) {  // hash lookup
-        const unsigned bucket = bucketForKey(requested);
+        const unsigned bucket = hash & _hashTabMask;
 
         Position pos = _hashTab[bucket];
         while (pos.found()) {
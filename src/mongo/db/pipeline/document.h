@@ -115,6 +115,19 @@ public:
         return storage().getField(key);
     }
 
+    /**
+     * As getField(StringData), but 'hash' must be hashFieldName(key). Callers that look up the
+     * same field in a long stream of documents can hash the name once and reuse it.
+     */
+    const Value getField(StringData key, unsigned hash) const {
+        return storage().getFieldWithHash(key, hash);
+    }
+
+    /// Returns the hash of 'fieldName' expected by getField(StringData, unsigned).
+    static unsigned hashFieldName(StringData fieldName) {
+        return DocumentStorage::hashKey(fieldName);
+    }
+
     /// Look up a field by Position. See positionOf and getNestedField.
     const Value operator[](Position pos) const {
         return getField(pos);
@@ -220,6 +220,19 @@ public:
     /// Returns the position of the named field (may be missing) or Position()
     Position findField(StringData name) const;
 
+    /**
+     * As findField(), but 'hash' must be hashKey(name). Lets callers that look up the same field
+     * across a long stream of documents hash the name once instead of once per document.
+     */
+    Position findFieldWithHash(StringData name, unsigned hash) const;
+
+    static unsigned hashKey(StringData name) {
+        // TODO consider FNV-1a once we have a better benchmark corpus
+        unsigned out;
+        MurmurHash3_x86_32(name.rawData(), name.size(), 0, &out);
+        return out;
+    }
+
     // Document uses these
     const ValueElement& getField(Position pos) const {
         verify(pos.found());
@@ -231,6 +244,13 @@ public:
             return Value();
         return getField(pos).val;
     }
+    /// As getField(StringData), but 'hash' must be hashKey(name).
+    Value getFieldWithHash(StringData name, unsigned hash) const {
+        Position pos = findFieldWithHash(name, hash);
+        if (!pos.found())
+            return Value();
+        return getField(pos).val;
+    }
 
     // MutableDocument uses these
     ValueElement& getField(Position pos) {
@@ -334,13 +354,6 @@ private:
         memset(_hashTab, -1, hashTabBytes());
     }
 
-    static unsigned hashKey(StringData name) {
-        // TODO consider FNV-1a once we have a better benchmark corpus
-        unsigned out;
-        MurmurHash3_x86_32(name.rawData(), name.size(), 0, &out);
-        return out;
-    }
-
     unsigned bucketForKey(StringData name) const {
         return hashKey(name) & _hashTabMask;
     }
@@ -30,11 +30,13 @@
 
 #include "mongo/db/pipeline/document_source_change_notification.h"
 
+#include "mongo/bson/ordering.h"
 #include "mongo/db/pipeline/document_source_limit.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
@@ -115,8 +117,98 @@ void checkValueType(Value v, StringData filedName, BSONType expectedType) {
                           << typeName(v.getType()),
             (v.getType() == expectedType));
 }
+
+/**
+ * Maps an "operationType" value in the transformed output back to the oplog "op" code(s) that
+ * can produce it, or boost::none if the value is not a recognized operation type. "update" and
+ * "replace" both map to "u"; the distinction is only visible after transformation, so the
+ * rewritten filter passes both and relies on the original $match to separate them.
+ */
+boost::optional<StringData> mapOperationTypeToOpCode(StringData operationType) {
+    if (operationType == "insert")
+        return "i"_sd;
+    if (operationType == "delete")
+        return "d"_sd;
+    if (operationType == "update" || operationType == "replace")
+        return "u"_sd;
+    if (operationType == "invalidate")
+        return "c"_sd;
+    return boost::none;
+}
+
+/**
+ * Attempts to rewrite one conjunct of a $match predicate on the transformed output into a
+ * filter over the raw oplog entry. Returns boost::none if this conjunct has no rewrite.
+ */
+boost::optional<BSONObj> rewritePredicateOnOplogEntry(const BSONElement& elem) {
+    const StringData fieldName = elem.fieldNameStringData();
+
+    if (fieldName == "operationType") {
+        if (elem.type() == BSONType::String) {
+            auto opCode = mapOperationTypeToOpCode(elem.valueStringData());
+            if (!opCode) {
+                return boost::none;
+            }
+            return BSON(kOpTypeField << *opCode);
+        }
+        if (elem.type() == BSONType::Object &&
+            elem.Obj().firstElementFieldName() == StringData("$in")) {
+            const BSONElement inList = elem.Obj().firstElement();
+            if (elem.Obj().nFields() != 1 || inList.type() != BSONType::Array) {
+                return boost::none;
+            }
+            BSONArrayBuilder opCodes;
+            for (auto&& type : inList.Array()) {
+                if (type.type() != BSONType::String) {
+                    return boost::none;
+                }
+                auto opCode = mapOperationTypeToOpCode(type.valueStringData());
+                if (!opCode) {
+                    return boost::none;
+                }
+                opCodes.append(*opCode);
+            }
+            return BSON(kOpTypeField << BSON("$in" << opCodes.arr()));
+        }
+        return boost::none;
+    }
+
+    if (fieldName == "documentKey._id") {
+        // Only rewrite equality comparisons; an object value whose first field starts with '$'
+        // is an operator expression, which we leave alone.
+        if (elem.type() == BSONType::Object && elem.Obj().firstElementFieldName()[0] == '$') {
+            return boost::none;
+        }
+        // The document id lives in "o._id" for inserts, deletes and replacements, and in
+        // "o2._id" for non-replacement updates.
+        BSONObjBuilder onO;
+        onO.appendAs(elem, "o._id");
+        BSONObjBuilder onO2;
+        onO2.appendAs(elem, "o2._id");
+        return BSON("$or" << BSON_ARRAY(onO.obj() << onO2.obj()));
+    }
+
+    return boost::none;
+}
 }  // namespace
 
+boost::optional<BSONObj> DocumentSourceChangeNotification::Transformation::rewriteMatchForInput(
+    const BSONObj& predicate) const {
+    // The top level of a $match predicate is an implicit $and, so each conjunct can be
+    // rewritten independently and conjuncts without a rewrite simply dropped: the resulting
+    // filter matches a superset of what the original predicate matches after transformation.
+    BSONArrayBuilder rewrittenConjuncts;
+    for (auto&& elem : predicate) {
+        if (auto rewritten = rewritePredicateOnOplogEntry(elem)) {
+            rewrittenConjuncts.append(*rewritten);
+        }
+    }
+    if (rewrittenConjuncts.arrSize() == 0) {
+        return boost::none;
+    }
+    return BSON("$and" << rewrittenConjuncts.arr());
+}
+
 Document DocumentSourceChangeNotification::Transformation::applyTransformation(
     const Document& input) {
 
@@ -171,10 +263,16 @@ Document DocumentSourceChangeNotification::Transformation::applyTransformation(
         documentId = Value();
     }
 
-    // Construct the result document. If document id is missing, it will not appear in the output.
-    doc.addField(
-        kIdField,
-        Value(Document{{kTimestmapField, ts}, {kNamespaceField, ns}, {kIdField, documentId}}));
+    // Construct the result document, keyed by a compact resume token: an order-preserving
+    // KeyString encoding of (ts, ns, documentId). Clients treat the token as opaque; encoding
+    // it as binary rather than a subdocument keeps per-event overhead small. If document id is
+    // missing it is simply left out of the token.
+    BSONObj tokenContents =
+        Document{{kTimestmapField, ts}, {kNamespaceField, ns}, {kIdField, documentId}}.toBson();
+    KeyString encodedToken(KeyString::kLatestVersion, tokenContents, Ordering::make(BSONObj()));
+    doc.addField(kIdField,
+                 Value(BSONBinData(
+                     encodedToken.getBuffer(), encodedToken.getSize(), BinDataType::BinDataGeneral)));
     doc.addField("operationType", Value(operationType));
 
     // "invalidate" entry has fewer fields.
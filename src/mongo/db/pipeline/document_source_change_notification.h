@@ -67,6 +67,14 @@ public:
             boost::optional<ExplainOptions::Verbosity> explain) const final;
         DocumentSource::GetDepsReturn addDependencies(DepsTracker* deps) const final;
         DocumentSource::GetModPathsReturn getModifiedPaths() const final;
+
+        /**
+         * Rewrites predicates on "operationType" and "documentKey._id" into predicates on the
+         * corresponding oplog entry fields, so a $match following this stage can reject entries
+         * before they are transformed. Conjuncts that cannot be rewritten are dropped, which is
+         * safe because the original $match still runs on the transformed output.
+         */
+        boost::optional<BSONObj> rewriteMatchForInput(const BSONObj& predicate) const final;
     };
 
     /**
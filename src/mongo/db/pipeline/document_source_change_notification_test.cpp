@@ -44,6 +44,7 @@
 #include "mongo/db/pipeline/value.h"
 #include "mongo/db/pipeline/value_comparator.h"
 #include "mongo/db/repl/oplog_entry.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -92,6 +93,17 @@ public:
     OplogEntry createCommand(const BSONObj& oField) {
         return OplogEntry(optime, 1, OpTypeEnum::kCommand, nss.getCommandNS(), oField);
     }
+
+    /**
+     * Builds the binary resume token the transformation is expected to produce for an event
+     * with the given timestamp, namespace and document id.
+     */
+    static Value makeResumeToken(Timestamp ts, StringData ns, Value documentId = Value()) {
+        BSONObj tokenContents = D{{"ts", ts}, {"ns", ns}, {"_id", documentId}}.toBson();
+        KeyString encodedToken(KeyString::kLatestVersion, tokenContents, Ordering::make(BSONObj()));
+        return Value(BSONBinData(
+            encodedToken.getBuffer(), encodedToken.getSize(), BinDataType::BinDataGeneral));
+    }
 };
 
 TEST_F(ChangeNotificationStageTest, StagesGeneratedCorrectly) {
@@ -111,7 +123,7 @@ TEST_F(ChangeNotificationStageTest, TransformInsert) {
     OplogEntry insert(optime, 1, OpTypeEnum::kInsert, nss, BSON("_id" << 1 << "x" << 1));
     // Insert
     Document expectedInsert{
-        {"_id", D{{"ts", ts}, {"ns", nss.ns()}, {"_id", 1}}},
+        {"_id", makeResumeToken(ts, nss.ns(), V(1))},
         {"operationType", "insert"_sd},
         {"ns", D{{"db", nss.db()}, {"coll", nss.coll()}}},
         {"documentKey", D{{"_id", 1}}},
@@ -125,7 +137,7 @@ TEST_F(ChangeNotificationStageTest, TransformUpdateFields) {
         optime, 1, OpTypeEnum::kUpdate, nss, BSON("$set" << BSON("y" << 1)), BSON("_id" << 1));
     // Update fields
     Document expectedUpdateField{
-        {"_id", D{{"ts", ts}, {"ns", nss.ns()}, {"_id", 1}}},
+        {"_id", makeResumeToken(ts, nss.ns(), V(1))},
         {"operationType", "update"_sd},
         {"ns", D{{"db", nss.db()}, {"coll", nss.coll()}}},
         {"documentKey", D{{"_id", 1}}},
@@ -140,7 +152,7 @@ TEST_F(ChangeNotificationStageTest, TransformRemoveFields) {
         optime, 1, OpTypeEnum::kUpdate, nss, BSON("$unset" << BSON("y" << 1)), BSON("_id" << 1));
     // Remove fields
     Document expectedRemoveField{
-        {"_id", D{{"ts", ts}, {"ns", nss.ns()}, {"_id", 1}}},
+        {"_id", makeResumeToken(ts, nss.ns(), V(1))},
         {"operationType", "update"_sd},
         {"ns", D{{"db", nss.db()}, {"coll", nss.coll()}}},
         {"documentKey", D{{"_id", 1}}},
@@ -155,7 +167,7 @@ TEST_F(ChangeNotificationStageTest, TransformReplace) {
         optime, 1, OpTypeEnum::kUpdate, nss, BSON("_id" << 1 << "y" << 1), BSON("_id" << 1));
     // Replace
     Document expectedReplace{
-        {"_id", D{{"ts", ts}, {"ns", nss.ns()}, {"_id", 1}}},
+        {"_id", makeResumeToken(ts, nss.ns(), V(1))},
         {"operationType", "replace"_sd},
         {"ns", D{{"db", nss.db()}, {"coll", nss.coll()}}},
         {"documentKey", D{{"_id", 1}}},
@@ -168,7 +180,7 @@ TEST_F(ChangeNotificationStageTest, TransformDelete) {
     OplogEntry deleteEntry(optime, 1, OpTypeEnum::kDelete, nss, BSON("_id" << 1));
     // Delete
     Document expectedDelete{
-        {"_id", D{{"ts", ts}, {"ns", nss.ns()}, {"_id", 1}}},
+        {"_id", makeResumeToken(ts, nss.ns(), V(1))},
         {"operationType", "delete"_sd},
         {"ns", D{{"db", nss.db()}, {"coll", nss.coll()}}},
         {"documentKey", D{{"_id", 1}}},
@@ -186,7 +198,7 @@ TEST_F(ChangeNotificationStageTest, TransformInvalidate) {
 
     // Invalidate entry includes $cmd namespace in _id and doesn't have a document id.
     Document expectedInvalidate{
-        {"_id", D{{"ts", ts}, {"ns", nss.getCommandNS().ns()}}}, {"operationType", "invalidate"_sd},
+        {"_id", makeResumeToken(ts, nss.getCommandNS().ns())}, {"operationType", "invalidate"_sd},
     };
     for (auto& entry : {dropColl, dropDB, rename}) {
         checkTransformation(entry, expectedInvalidate);
@@ -202,7 +214,7 @@ TEST_F(ChangeNotificationStageTest, TransformInvalidateRenameDropTarget) {
                       otherColl.getCommandNS(),
                       BSON("renameCollection" << otherColl.ns() << "to" << nss.ns()));
     Document expectedInvalidate{
-        {"_id", D{{"ts", ts}, {"ns", otherColl.getCommandNS().ns()}}},
+        {"_id", makeResumeToken(ts, otherColl.getCommandNS().ns())},
         {"operationType", "invalidate"_sd},
     };
     checkTransformation(rename, expectedInvalidate);
@@ -222,6 +234,40 @@ TEST_F(ChangeNotificationStageTest, MatchFiltersNoOp) {
     checkTransformation(noOp, boost::none);
 }
 
+TEST_F(ChangeNotificationStageTest, RewritesOperationTypeMatchOntoOplogOpField) {
+    DocumentSourceChangeNotification::Transformation transform;
+    auto rewritten = transform.rewriteMatchForInput(BSON("operationType"
+                                                         << "insert"));
+    ASSERT(rewritten);
+    ASSERT_BSONOBJ_EQ(*rewritten, fromjson("{$and: [{op: 'i'}]}"));
+
+    rewritten =
+        transform.rewriteMatchForInput(fromjson("{operationType: {$in: ['insert', 'delete']}}"));
+    ASSERT(rewritten);
+    ASSERT_BSONOBJ_EQ(*rewritten, fromjson("{$and: [{op: {$in: ['i', 'd']}}]}"));
+}
+
+TEST_F(ChangeNotificationStageTest, RewritesDocumentKeyMatchOntoBothOplogIdFields) {
+    DocumentSourceChangeNotification::Transformation transform;
+    auto rewritten = transform.rewriteMatchForInput(BSON("documentKey._id" << 5));
+    ASSERT(rewritten);
+    ASSERT_BSONOBJ_EQ(*rewritten, fromjson("{$and: [{$or: [{'o._id': 5}, {'o2._id': 5}]}]}"));
+}
+
+TEST_F(ChangeNotificationStageTest, DropsConjunctsWithoutARewrite) {
+    DocumentSourceChangeNotification::Transformation transform;
+
+    // An unrewritable conjunct is dropped but the rest of the filter survives.
+    auto rewritten =
+        transform.rewriteMatchForInput(fromjson("{operationType: 'delete', 'newDocument.x': 5}"));
+    ASSERT(rewritten);
+    ASSERT_BSONOBJ_EQ(*rewritten, fromjson("{$and: [{op: 'd'}]}"));
+
+    // If nothing is rewritable there is no pushdown at all.
+    ASSERT_FALSE(transform.rewriteMatchForInput(fromjson("{'newDocument.x': 5}")));
+    ASSERT_FALSE(transform.rewriteMatchForInput(fromjson("{operationType: {$ne: 'insert'}}")));
+}
+
 TEST_F(ChangeNotificationStageTest, MatchFiltersCreateIndex) {
     auto indexSpec = D{{"v", 2}, {"key", D{{"a", 1}}}, {"name", "a_1"_sd}, {"ns", nss.ns()}};
     NamespaceString indexNs(nss.getSystemIndexesCollection());
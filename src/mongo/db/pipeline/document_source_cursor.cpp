@@ -264,7 +264,7 @@ DocumentSourceCursor::DocumentSourceCursor(
     recordPlanSummaryStats();
 
     if (collection) {
-        collection->infoCache()->notifyOfQuery(pExpCtx->opCtx, _planSummaryStats.indexesUsed);
+        collection->infoCache()->notifyOfQuery(pExpCtx->opCtx, _planSummaryStats);
     }
 }
 
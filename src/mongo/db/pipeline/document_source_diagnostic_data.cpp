@@ -0,0 +1,183 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kFTDC
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_diagnostic_data.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/filesystem.hpp>
+
+#include "mongo/db/ftdc/constants.h"
+#include "mongo/db/ftdc/controller.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/service_context.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/util/log.h"
+
+namespace mongo {
+
+namespace {
+const StringData kTypeFieldName = "type"_sd;
+const StringData kTimestampFieldName = "ts"_sd;
+const StringData kDocFieldName = "doc"_sd;
+
+const StringData kMetadataTypeName = "metadata"_sd;
+const StringData kMetricsTypeName = "metrics"_sd;
+}  // namespace
+
+using boost::intrusive_ptr;
+
+REGISTER_DOCUMENT_SOURCE(diagnosticData,
+                         LiteParsedDocumentSourceDefault::parse,
+                         DocumentSourceDiagnosticData::createFromBson);
+
+const char* DocumentSourceDiagnosticData::getSourceName() const {
+    return "$diagnosticData";
+}
+
+DocumentSource::InitialSourceType DocumentSourceDiagnosticData::getInitialSourceType() const {
+    return InitialSourceType::kCollectionlessInitialSource;
+}
+
+DocumentSource::GetNextResult DocumentSourceDiagnosticData::getNext() {
+    pExpCtx->checkForInterrupt();
+
+    if (!_initialized) {
+        auto* controller = FTDCController::get(pExpCtx->opCtx->getServiceContext());
+        uassert(40641,
+                "$diagnosticData requires diagnostic data capture to be enabled on this node",
+                controller);
+
+        // Stream the archive files in name order, which is chronological order, followed by the
+        // interim file holding the most recent samples.
+        const auto& dir = controller->getDirectory();
+        if (boost::filesystem::exists(dir)) {
+            boost::filesystem::directory_iterator di(dir);
+            for (; di != boost::filesystem::directory_iterator(); di++) {
+                std::string filename = di->path().filename().generic_string();
+                if (filename.compare(0, strlen(kFTDCArchiveFile), kFTDCArchiveFile) == 0 &&
+                    filename != kFTDCInterimFile) {
+                    _files.emplace_back(di->path());
+                }
+            }
+            std::sort(_files.begin(), _files.end());
+
+            auto interim = dir / kFTDCInterimFile;
+            if (boost::filesystem::exists(interim)) {
+                _files.emplace_back(std::move(interim));
+            }
+        }
+
+        _initialized = true;
+    }
+
+    while (true) {
+        if (!_reader) {
+            if (_fileIndex >= _files.size()) {
+                return GetNextResult::makeEOF();
+            }
+
+            auto reader = stdx::make_unique<FTDCFileReader>();
+            auto status = reader->open(_files[_fileIndex++]);
+            if (!status.isOK()) {
+                warning() << "$diagnosticData skipping unreadable diagnostic data file "
+                          << _files[_fileIndex - 1].generic_string() << ": " << status;
+                continue;
+            }
+
+            _reader = std::move(reader);
+        }
+
+        auto swHasNext = _reader->hasNext();
+        if (!swHasNext.isOK()) {
+            // The newest file is appended to while we read it, so a torn final chunk is
+            // expected there; treat a decode failure as the end of the file.
+            LOG(1) << "$diagnosticData stopping at partial chunk in "
+                   << _files[_fileIndex - 1].generic_string() << ": " << swHasNext.getStatus();
+            _reader.reset();
+            continue;
+        }
+
+        if (!swHasNext.getValue()) {
+            _reader.reset();
+            continue;
+        }
+
+        auto entry = _reader->next();
+
+        MutableDocument doc;
+        doc.addField(kTypeFieldName,
+                     Value(std::get<0>(entry) == FTDCBSONUtil::FTDCType::kMetadata
+                               ? kMetadataTypeName
+                               : kMetricsTypeName));
+        doc.addField(kTimestampFieldName, Value(std::get<2>(entry)));
+        // Metadata documents returned by the reader are unowned, so copy before the reader
+        // advances past them.
+        doc.addField(kDocFieldName, Value(std::get<1>(entry).getOwned()));
+
+        return doc.freeze();
+    }
+}
+
+intrusive_ptr<DocumentSource> DocumentSourceDiagnosticData::createFromBson(
+    BSONElement spec, const intrusive_ptr<ExpressionContext>& pExpCtx) {
+    uassert(ErrorCodes::FailedToParse,
+            str::stream() << "$diagnosticData options must be specified in an object, but found: "
+                          << typeName(spec.type()),
+            spec.type() == BSONType::Object);
+
+    uassert(40642,
+            "The $diagnosticData stage does not accept any options",
+            spec.embeddedObject().isEmpty());
+
+    const NamespaceString& nss = pExpCtx->ns;
+
+    uassert(ErrorCodes::InvalidNamespace,
+            "$diagnosticData must be run against the 'admin' database with {aggregate: 1}",
+            nss.db() == NamespaceString::kAdminDb && nss.isCollectionlessAggregateNS());
+
+    return intrusive_ptr<DocumentSourceDiagnosticData>(new DocumentSourceDiagnosticData(pExpCtx));
+}
+
+intrusive_ptr<DocumentSourceDiagnosticData> DocumentSourceDiagnosticData::create(
+    const intrusive_ptr<ExpressionContext>& pExpCtx) {
+    return intrusive_ptr<DocumentSourceDiagnosticData>(new DocumentSourceDiagnosticData(pExpCtx));
+}
+
+Value DocumentSourceDiagnosticData::serialize(
+    boost::optional<ExplainOptions::Verbosity> explain) const {
+    return Value(Document{{getSourceName(), Document{}}});
+}
+
+}  // namespace mongo
@@ -0,0 +1,96 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/document.h"
+#include "mongo/db/pipeline/document_source_diagnostic_data.h"
+#include "mongo/db/pipeline/document_value_test_util.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Subclass AggregationContextFixture to set the ExpressionContext's namespace to 'admin' with
+ * {aggregate: 1} by default, so that parsing tests other than those which validate the namespace
+ * do not need to explicitly set it.
+ */
+class DocumentSourceDiagnosticDataTest : public AggregationContextFixture {
+public:
+    DocumentSourceDiagnosticDataTest()
+        : AggregationContextFixture(NamespaceString::makeCollectionlessAggregateNSS("admin")) {}
+};
+
+TEST_F(DocumentSourceDiagnosticDataTest, ShouldFailToParseIfSpecIsNotObject) {
+    const auto specObj = fromjson("{$diagnosticData:1}");
+    ASSERT_THROWS_CODE(
+        DocumentSourceDiagnosticData::createFromBson(specObj.firstElement(), getExpCtx()),
+        UserException,
+        ErrorCodes::FailedToParse);
+}
+
+TEST_F(DocumentSourceDiagnosticDataTest, ShouldFailToParseIfSpecHasOptions) {
+    const auto specObj = fromjson("{$diagnosticData:{window:1}}");
+    ASSERT_THROWS_CODE(
+        DocumentSourceDiagnosticData::createFromBson(specObj.firstElement(), getExpCtx()),
+        UserException,
+        40642);
+}
+
+TEST_F(DocumentSourceDiagnosticDataTest, ShouldFailToParseIfNotRunOnAdmin) {
+    const auto specObj = fromjson("{$diagnosticData:{}}");
+    getExpCtx()->ns = NamespaceString::makeCollectionlessAggregateNSS("foo");
+    ASSERT_THROWS_CODE(
+        DocumentSourceDiagnosticData::createFromBson(specObj.firstElement(), getExpCtx()),
+        UserException,
+        ErrorCodes::InvalidNamespace);
+}
+
+TEST_F(DocumentSourceDiagnosticDataTest, ShouldFailToParseIfNotRunWithAggregateOne) {
+    const auto specObj = fromjson("{$diagnosticData:{}}");
+    getExpCtx()->ns = NamespaceString("admin.foo");
+    ASSERT_THROWS_CODE(
+        DocumentSourceDiagnosticData::createFromBson(specObj.firstElement(), getExpCtx()),
+        UserException,
+        ErrorCodes::InvalidNamespace);
+}
+
+TEST_F(DocumentSourceDiagnosticDataTest, ShouldSerializeWithNoOptions) {
+    const auto specObj = fromjson("{$diagnosticData:{}}");
+    const auto source =
+        DocumentSourceDiagnosticData::createFromBson(specObj.firstElement(), getExpCtx());
+    const auto expected = Value(Document{{"$diagnosticData", Document{}}});
+    ASSERT_VALUE_EQ(source->serialize(), expected);
+}
+
+}  // namespace
+}  // namespace mongo
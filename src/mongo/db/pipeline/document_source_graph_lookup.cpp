@@ -41,6 +41,7 @@
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/value.h"
 #include "mongo/db/query/query_planner_common.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/stdx/memory.h"
 
 namespace mongo {
@@ -100,19 +101,19 @@ DocumentSource::GetNextResult DocumentSourceGraphLookUp::getNext() {
     performSearch();
 
     std::vector<Value> results;
-    while (!_visited.empty()) {
-        // Remove elements one at a time to avoid consuming more memory.
-        auto it = _visited.begin();
-        results.push_back(Value(it->second));
-        _visited.erase(it);
+    results.reserve(_visitedDocuments.size());
+    for (auto&& doc : _visitedDocuments) {
+        results.push_back(Value(std::move(doc)));
     }
+    _visitedDocuments.clear();
+    _visitedKeys.clear();
 
     MutableDocument output(*_input);
     output.setNestedField(_as, Value(std::move(results)));
 
     _visitedUsageBytes = 0;
 
-    invariant(_visited.empty());
+    invariant(_visitedDocuments.empty());
 
     return output.freeze();
 }
@@ -123,7 +124,7 @@ DocumentSource::GetNextResult DocumentSourceGraphLookUp::getNextUnwound() {
     // If the unwind is not preserving empty arrays, we might have to process multiple inputs before
     // we get one that will produce an output.
     while (true) {
-        if (_visited.empty()) {
+        if (_visitedDocuments.empty()) {
             // No results are left for the current input, so we should move on to the next one and
             // perform a new search.
 
@@ -134,12 +135,14 @@ DocumentSource::GetNextResult DocumentSourceGraphLookUp::getNextUnwound() {
 
             _input = input.releaseDocument();
             performSearch();
+            // The keys are only needed for de-duplication during the search itself.
+            _visitedKeys.clear();
             _visitedUsageBytes = 0;
             _outputIndex = 0;
         }
         MutableDocument unwound(*_input);
 
-        if (_visited.empty()) {
+        if (_visitedDocuments.empty()) {
             if ((*_unwind)->preserveNullAndEmptyArrays()) {
                 // Since "preserveNullAndEmptyArrays" was specified, output a document even though
                 // we had no result.
@@ -153,13 +156,13 @@ DocumentSource::GetNextResult DocumentSourceGraphLookUp::getNextUnwound() {
                 continue;
             }
         } else {
-            auto it = _visited.begin();
-            unwound.setNestedField(_as, Value(it->second));
+            // Remove elements one at a time to avoid consuming more memory.
+            unwound.setNestedField(_as, Value(std::move(_visitedDocuments.back())));
+            _visitedDocuments.pop_back();
             if (indexPath) {
                 unwound.setNestedField(*indexPath, Value(_outputIndex));
                 ++_outputIndex;
             }
-            _visited.erase(it);
         }
 
         return unwound.freeze();
@@ -169,7 +172,8 @@ DocumentSource::GetNextResult DocumentSourceGraphLookUp::getNextUnwound() {
 void DocumentSourceGraphLookUp::doDispose() {
     _cache.clear();
     _frontier.clear();
-    _visited.clear();
+    _visitedKeys.clear();
+    _visitedDocuments.clear();
 }
 
 void DocumentSourceGraphLookUp::doBreadthFirstSearch() {
@@ -228,7 +232,16 @@ void DocumentSourceGraphLookUp::doBreadthFirstSearch() {
 bool DocumentSourceGraphLookUp::addToVisitedAndFrontier(Document result, long long depth) {
     auto id = result.getField("_id");
 
-    if (_visited.find(id) != _visited.end()) {
+    // De-duplicate on a compact KeyString encoding of the id rather than the Value itself;
+    // KeyString buffer equality matches simple-collation Value equality (numeric types that
+    // compare equal encode identically), and the encoded key is far smaller than a copy of an
+    // arbitrary id Value.
+    BSONObjBuilder idBuilder;
+    id.addToBsonObj(&idBuilder, StringData());
+    KeyString encodedId(KeyString::kLatestVersion, idBuilder.obj(), Ordering::make(BSONObj()));
+    std::string idKey(encodedId.getBuffer(), encodedId.getSize());
+
+    if (_visitedKeys.find(idKey) != _visitedKeys.end()) {
         // We've already seen this object, don't repeat any work.
         return false;
     }
@@ -250,13 +263,14 @@ bool DocumentSourceGraphLookUp::addToVisitedAndFrontier(Document result, long lo
             _frontierUsageBytes += nextFrontierValue.getApproximateSize();
         });
 
-    // Add the object to our '_visited' list and update the size of '_visited' appropriately.
-    _visitedUsageBytes += id.getApproximateSize();
+    // Add the object to our visited set and update its tracked size appropriately.
+    _visitedUsageBytes += idKey.size();
     _visitedUsageBytes += result.getApproximateSize();
 
-    _visited[id] = std::move(result);
+    _visitedKeys.insert(std::move(idKey));
+    _visitedDocuments.push_back(std::move(result));
 
-    // We inserted into _visited, so return true.
+    // We inserted into the visited set, so return true.
     return true;
 }
 
@@ -460,7 +474,6 @@ DocumentSourceGraphLookUp::DocumentSourceGraphLookUp(
       _depthField(depthField),
       _maxDepth(maxDepth),
       _frontier(pExpCtx->getValueComparator().makeUnorderedValueSet()),
-      _visited(ValueComparator::kInstance.makeUnorderedValueMap<Document>()),
       _cache(pExpCtx->getValueComparator()),
       _unwind(unwindSrc) {
     const auto& resolvedNamespace = pExpCtx->getResolvedNamespace(_from);
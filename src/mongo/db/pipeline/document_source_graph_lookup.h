@@ -33,6 +33,7 @@
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/lookup_set_cache.h"
 #include "mongo/db/pipeline/value_comparator.h"
+#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
@@ -152,16 +153,16 @@ private:
     void addToCache(const Document& result, const ValueUnorderedSet& queried);
 
     /**
-     * Assert that '_visited' and '_frontier' have not exceeded the maximum meory usage, and then
-     * evict from '_cache' until this source is using less than '_maxMemoryUsageBytes'.
+     * Assert that the visited set and '_frontier' have not exceeded the maximum meory usage, and
+     * then evict from '_cache' until this source is using less than '_maxMemoryUsageBytes'.
      */
     void checkMemoryUsage();
 
     /**
-     * Process 'result', adding it to '_visited' with the given 'depth', and updating '_frontier'
-     * with the object's 'connectTo' values.
+     * Process 'result', adding it to the visited set with the given 'depth', and updating
+     * '_frontier' with the object's 'connectTo' values.
      *
-     * Returns whether '_visited' was updated, and thus, whether the search should recurse.
+     * Returns whether the visited set was updated, and thus, whether the search should recurse.
      */
     bool addToVisitedAndFrontier(Document result, long long depth);
 
@@ -191,10 +192,13 @@ private:
     // Only used during the breadth-first search, tracks the set of values on the current frontier.
     ValueUnorderedSet _frontier;
 
-    // Tracks nodes that have been discovered for a given input. Keys are the '_id' value of the
-    // document from the foreign collection, value is the document itself.  The keys are compared
-    // using the simple collation.
-    ValueUnorderedMap<Document> _visited;
+    // Tracks nodes that have been discovered for a given input. '_visitedKeys' holds a compact
+    // KeyString encoding of each visited document's '_id' for de-duplication (KeyString buffer
+    // equality matches simple-collation Value equality), while the documents themselves are
+    // appended to '_visitedDocuments'. Storing one small encoded copy of each key is
+    // considerably cheaper than a Value-keyed hash map of full documents.
+    stdx::unordered_set<std::string> _visitedKeys;
+    std::vector<Document> _visitedDocuments;
 
     // Caches query results to avoid repeating any work. This structure is maintained across calls
     // to getNext().
@@ -66,11 +66,10 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNext() {
         invariant(initializationResult.isEOF());
     }
 
-    for (auto&& accum : _currentAccumulators) {
-        accum->reset();  // Prep accumulators for a new group.
-    }
-
     if (_spilled) {
+        for (auto&& accum : _currentAccumulators) {
+            accum->reset();  // Prep accumulators for a new group.
+        }
         return getNextSpilled();
     } else if (_streaming) {
         return getNextStreaming();
@@ -127,41 +126,87 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
 }
 
 DocumentSource::GetNextResult DocumentSourceGroup::getNextStreaming() {
-    // Streaming optimization is active.
-    if (!_firstDocOfNextGroup) {
-        auto nextInput = pSource->getNext();
-        if (!nextInput.isAdvanced()) {
-            return nextInput;
-        }
-        _firstDocOfNextGroup = nextInput.releaseDocument();
+    if (_sourceExhausted) {
+        // All that remain are the deferred groups, which were accumulated in '_groups' because
+        // their documents are not necessarily contiguous in the sorted input.
+        return getNextStandard();
     }
 
-    Value id;
-    do {
-        // Add to the current accumulator(s).
-        for (size_t i = 0; i < _currentAccumulators.size(); i++) {
-            _currentAccumulators[i]->process(
-                _accumulatedFields[i].expression->evaluate(*_firstDocOfNextGroup), _doingMerge);
-        }
-
-        // Retrieve the next document.
-        auto nextInput = pSource->getNext();
-        if (!nextInput.isAdvanced()) {
-            return nextInput;
+    while (true) {
+        if (!_firstDocOfNextGroup) {
+            auto nextInput = pSource->getNext();
+            if (nextInput.isPaused()) {
+                return nextInput;
+            }
+            if (nextInput.isEOF()) {
+                _sourceExhausted = true;
+                groupsIterator = _groups->begin();
+                if (_groupOpen) {
+                    _groupOpen = false;
+                    return makeDocument(_currentId, _currentAccumulators, pExpCtx->inShard);
+                }
+                return getNextStandard();
+            }
+            _firstDocOfNextGroup = nextInput.releaseDocument();
         }
 
-        _firstDocOfNextGroup = nextInput.releaseDocument();
-
+        Value id = computeId(*_firstDocOfNextGroup);
+
+        if (groupKeyNeedsDeferral(*_firstDocOfNextGroup)) {
+            // Documents that group together on this key are not necessarily contiguous in the
+            // sorted input, so the group accumulates in '_groups' and is emitted once the input
+            // is exhausted.
+            const size_t numAccumulators = _accumulatedFields.size();
+            const size_t oldSize = _groups->size();
+            Accumulators& group = (*_groups)[id];
+            if (_groups->size() != oldSize) {
+                _memoryUsageBytes += id.getApproximateSize();
+                group.reserve(numAccumulators);
+                for (auto&& accumulatedField : _accumulatedFields) {
+                    group.push_back(accumulatedField.makeAccumulator(pExpCtx));
+                }
+            }
+            for (size_t i = 0; i < numAccumulators; i++) {
+                _memoryUsageBytes -= group[i]->memUsageForSorter();
+                group[i]->process(
+                    _accumulatedFields[i].expression->evaluate(*_firstDocOfNextGroup),
+                    _doingMerge);
+                _memoryUsageBytes += group[i]->memUsageForSorter();
+            }
+            uassert(40603,
+                    "Exceeded memory limit for $group while buffering groups whose keys are not"
+                    " contiguous in the sorted input; a streaming $group cannot spill to disk",
+                    _memoryUsageBytes <= _maxMemoryUsageBytes);
 
-        // Compute the id. If it does not match _currentId, we will exit the loop, leaving
-        // _firstDocOfNextGroup set for the next time getNext() is called.
-        id = computeId(*_firstDocOfNextGroup);
-    } while (pExpCtx->getValueComparator().evaluate(_currentId == id));
+            _firstDocOfNextGroup = boost::none;
+            continue;
+        }
 
-    Document out = makeDocument(_currentId, _currentAccumulators, pExpCtx->inShard);
-    _currentId = std::move(id);
+        if (!_groupOpen) {
+            _currentId = std::move(id);
+            _groupOpen = true;
+            for (auto&& accum : _currentAccumulators) {
+                accum->reset();  // Prep accumulators for a new group.
+            }
+        } else if (!pExpCtx->getValueComparator().evaluate(_currentId == id)) {
+            // The key changed, so the current group is complete. Leave '_firstDocOfNextGroup'
+            // engaged; it is the first document of the next group.
+            Document out = makeDocument(_currentId, _currentAccumulators, pExpCtx->inShard);
+            _currentId = std::move(id);
+            for (auto&& accum : _currentAccumulators) {
+                accum->reset();
+            }
+            return std::move(out);
+        }
 
-    return std::move(out);
+        // Accumulate the pending document into the current group.
+        for (size_t i = 0; i < _currentAccumulators.size(); i++) {
+            _currentAccumulators[i]->process(
+                _accumulatedFields[i].expression->evaluate(*_firstDocOfNextGroup), _doingMerge);
+        }
+        _firstDocOfNextGroup = boost::none;
+    }
+    MONGO_UNREACHABLE;
 }
 
 void DocumentSourceGroup::doDispose() {
@@ -405,28 +450,6 @@ bool containsOnlyFieldPathsAndConstants(ExpressionObject* expressionObj) {
     return true;
 }
 
-void getFieldPathMap(ExpressionObject* expressionObj,
-                     std::string prefix,
-                     StringMap<std::string>* fields) {
-    // Given an expression with only constant and FieldPath leaf nodes, such as {x: {y: "$a.b"}},
-    // attempt to compute a map from each FieldPath leaf to the path of that leaf. In the example,
-    // this method would return: {"a.b" : "x.y"}.
-
-    for (auto&& it : expressionObj->getChildExpressions()) {
-        intrusive_ptr<Expression> childExp = it.second;
-        ExpressionObject* expObj = dynamic_cast<ExpressionObject*>(childExp.get());
-        ExpressionFieldPath* expPath = dynamic_cast<ExpressionFieldPath*>(childExp.get());
-
-        std::string newPrefix = prefix.empty() ? it.first : prefix + "." + it.first;
-
-        if (expObj) {
-            getFieldPathMap(expObj, newPrefix, fields);
-        } else if (expPath) {
-            (*fields)[expPath->getFieldPath().tail().fullPath()] = newPrefix;
-        }
-    }
-}
-
 void getFieldPathListForSpilled(ExpressionObject* expressionObj,
                                 std::string prefix,
                                 std::vector<std::string>* fields) {
@@ -457,6 +480,14 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
         _streaming = true;
         _inputSort = *inputSort;
 
+        // Remember the paths of the fields the input is ordered by; each incoming document's
+        // values for these paths determine whether it can be grouped purely by streaming (see
+        // groupKeyNeedsDeferral()).
+        _streamingKeyPaths.clear();
+        for (auto&& sortField : _inputSort) {
+            _streamingKeyPaths.emplace_back(sortField.fieldNameStringData().toString());
+        }
+
         // Set up accumulators.
         _currentAccumulators.reserve(numAccumulators);
         for (auto&& accumulatedField : _accumulatedFields) {
@@ -470,9 +501,6 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
             return firstInput;
         }
         _firstDocOfNextGroup = firstInput.releaseDocument();
-
-        // Compute the _id value.
-        _currentId = computeId(*_firstDocOfNextGroup);
         _initialized = true;
         return DocumentSource::GetNextResult::makeEOF();
     }
@@ -510,17 +538,17 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
             for (auto&& accumulatedField : _accumulatedFields) {
                 group.push_back(accumulatedField.makeAccumulator(pExpCtx));
             }
-        } else {
-            for (auto&& groupObj : group) {
-                // subtract old mem usage. New usage added back after processing.
-                _memoryUsageBytes -= groupObj->memUsageForSorter();
-            }
         }
 
         /* tickle all the accumulators for the group we found */
         dassert(numAccumulators == group.size());
 
         for (size_t i = 0; i < numAccumulators; i++) {
+            if (!inserted) {
+                // subtract old mem usage. New usage added back after processing.
+                _memoryUsageBytes -= group[i]->memUsageForSorter();
+            }
+
             group[i]->process(_accumulatedFields[i].expression->evaluate(rootDocument),
                               _doingMerge);
 
@@ -589,7 +617,9 @@ shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
         ptrs.push_back(&*it);
     }
 
-    stable_sort(ptrs.begin(), ptrs.end(), SpillSTLComparator(pExpCtx->getValueComparator()));
+    // The pointers are to distinct map keys, so there are no equivalent elements for stability
+    // to preserve and a plain sort suffices.
+    sort(ptrs.begin(), ptrs.end(), SpillSTLComparator(pExpCtx->getValueComparator()));
 
     SortedFileWriter<Value, Value> writer(SortOptions().TempDir(pExpCtx->tempDir));
     switch (_accumulatedFields.size()) {  // same as ptrs[i]->second.size() for all i.
@@ -609,6 +639,7 @@ shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
         default:  // multiple values, serialize as array-typed Value
             for (size_t i = 0; i < ptrs.size(); i++) {
                 vector<Value> accums;
+                accums.reserve(ptrs[i]->second.size());
                 for (size_t j = 0; j < ptrs[i]->second.size(); j++) {
                     accums.push_back(ptrs[i]->second[j]->getValue(/*toBeMerged=*/true));
                 }
@@ -623,12 +654,6 @@ shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
 }
 
 boost::optional<BSONObj> DocumentSourceGroup::findRelevantInputSort() const {
-    if (true) {
-        // Until streaming $group correctly handles nullish values, the streaming behavior is
-        // disabled. See SERVER-23318.
-        return boost::none;
-    }
-
     if (!pSource) {
         // Sometimes when performing an explain, or using $group as the merge point, 'pSource' will
         // not be set.
@@ -691,64 +716,21 @@ boost::optional<BSONObj> DocumentSourceGroup::findRelevantInputSort() const {
 BSONObjSet DocumentSourceGroup::getOutputSorts() {
     if (!_initialized) {
         initialize();  // Note this might not finish initializing, but that's OK. We just want to
-                       // do some initialization to try to determine if we are streaming or spilled.
-                       // False negatives are OK.
+                       // do some initialization to try to determine if we are spilled. False
+                       // negatives are OK.
     }
 
-    if (!(_streaming || _spilled)) {
+    if (!_spilled) {
+        // A streaming $group mostly emits groups in the input's sort order, but groups whose
+        // keys are not contiguous in the input (e.g. nullish keys) are deferred and emitted
+        // last, so we cannot claim an output sort order for it either.
         return SimpleBSONObjComparator::kInstance.makeBSONObjSet();
     }
 
     BSONObjBuilder sortOrder;
 
     if (_idFieldNames.empty()) {
-        if (_spilled) {
-            sortOrder.append("_id", 1);
-        } else {
-            // We have an expression like {_id: "$a"}. Check if this is a FieldPath, and if it is,
-            // get the sort order out of it.
-            if (auto obj = dynamic_cast<ExpressionFieldPath*>(_idExpressions[0].get())) {
-                FieldPath _idSort = obj->getFieldPath();
-
-                sortOrder.append(
-                    "_id",
-                    _inputSort.getIntField(_idSort.getFieldName(_idSort.getPathLength() - 1)));
-            }
-        }
-    } else if (_streaming) {
-        // At this point, we know that _streaming is true, so _id must have only contained
-        // ExpressionObjects, ExpressionConstants or ExpressionFieldPaths. We now process each
-        // '_idExpression'.
-
-        // We populate 'fieldMap' such that each key is a field the input is sorted by, and the
-        // value is where that input field is located within the _id document. For example, if our
-        // _id object is {_id: {x: {y: "$a.b"}}}, 'fieldMap' would be: {'a.b': '_id.x.y'}.
-        StringMap<std::string> fieldMap;
-        for (size_t i = 0; i < _idFieldNames.size(); i++) {
-            intrusive_ptr<Expression> exp = _idExpressions[i];
-            if (auto obj = dynamic_cast<ExpressionObject*>(exp.get())) {
-                // _id is an object containing a nested document, such as: {_id: {x: {y: "$b"}}}.
-                getFieldPathMap(obj, "_id." + _idFieldNames[i], &fieldMap);
-            } else if (auto fieldPath = dynamic_cast<ExpressionFieldPath*>(exp.get())) {
-                FieldPath _idSort = fieldPath->getFieldPath();
-                fieldMap[_idSort.getFieldName(_idSort.getPathLength() - 1)] =
-                    "_id." + _idFieldNames[i];
-            }
-        }
-
-        // Because the order of '_inputSort' is important, we go through each field we are sorted on
-        // and append it to the BSONObjBuilder in order.
-        for (BSONElement sortField : _inputSort) {
-            std::string sortString = sortField.fieldNameStringData().toString();
-
-            auto itr = fieldMap.find(sortString);
-
-            // If our sort order is (a, b, c), we could not have converted to a streaming $group if
-            // our _id was predicated on (a, c) but not 'b'. Verify that this is true.
-            invariant(itr != fieldMap.end());
-
-            sortOrder.append(itr->second, _inputSort.getIntField(sortString));
-        }
+        sortOrder.append("_id", 1);
     } else {
         // We are blocking and have spilled to disk.
         std::vector<std::string> outputSort;
@@ -770,6 +752,24 @@ BSONObjSet DocumentSourceGroup::getOutputSorts() {
 }
 
 
+bool DocumentSourceGroup::groupKeyNeedsDeferral(const Document& doc) const {
+    // The input is only guaranteed to be ordered by the sort fields' values as the sort saw
+    // them, and the group key is a function of exactly those fields. Nullish values conflate:
+    // missing and null produce the same group key but can sort apart (undefined sorts between
+    // them), and index-provided sorts key missing and undefined as null outright. Array values
+    // are placed by a single element's index key when the input order comes from a multikey
+    // index, so equal array keys can interleave with other documents. In either case documents
+    // of the same group may not be contiguous, so the group must be buffered instead of
+    // streamed.
+    for (auto&& path : _streamingKeyPaths) {
+        const Value val = doc.getNestedField(path);
+        if (val.nullish() || val.isArray()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 Value DocumentSourceGroup::computeId(const Document& root) {
     // If only one expression, return result directly
     if (_idExpressions.size() == 1) {
@@ -103,13 +103,22 @@ private:
 
     /**
      * getNext() dispatches to one of these three depending on what type of $group it is. All three
-     * of these methods expect '_currentAccumulators' to have been reset before being called, and
-     * also expect initialize() to have been called already.
+     * of these methods expect initialize() to have been called already. getNextSpilled()
+     * additionally expects '_currentAccumulators' to have been reset before being called.
      */
     GetNextResult getNextStreaming();
     GetNextResult getNextSpilled();
     GetNextResult getNextStandard();
 
+    /**
+     * Returns true if 'doc' cannot be grouped by pure streaming because documents sharing its
+     * group key are not necessarily contiguous in the sorted input. This is the case when any
+     * of the fields the input is ordered by ('_streamingKeyPaths') is nullish or array-valued
+     * in 'doc': nullish values can sort apart yet group together, and array values are placed
+     * by a single element's key when the order comes from a multikey index.
+     */
+    bool groupKeyNeedsDeferral(const Document& doc) const;
+
     /**
      * Attempt to identify an input sort order that allows us to turn into a streaming $group. If we
      * find one, return it. Otherwise, return boost::none.
@@ -160,6 +169,17 @@ private:
     bool _streaming;
     bool _initialized;
 
+    // Streaming mode only. The paths of the fields the input is ordered by; used to decide
+    // per document whether its group can be streamed (see groupKeyNeedsDeferral()).
+    std::vector<FieldPath> _streamingKeyPaths;
+
+    // Streaming mode only. '_sourceExhausted' is set once 'pSource' has been exhausted and only
+    // the deferred groups (accumulated in '_groups') remain to be emitted. '_groupOpen' is true
+    // while '_currentId' and '_currentAccumulators' describe a group that is still receiving
+    // input documents.
+    bool _sourceExhausted = false;
+    bool _groupOpen = false;
+
     Value _currentId;
     Accumulators _currentAccumulators;
 
@@ -28,6 +28,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <boost/intrusive_ptr.hpp>
 #include <deque>
 #include <map>
@@ -797,10 +798,10 @@ public:
 
         assertEOF(group());
 
+        // A streaming $group cannot claim an output sort order, since groups whose keys are not
+        // contiguous in the input are deferred and emitted last.
         BSONObjSet outputSort = group()->getOutputSorts();
-        ASSERT_EQUALS(outputSort.size(), 1U);
-
-        ASSERT_EQUALS(outputSort.count(BSON("_id" << 1)), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -834,13 +835,7 @@ public:
         assertEOF(source);
 
         BSONObjSet outputSort = group()->getOutputSorts();
-        ASSERT_EQUALS(outputSort.size(), 2U);
-
-        BSONObj correctSort = BSON("_id.x" << 1 << "_id.y" << -1);
-        ASSERT_EQUALS(outputSort.count(correctSort), 1U);
-
-        BSONObj prefixSort = BSON("_id.x" << 1);
-        ASSERT_EQUALS(outputSort.count(prefixSort), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -854,29 +849,33 @@ public:
         createGroup(fromjson("{_id: {x: {y: {z: '$a.b.c', q: '$a.b.d'}}, v: '$d'}}"));
         group()->setSource(source.get());
 
+        // Every input document is missing 'a.b.d', one of the fields the input is sorted on, so
+        // every group is deferred and emitted only once the input is exhausted, in no particular
+        // order.
         auto res = group()->getNext();
         ASSERT_TRUE(res.isAdvanced());
-        ASSERT_VALUE_EQ(res.getDocument().getField("_id")["x"]["y"]["z"], Value(3));
-
         ASSERT_TRUE(group()->isStreaming());
 
-        res = source->getNext();
-        ASSERT_TRUE(res.isAdvanced());
-        ASSERT_VALUE_EQ(res.getDocument().getField("a")["b"]["c"], Value(1));
-
+        std::vector<Document> results;
+        results.push_back(res.releaseDocument());
+        for (res = group()->getNext(); res.isAdvanced(); res = group()->getNext()) {
+            results.push_back(res.releaseDocument());
+        }
         assertEOF(source);
+        ASSERT_EQUALS(results.size(), 3U);
+
+        std::sort(results.begin(), results.end(), [](const Document& lhs, const Document& rhs) {
+            return lhs.getField("_id")["v"].getInt() < rhs.getField("_id")["v"].getInt();
+        });
+        ASSERT_VALUE_EQ(results[0].getField("_id")["x"]["y"]["z"], Value(1));
+        ASSERT_VALUE_EQ(results[0].getField("_id")["v"], Value(0));
+        ASSERT_VALUE_EQ(results[1].getField("_id")["x"]["y"]["z"], Value(3));
+        ASSERT_VALUE_EQ(results[1].getField("_id")["v"], Value(1));
+        ASSERT_VALUE_EQ(results[2].getField("_id")["x"]["y"]["z"], Value(1));
+        ASSERT_VALUE_EQ(results[2].getField("_id")["v"], Value(2));
 
         BSONObjSet outputSort = group()->getOutputSorts();
-        ASSERT_EQUALS(outputSort.size(), 3U);
-
-        BSONObj correctSort = fromjson("{'_id.x.y.z': -1, '_id.x.y.q': 1, '_id.v': 1}");
-        ASSERT_EQUALS(outputSort.count(correctSort), 1U);
-
-        BSONObj prefixSortTwo = fromjson("{'_id.x.y.z': -1, '_id.x.y.q': 1}");
-        ASSERT_EQUALS(outputSort.count(prefixSortTwo), 1U);
-
-        BSONObj prefixSortOne = fromjson("{'_id.x.y.z': -1}");
-        ASSERT_EQUALS(outputSort.count(prefixSortOne), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -904,14 +903,7 @@ public:
         ASSERT_VALUE_EQ(res.getDocument().getField("b"), Value(3));
 
         BSONObjSet outputSort = group()->getOutputSorts();
-
-        ASSERT_EQUALS(outputSort.size(), 2U);
-
-        BSONObj correctSort = fromjson("{'_id.sub.z': 1}");
-        ASSERT_EQUALS(outputSort.count(correctSort), 1U);
-
-        BSONObj prefixSortTwo = fromjson("{'_id.sub.z': 1, '_id.sub.y': 1}");
-        ASSERT_EQUALS(outputSort.count(prefixSortTwo), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -939,13 +931,7 @@ public:
         ASSERT_VALUE_EQ(res.getDocument().getField("b"), Value(1));
 
         BSONObjSet outputSort = group()->getOutputSorts();
-        ASSERT_EQUALS(outputSort.size(), 2U);
-
-        BSONObj correctSort = fromjson("{'_id.sub.x': -1}");
-        ASSERT_EQUALS(outputSort.count(correctSort), 1U);
-
-        BSONObj prefixSortTwo = fromjson("{'_id.sub.x': -1, '_id.sub.y': 1}");
-        ASSERT_EQUALS(outputSort.count(prefixSortTwo), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -962,10 +948,7 @@ public:
         ASSERT_TRUE(group()->isStreaming());
 
         BSONObjSet outputSort = group()->getOutputSorts();
-        ASSERT_EQUALS(outputSort.size(), 1U);
-
-        BSONObj correctSort = fromjson("{_id: 1}");
-        ASSERT_EQUALS(outputSort.count(correctSort), 1U);
+        ASSERT_EQUALS(outputSort.size(), 0U);
     }
 };
 
@@ -1155,8 +1138,6 @@ public:
         add<Dependencies>();
         add<StringConstantIdAndAccumulatorExpressions>();
         add<ArrayConstantAccumulatorExpression>();
-#if 0
-        // Disabled tests until SERVER-23318 is implemented.
         add<StreamingOptimization>();
         add<StreamingWithMultipleIdFields>();
         add<NoOptimizationIfMissingDoubleSort>();
@@ -1168,7 +1149,6 @@ public:
         add<StreamingWithRootSubfield>();
         add<StreamingWithConstantAndFieldPath>();
         add<StreamingWithFieldRepeated>();
-#endif
     }
 };
 
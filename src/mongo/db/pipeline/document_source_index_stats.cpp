@@ -62,6 +62,8 @@ DocumentSource::GetNextResult DocumentSourceIndexStats::getNext() {
         doc["host"] = Value(_processName);
         doc["accesses"]["ops"] = Value(stats.accesses.loadRelaxed());
         doc["accesses"]["since"] = Value(stats.trackerStartTime);
+        doc["accesses"]["keysExamined"] = Value(stats.keysExamined.loadRelaxed());
+        doc["accesses"]["docsReturned"] = Value(stats.docsReturned.loadRelaxed());
         ++_indexStatsIter;
         return doc.freeze();
     }
@@ -34,6 +34,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/pipeline/document.h"
+#include "mongo/db/pipeline/document_comparator.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -71,7 +72,8 @@ DocumentSourceLookUp::DocumentSourceLookUp(NamespaceString fromNs,
     : DocumentSourceNeedsMongod(pExpCtx),
       _fromNs(std::move(fromNs)),
       _as(std::move(as)),
-      _variablesParseState(_variables.useIdGenerator()) {
+      _variablesParseState(_variables.useIdGenerator()),
+      _cache(pExpCtx->getValueComparator()) {
     const auto& resolvedNamespace = pExpCtx->getResolvedNamespace(_fromNs);
     _resolvedNs = resolvedNamespace.ns;
     _resolvedPipeline = resolvedNamespace.pipeline;
@@ -193,6 +195,17 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
         return unwindResult();
     }
 
+    // If we have not absorbed a $unwind, we cannot absorb a $match. If we have absorbed a $unwind,
+    // '_unwindSrc' would be non-null, and we would not have made it here.
+    invariant(!_matchSrc);
+
+    if (!wasConstructedWithPipelineSyntax()) {
+        // The localField/foreignField syntax joins on simple equality, so we can batch several
+        // input documents into a single indexed $in query against the foreign collection rather
+        // than paying query planning and cursor setup once per input document.
+        return getNextBatched();
+    }
+
     auto nextInput = pSource->getNext();
     if (!nextInput.isAdvanced()) {
         return nextInput;
@@ -202,17 +215,6 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
     copyVariablesToExpCtx(_variables, _variablesParseState, _fromExpCtx.get());
     resolveLetVariables(inputDoc, &_fromExpCtx->variables);
 
-    // If we have not absorbed a $unwind, we cannot absorb a $match. If we have absorbed a $unwind,
-    // '_unwindSrc' would be non-null, and we would not have made it here.
-    invariant(!_matchSrc);
-
-    if (!wasConstructedWithPipelineSyntax()) {
-        auto matchStage =
-            makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
-        // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
-        _resolvedPipeline.back() = matchStage;
-    }
-
     auto pipeline = uassertStatusOK(_mongod->makePipeline(_resolvedPipeline, _fromExpCtx));
 
     std::vector<Value> results;
@@ -234,6 +236,194 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
     return output.freeze();
 }
 
+DocumentSource::GetNextResult DocumentSourceLookUp::getNextBatched() {
+    while (_batchedOutputs.empty()) {
+        if (_sourceStatus) {
+            auto status = std::move(*_sourceStatus);
+            _sourceStatus = boost::none;
+            return status;
+        }
+        populateBatch();
+    }
+
+    Document out = std::move(_batchedOutputs.front());
+    _batchedOutputs.pop_front();
+    return std::move(out);
+}
+
+void DocumentSourceLookUp::populateBatch() {
+    invariant(_batchedOutputs.empty() && !_sourceStatus);
+
+    copyVariablesToExpCtx(_variables, _variablesParseState, _fromExpCtx.get());
+
+    // Buffer a batch of input documents, computing the join keys of each. Keys that are neither
+    // cached from a previous batch nor required by an earlier document in this batch are
+    // collected in 'keysToQuery'.
+    std::vector<Document> inputs;
+    std::vector<std::vector<Value>> keyLists;
+    ValueUnorderedSet keysToQuery = pExpCtx->getValueComparator().makeUnorderedValueSet();
+
+    while (inputs.size() < kBatchSize) {
+        auto nextInput = pSource->getNext();
+        if (!nextInput.isAdvanced()) {
+            _sourceStatus = std::move(nextInput);
+            break;
+        }
+        inputs.push_back(nextInput.releaseDocument());
+        keyLists.push_back(extractLocalKeys(inputs.back()));
+        for (auto&& key : keyLists.back()) {
+            if (!_cache[key]) {
+                keysToQuery.insert(key);
+            }
+        }
+    }
+
+    if (inputs.empty()) {
+        return;
+    }
+
+    if (!keysToQuery.empty()) {
+        // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
+        _resolvedPipeline.back() = makeMatchStageForKeys(keysToQuery);
+        auto pipeline = uassertStatusOK(_mongod->makePipeline(_resolvedPipeline, _fromExpCtx));
+
+        while (auto result = pipeline->getNext()) {
+            // Cache 'result' under each distinct value of its foreign field that was queried
+            // for. As in DocumentSourceGraphLookUp::addToCache(), we must not cache under a
+            // value we did not query for, since the cache entry for that value would then be
+            // incomplete.
+            ValueUnorderedSet resultKeys = pExpCtx->getValueComparator().makeUnorderedValueSet();
+            document_path_support::visitAllValuesAtPath(
+                *result, *_foreignField, [&resultKeys](const Value& foreignValue) {
+                    resultKeys.insert(foreignValue);
+                });
+            for (auto&& key : resultKeys) {
+                if (keysToQuery.count(key) > 0) {
+                    _cache.insert(key, *result);
+                }
+            }
+        }
+    }
+
+    // Assemble an output document for each buffered input, in input order.
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        std::vector<Value> results;
+        int objsize = 0;
+
+        if (keyLists[i].empty()) {
+            // This document's keys cannot be joined through the batched $in query; issue its
+            // foreign query individually, as before.
+            auto matchStage = makeMatchStageFromInput(
+                inputs[i], *_localField, _foreignField->fullPath(), BSONObj());
+            _resolvedPipeline.back() = matchStage;
+            auto pipeline = uassertStatusOK(_mongod->makePipeline(_resolvedPipeline, _fromExpCtx));
+
+            while (auto result = pipeline->getNext()) {
+                objsize += result->getApproximateSize();
+                uassert(4568,
+                        str::stream() << "Total size of documents in " << _fromNs.coll()
+                                      << " matching pipeline "
+                                      << getUserPipelineDefinition()
+                                      << " exceeds maximum document size",
+                        objsize <= BSONObjMaxInternalSize);
+                results.emplace_back(std::move(*result));
+            }
+        } else {
+            // A foreign document may join with more than one of this document's keys, but must
+            // appear in the result array only once, so we track what we have emitted when there
+            // are multiple keys.
+            boost::optional<DocumentUnorderedSet> seen;
+            if (keyLists[i].size() > 1) {
+                seen.emplace(pExpCtx->getDocumentComparator().makeUnorderedDocumentSet());
+            }
+
+            for (auto&& key : keyLists[i]) {
+                auto cached = _cache[key];
+                if (!cached) {
+                    continue;
+                }
+                for (auto&& foreignDoc : *cached) {
+                    if (seen && !seen->insert(foreignDoc).second) {
+                        continue;
+                    }
+                    objsize += foreignDoc.getApproximateSize();
+                    uassert(4568,
+                            str::stream() << "Total size of documents in " << _fromNs.coll()
+                                          << " matching pipeline "
+                                          << getUserPipelineDefinition()
+                                          << " exceeds maximum document size",
+                            objsize <= BSONObjMaxInternalSize);
+                    results.emplace_back(foreignDoc);
+                }
+            }
+        }
+
+        MutableDocument output(std::move(inputs[i]));
+        output.setNestedField(_as, Value(std::move(results)));
+        _batchedOutputs.push_back(output.freeze());
+    }
+
+    _cache.evictDownTo(kMaxCacheSizeBytes);
+}
+
+std::vector<Value> DocumentSourceLookUp::extractLocalKeys(const Document& input) const {
+    // Gather the distinct values of '_localField' that 'input' joins on. Returns an empty vector
+    // if any value cannot serve as a batched lookup key: nullish keys also match missing foreign
+    // fields, array keys have whole-array equality semantics, and regexes must not perform
+    // pattern matching inside $in. Such documents fall back to an individual foreign query.
+    std::vector<Value> keys;
+    bool eligible = true;
+    const auto& comparator = pExpCtx->getValueComparator();
+
+    document_path_support::visitAllValuesAtPath(
+        input, *_localField, [&keys, &eligible, &comparator](const Value& value) {
+            if (value.nullish() || value.isArray() || value.getType() == BSONType::RegEx) {
+                eligible = false;
+                return;
+            }
+            for (auto&& key : keys) {
+                if (comparator.evaluate(key == value)) {
+                    return;
+                }
+            }
+            keys.push_back(value);
+        });
+
+    if (!eligible || keys.empty()) {
+        return {};
+    }
+    return keys;
+}
+
+BSONObj DocumentSourceLookUp::makeMatchStageForKeys(const ValueUnorderedSet& keys) const {
+    // The batched analogue of makeMatchStageFromInput(): a single query of the form
+    // {$and: [{<foreignField>: {$in: [<key>, <key>, ...]}}, {}]}, wrapped in a $match so that it
+    // can be parsed into a DocumentSourceMatch when constructing a pipeline to execute.
+    BSONObjBuilder match;
+    BSONObjBuilder query(match.subobjStart("$match"));
+
+    BSONArrayBuilder andObj(query.subarrayStart("$and"));
+    BSONObjBuilder joiningObj(andObj.subobjStart());
+
+    BSONObjBuilder subObj(joiningObj.subobjStart(_foreignField->fullPath()));
+    BSONArrayBuilder inArray(subObj.subarrayStart("$in"));
+    for (auto&& key : keys) {
+        inArray << key;
+    }
+    inArray.doneFast();
+    subObj.doneFast();
+
+    joiningObj.doneFast();
+
+    BSONObjBuilder additionalFilterObj(andObj.subobjStart());
+    additionalFilterObj.doneFast();
+
+    andObj.doneFast();
+
+    query.doneFast();
+    return match.obj();
+}
+
 DocumentSource::GetModPathsReturn DocumentSourceLookUp::getModifiedPaths() const {
     std::set<std::string> modifiedPaths{_as.fullPath()};
     if (_unwindSrc) {
@@ -368,6 +558,9 @@ std::string DocumentSourceLookUp::getUserPipelineDefinition() {
 }
 
 void DocumentSourceLookUp::doDispose() {
+    _cache.clear();
+    _batchedOutputs.clear();
+
     if (_pipeline) {
         _pipeline->dispose(pExpCtx->opCtx);
         _pipeline.reset();
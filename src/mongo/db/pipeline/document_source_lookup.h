@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_unwind.h"
@@ -172,6 +174,35 @@ private:
 
     GetNextResult unwindResult();
 
+    /**
+     * Implements getNext() for the localField/foreignField syntax when no $unwind has been
+     * absorbed. Returns buffered output documents, populating a new batch when the buffer is
+     * empty.
+     */
+    GetNextResult getNextBatched();
+
+    /**
+     * Buffers up to 'kBatchSize' input documents, fetches all of their uncached join keys from
+     * the foreign collection with a single $in query, distributes the results via '_cache', and
+     * assembles the corresponding output documents into '_batchedOutputs'. Stores the first
+     * non-advancing result from 'pSource' in '_sourceStatus' to be propagated once the buffered
+     * output has been consumed.
+     */
+    void populateBatch();
+
+    /**
+     * Returns the distinct values of '_localField' that 'input' joins on, or an empty vector if
+     * any of them cannot be used as a batched lookup key and 'input' requires an individual
+     * foreign query.
+     */
+    std::vector<Value> extractLocalKeys(const Document& input) const;
+
+    /**
+     * Builds the $match stage that fetches the foreign documents for every key in 'keys' at
+     * once.
+     */
+    BSONObj makeMatchStageForKeys(const ValueUnorderedSet& keys) const;
+
     /**
      * Copies 'vars' and 'vps' to the Variables and VariablesParseState objects in 'expCtx'. These
      * copies provide access to 'let' defined variables in sub-pipeline execution.
@@ -228,6 +259,17 @@ private:
     std::unique_ptr<Pipeline, Pipeline::Deleter> _pipeline;
     boost::optional<Document> _input;
     boost::optional<Document> _nextValue;
+
+    // The following members implement batching for the localField/foreignField syntax when no
+    // $unwind has been absorbed. Input documents are buffered 'kBatchSize' at a time, their join
+    // keys fetched from the foreign collection with a single $in query, and the fetched foreign
+    // documents distributed to the outputs through '_cache', which also allows keys repeated
+    // across batches to skip the foreign query entirely.
+    static const size_t kBatchSize = 100;
+    static const size_t kMaxCacheSizeBytes = 100 * 1024 * 1024;
+    LookupSetCache _cache;
+    std::deque<Document> _batchedOutputs;
+    boost::optional<GetNextResult> _sourceStatus;
 };
 
 }  // namespace mongo
@@ -30,6 +30,8 @@
 
 #include "mongo/db/pipeline/document_source_match.h"
 
+#include <algorithm>
+
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_array.h"
@@ -74,10 +76,19 @@ DocumentSource::GetNextResult DocumentSourceMatch::getNext() {
     auto nextInput = pSource->getNext();
     for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
         // MatchExpression only takes BSON documents, so we have to make one. As an optimization,
-        // only serialize the fields we need to do the match.
-        BSONObj toMatch = _dependencies.needWholeDocument
-            ? nextInput.getDocument().toBson()
-            : getObjectForMatch(nextInput.getDocument(), _dependencies.fields);
+        // only serialize the fields we need to do the match; their distinct top-level prefixes
+        // were precomputed when '_expression' was last set, so there is no per-document
+        // deduplication work to do here.
+        BSONObj toMatch;
+        if (_dependencies.needWholeDocument) {
+            toMatch = nextInput.getDocument().toBson();
+        } else {
+            BSONObjBuilder matchObject;
+            for (auto&& prefix : _dependencyPrefixes) {
+                nextInput.getDocument().getField(prefix).addToBsonObj(&matchObject, prefix);
+            }
+            toMatch = matchObject.obj();
+        }
 
         if (_expression->matchesBSON(toMatch)) {
             return nextInput;
@@ -372,6 +383,19 @@ void DocumentSourceMatch::joinMatchWith(intrusive_ptr<DocumentSourceMatch> other
     _expression = std::move(status.getValue());
     _dependencies = DepsTracker(_dependencies.getMetadataAvailable());
     getDependencies(&_dependencies);
+    recomputeDependencyPrefixes();
+}
+
+void DocumentSourceMatch::recomputeDependencyPrefixes() {
+    _dependencyPrefixes.clear();
+    for (auto&& field : _dependencies.fields) {
+        auto prefix = FieldPath::extractFirstFieldFromDottedPath(field).toString();
+        // Avoid adding the same prefix twice.
+        if (std::find(_dependencyPrefixes.begin(), _dependencyPrefixes.end(), prefix) ==
+            _dependencyPrefixes.end()) {
+            _dependencyPrefixes.push_back(std::move(prefix));
+        }
+    }
 }
 
 pair<intrusive_ptr<DocumentSourceMatch>, intrusive_ptr<DocumentSourceMatch>>
@@ -519,6 +543,7 @@ DocumentSourceMatch::DocumentSourceMatch(const BSONObj& query,
 
     _expression = std::move(status.getValue());
     getDependencies(&_dependencies);
+    recomputeDependencyPrefixes();
 }
 
 }  // namespace mongo
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "mongo/client/connpool.h"
 #include "mongo/db/matcher/matcher.h"
@@ -152,11 +153,21 @@ private:
 
     void addDependencies(DepsTracker* deps) const;
 
+    /**
+     * Recomputes '_dependencyPrefixes' from '_dependencies'. Must be called whenever
+     * '_dependencies' is recomputed.
+     */
+    void recomputeDependencyPrefixes();
+
     std::unique_ptr<MatchExpression> _expression;
 
     // Cache the dependencies so that we know what fields we need to serialize to BSON for matching.
     DepsTracker _dependencies;
 
+    // The distinct top-level prefixes of '_dependencies.fields', precomputed so that getNext() does
+    // not have to re-derive and deduplicate them for every input document it serializes.
+    std::vector<std::string> _dependencyPrefixes;
+
     BSONObj _predicate;
     const bool _isTextQuery;
 };
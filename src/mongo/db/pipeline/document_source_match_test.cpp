@@ -360,6 +360,28 @@ TEST_F(DocumentSourceMatchTest, ShouldCorrectlyJoinWithSubsequentMatch) {
     ASSERT_TRUE(match->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceMatchTest, ShouldMatchOnDottedDependenciesAfterJoiningWithSubsequentMatch) {
+    const auto match = DocumentSourceMatch::create(BSON("a.b" << 1), getExpCtx());
+    const auto secondMatch = DocumentSourceMatch::create(BSON("a.c" << 1), getExpCtx());
+
+    // Both predicates share the top-level prefix "a", which should only be serialized once per
+    // input document when matching.
+    match->joinMatchWith(secondMatch);
+
+    const auto mock =
+        DocumentSourceMock::create({Document{{"a", Document{{"b", 1}, {"c", 1}}}},
+                                    Document{{"a", Document{{"b", 1}, {"c", 2}}}},
+                                    Document{{"a", Document{{"b", 2}, {"c", 1}}}}});
+
+    match->setSource(mock.get());
+
+    auto next = match->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(), (Document{{"a", Document{{"b", 1}, {"c", 1}}}}));
+
+    ASSERT_TRUE(match->getNext().isEOF());
+}
+
 DEATH_TEST_F(DocumentSourceMatchTest,
              ShouldFailToDescendExpressionOnPathThatIsNotACommonPrefix,
              "Invariant failure expression::isPathPrefixOf") {
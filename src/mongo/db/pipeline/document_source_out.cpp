@@ -111,6 +111,15 @@ void DocumentSourceOut::initialize() {
                 ok);
     }
 
+    // The target collection's indexes are not copied here but in buildIndexes(), once all
+    // documents have been inserted. Building them over the full data set is much cheaper than
+    // maintaining them on every insert, and the rename cannot happen until they exist.
+    _initialized = true;
+}
+
+void DocumentSourceOut::buildIndexes() {
+    DBClientBase* conn = _mongod->directClient();
+
     // copy indexes to _tempNs
     for (std::list<BSONObj>::const_iterator it = _originalIndexes.begin();
          it != _originalIndexes.end();
@@ -130,7 +139,6 @@ void DocumentSourceOut::initialize() {
                               << err,
                 DBClientWithCommands::getLastErrorString(err).empty());
     }
-    _initialized = true;
 }
 
 void DocumentSourceOut::spill(const vector<BSONObj>& toInsert) {
@@ -178,6 +186,9 @@ DocumentSource::GetNextResult DocumentSourceOut::getNext() {
             return nextInput;  // Propagate the pause.
         }
         case GetNextResult::ReturnStatus::kEOF: {
+            // Now that the data is fully loaded, bulk build the target collection's indexes on
+            // the temp collection so the rename below produces an indexed collection.
+            buildIndexes();
 
             auto renameCommandObj =
                 BSON("renameCollection" << _tempNs.ns() << "to" << _outputNs.ns() << "dropTarget"
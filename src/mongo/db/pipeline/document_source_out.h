@@ -80,12 +80,19 @@ private:
      * Sets '_tempNs' to a unique temporary namespace, makes sure the output collection isn't
      * sharded or capped, and saves the collection options and indexes of the target collection.
      * Then creates the temporary collection we will insert into by copying the collection options
-     * and indexes from the target collection.
+     * from the target collection. Indexes are not created yet; see buildIndexes().
      *
      * Sets '_initialized' to true upon completion.
      */
     void initialize();
 
+    /**
+     * Copies the target collection's indexes onto the temporary collection. Called once all
+     * documents have been inserted, so the indexes are bulk built over the full data set rather
+     * than maintained incrementally by every insert.
+     */
+    void buildIndexes();
+
     /**
      * Inserts all of 'toInsert' into the temporary collection.
      */
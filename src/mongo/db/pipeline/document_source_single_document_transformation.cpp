@@ -34,6 +34,7 @@
 
 #include "mongo/db/pipeline/document.h"
 #include "mongo/db/pipeline/document_source_limit.h"
+#include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/value.h"
@@ -89,6 +90,22 @@ Pipeline::SourceContainer::iterator DocumentSourceSingleDocumentTransformation::
         std::swap(*itr, *std::next(itr));
         return itr == container->begin() ? itr : std::prev(itr);
     }
+
+    // If a $match follows, ask the transformer whether the predicate can be rewritten into a
+    // filter over our input documents. If so, insert the rewritten filter before us so
+    // non-matching inputs are rejected before they are transformed; the rewritten filter only
+    // guarantees a superset, so the original $match stays where it is.
+    auto nextMatch = dynamic_cast<DocumentSourceMatch*>((*std::next(itr)).get());
+    if (nextMatch && !_haveAttemptedMatchRewrite) {
+        _haveAttemptedMatchRewrite = true;
+        if (auto rewritten = _parsedTransform->rewriteMatchForInput(nextMatch->getQuery())) {
+            auto newMatchItr =
+                container->insert(itr, DocumentSourceMatch::create(*rewritten, pExpCtx));
+            // Reoptimize from before the inserted filter so it can coalesce with any $match
+            // already in front of us.
+            return newMatchItr == container->begin() ? newMatchItr : std::prev(newMatchItr);
+        }
+    }
     return std::next(itr);
 }
 
@@ -86,6 +86,17 @@ public:
         virtual bool isSubsetOfProjection(const BSONObj& proj) const {
             return false;
         }
+
+        /**
+         * Given the predicate of a $match stage that would run on this transformation's output,
+         * returns a predicate over this transformation's *input* documents that is guaranteed to
+         * match a superset of the inputs whose transformed output matches 'predicate', or
+         * boost::none if no such rewrite is available. The returned filter can be evaluated
+         * before the transformation runs; the original $match must still be applied afterwards.
+         */
+        virtual boost::optional<BSONObj> rewriteMatchForInput(const BSONObj& predicate) const {
+            return boost::none;
+        }
     };
 
     DocumentSourceSingleDocumentTransformation(
@@ -125,6 +136,10 @@ private:
 
     // Specific name of the transformation.
     std::string _name;
+
+    // Set once we have tried to rewrite a following $match into a filter over our input, so
+    // repeated optimization passes do not insert duplicate filters.
+    bool _haveAttemptedMatchRewrite = false;
 };
 
 }  // namespace mongo
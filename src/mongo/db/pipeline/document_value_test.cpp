@@ -105,6 +105,25 @@ TEST(DocumentConstruction, FromInitializerList) {
     ASSERT_EQUALS("q", getNthField(document, 1).second.getString());
 }
 
+TEST(DocumentFieldLookup, GetFieldWithPrecomputedHash) {
+    // Build a document large enough to use the field hash table, and one small enough to use a
+    // linear scan; lookups with a precomputed hash must agree with getField(StringData) on both.
+    MutableDocument md;
+    for (int i = 0; i < 32; ++i) {
+        md.addField("f" + std::to_string(i), Value(i));
+    }
+    Document large = md.freeze();
+    Document small = Document{{"f3", 42}};
+
+    const unsigned hash = Document::hashFieldName("f3");
+    ASSERT_VALUE_EQ(large.getField("f3", hash), large.getField("f3"));
+    ASSERT_VALUE_EQ(small.getField("f3", hash), small.getField("f3"));
+
+    const unsigned missingHash = Document::hashFieldName("no such field");
+    ASSERT(large.getField("no such field", missingHash).missing());
+    ASSERT(small.getField("no such field", missingHash).missing());
+}
+
 TEST(DocumentConstruction, FromEmptyDocumentClone) {
     Document document;
     ASSERT_EQUALS(0U, document.size());
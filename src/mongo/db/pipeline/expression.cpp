@@ -39,6 +39,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/pipeline/document.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/expression_program.h"
 #include "mongo/db/pipeline/value.h"
 #include "mongo/db/query/datetime/date_time_support.h"
 #include "mongo/platform/bits.h"
@@ -1621,6 +1622,9 @@ intrusive_ptr<ExpressionObject> ExpressionObject::parse(
 intrusive_ptr<Expression> ExpressionObject::optimize() {
     for (auto&& pair : _expressions) {
         pair.second = pair.second->optimize();
+        // Computed fields dominated by arithmetic and comparisons evaluate faster as a flattened
+        // program; expressions the compiler does not understand are returned unchanged.
+        pair.second = ExpressionCompiled::tryCompile(pair.second);
     }
     return this;
 }
@@ -1698,10 +1702,24 @@ intrusive_ptr<ExpressionFieldPath> ExpressionFieldPath::parse(
     }
 }
 
+namespace {
+vector<unsigned> computeFieldHashes(const FieldPath& fieldPath) {
+    vector<unsigned> hashes;
+    hashes.reserve(fieldPath.getPathLength());
+    for (size_t i = 0; i < fieldPath.getPathLength(); ++i) {
+        hashes.push_back(Document::hashFieldName(fieldPath.getFieldName(i)));
+    }
+    return hashes;
+}
+}  // namespace
+
 ExpressionFieldPath::ExpressionFieldPath(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                          const string& theFieldPath,
                                          Variables::Id variable)
-    : Expression(expCtx), _fieldPath(theFieldPath), _variable(variable) {}
+    : Expression(expCtx),
+      _fieldPath(theFieldPath),
+      _variable(variable),
+      _fieldHashes(computeFieldHashes(_fieldPath)) {}
 
 intrusive_ptr<Expression> ExpressionFieldPath::optimize() {
     if (_variable == Variables::kRemoveId) {
@@ -1745,10 +1763,10 @@ Value ExpressionFieldPath::evaluatePath(size_t index, const Document& input) con
 
     /* if we've hit the end of the path, stop */
     if (index == _fieldPath.getPathLength() - 1)
-        return input[_fieldPath.getFieldName(index)];
+        return input.getField(_fieldPath.getFieldName(index), _fieldHashes[index]);
 
     // Try to dive deeper
-    const Value val = input[_fieldPath.getFieldName(index)];
+    const Value val = input.getField(_fieldPath.getFieldName(index), _fieldHashes[index]);
     switch (val.getType()) {
         case Object:
             return evaluatePath(index + 1, val.getDocument());
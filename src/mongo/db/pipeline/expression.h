@@ -204,15 +204,15 @@ public:
      */
     static void registerExpression(std::string key, Parser parser);
 
+    const boost::intrusive_ptr<ExpressionContext>& getExpressionContext() const {
+        return _expCtx;
+    }
+
 protected:
     Expression(const boost::intrusive_ptr<ExpressionContext>& expCtx) : _expCtx(expCtx) {}
 
     typedef std::vector<boost::intrusive_ptr<Expression>> ExpressionVector;
 
-    const boost::intrusive_ptr<ExpressionContext>& getExpressionContext() const {
-        return _expCtx;
-    }
-
 private:
     boost::intrusive_ptr<ExpressionContext> _expCtx;
 };
@@ -256,6 +256,10 @@ public:
                                            BSONElement bsonExpr,
                                            const VariablesParseState& vps);
 
+    const ExpressionVector& getOperandList() const {
+        return vpOperand;
+    }
+
 protected:
     explicit ExpressionNary(const boost::intrusive_ptr<ExpressionContext>& expCtx)
         : Expression(expCtx) {}
@@ -779,6 +783,10 @@ public:
         const boost::intrusive_ptr<Expression>& exprLeft,
         const boost::intrusive_ptr<Expression>& exprRight);
 
+    CmpOp getOp() const {
+        return cmpOp;
+    }
+
 private:
     CmpOp cmpOp;
 };
@@ -1042,6 +1050,10 @@ private:
 
     const FieldPath _fieldPath;
     const Variables::Id _variable;
+
+    // The hash of each component of '_fieldPath', computed once here so that evaluating this
+    // expression against a long stream of documents does not rehash the same names per document.
+    const std::vector<unsigned> _fieldHashes;
 };
 
 
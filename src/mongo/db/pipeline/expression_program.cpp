@@ -0,0 +1,418 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/expression_program.h"
+
+#include "mongo/db/jsobj.h"
+#include "mongo/platform/decimal128.h"
+#include "mongo/platform/overflow_arithmetic.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/summation.h"
+
+namespace mongo {
+
+using boost::intrusive_ptr;
+using std::vector;
+
+using namespace mongoutils;
+
+/**
+ * The in-flight state of one operator whose operand instructions are currently executing. A
+ * single struct holds the accumulation state for every operator kind; only the fields belonging
+ * to the frame's opcode are touched.
+ */
+struct ExpressionProgram::Frame {
+    const Instruction* instruction;
+    size_t remainingOperands;
+
+    // $add: a compensated sum for non-decimal values, a separate decimal sum for decimal values,
+    // and the narrowest type seen so far, exactly as in ExpressionAdd::evaluate().
+    DoubleDoubleSummation nonDecimalTotal;
+    Decimal128 decimalTotal;
+    BSONType totalType = NumberInt;
+    bool haveDate = false;
+
+    // $multiply: parallel products per type, as in ExpressionMultiply::evaluate().
+    double doubleProduct = 1;
+    long long longProduct = 1;
+    Decimal128 decimalProduct;  // This will be initialized on encountering the first decimal.
+    BSONType productType = NumberInt;
+
+    // $subtract and the comparison operators: the left-hand operand, held until the right-hand
+    // operand arrives.
+    Value firstOperand;
+    bool haveFirstOperand = false;
+};
+
+bool ExpressionProgram::compileSubtree(const intrusive_ptr<Expression>& expression,
+                                       vector<Instruction>* instructions,
+                                       size_t* numOperators) {
+    if (auto constant = dynamic_cast<ExpressionConstant*>(expression.get())) {
+        Instruction instruction;
+        instruction.opCode = OpCode::kPushConstant;
+        instruction.constant = constant->getValue();
+        instructions->push_back(std::move(instruction));
+        return true;
+    }
+
+    if (dynamic_cast<ExpressionFieldPath*>(expression.get())) {
+        // Field paths stay leaves: their evaluate() does not recurse, so a single virtual call
+        // per leaf is all the dispatch the program pays for.
+        Instruction instruction;
+        instruction.opCode = OpCode::kPushLeaf;
+        instruction.leaf = expression;
+        instructions->push_back(std::move(instruction));
+        return true;
+    }
+
+    OpCode opCode;
+    ExpressionCompare::CmpOp cmpOp = ExpressionCompare::EQ;
+    if (dynamic_cast<ExpressionAdd*>(expression.get())) {
+        opCode = OpCode::kAdd;
+    } else if (dynamic_cast<ExpressionSubtract*>(expression.get())) {
+        opCode = OpCode::kSubtract;
+    } else if (dynamic_cast<ExpressionMultiply*>(expression.get())) {
+        opCode = OpCode::kMultiply;
+    } else if (auto compare = dynamic_cast<ExpressionCompare*>(expression.get())) {
+        opCode = OpCode::kCompare;
+        cmpOp = compare->getOp();
+    } else {
+        return false;
+    }
+
+    auto&& operands = static_cast<ExpressionNary*>(expression.get())->getOperandList();
+    if (operands.empty()) {
+        // An operandless $add or $multiply produces its identity without ever consuming an
+        // operand, which the frame stack cannot express. Constant folding removes these before
+        // compilation; refuse them rather than special-case them.
+        return false;
+    }
+
+    const size_t operatorIndex = instructions->size();
+    Instruction instruction;
+    instruction.opCode = opCode;
+    instruction.numOperands = operands.size();
+    instruction.cmpOp = cmpOp;
+    instructions->push_back(std::move(instruction));
+    ++*numOperators;
+
+    for (auto&& operand : operands) {
+        if (!compileSubtree(operand, instructions, numOperators)) {
+            return false;
+        }
+    }
+
+    (*instructions)[operatorIndex].endIndex = instructions->size();
+    return true;
+}
+
+ExpressionProgram::ExpressionProgram(vector<Instruction> instructions,
+                                     size_t numOperators,
+                                     const intrusive_ptr<ExpressionContext>& expCtx)
+    : _instructions(std::move(instructions)), _numOperators(numOperators), _expCtx(expCtx) {}
+
+boost::optional<ExpressionProgram> ExpressionProgram::compile(
+    const intrusive_ptr<Expression>& expression) {
+    vector<Instruction> instructions;
+    size_t numOperators = 0;
+    if (!compileSubtree(expression, &instructions, &numOperators)) {
+        return boost::none;
+    }
+    return ExpressionProgram(
+        std::move(instructions), numOperators, expression->getExpressionContext());
+}
+
+Value ExpressionProgram::evaluate(const Document& root) const {
+    vector<Frame> frames;
+    const size_t numInstructions = _instructions.size();
+    size_t index = 0;
+
+    while (true) {
+        invariant(index < numInstructions);
+        const Instruction& instruction = _instructions[index];
+
+        boost::optional<Value> produced;
+        switch (instruction.opCode) {
+            case OpCode::kPushConstant:
+                produced = instruction.constant;
+                ++index;
+                break;
+            case OpCode::kPushLeaf:
+                produced = instruction.leaf->evaluate(root);
+                ++index;
+                break;
+            default:
+                frames.emplace_back();
+                frames.back().instruction = &instruction;
+                frames.back().remainingOperands = instruction.numOperands;
+                ++index;
+                break;
+        }
+
+        // Deliver a produced value to the enclosing operator; each operator that completes as a
+        // result delivers its own result one frame further up.
+        while (produced) {
+            if (frames.empty()) {
+                invariant(index == numInstructions);
+                return std::move(*produced);
+            }
+            auto result = consumeOperand(&frames.back(), std::move(*produced));
+            produced = boost::none;
+            if (result) {
+                // Skip any operand instructions the operator finished without; for an operator
+                // that consumed all of its operands this leaves 'index' unchanged.
+                index = frames.back().instruction->endIndex;
+                frames.pop_back();
+                produced = std::move(result);
+            }
+        }
+    }
+}
+
+boost::optional<Value> ExpressionProgram::consumeOperand(Frame* frame, Value operand) const {
+    // Each case folds 'operand' into the frame and, on the last operand, computes the final
+    // result with the same logic as the corresponding Expression subclass' evaluate().
+    switch (frame->instruction->opCode) {
+        case OpCode::kAdd: {
+            switch (operand.getType()) {
+                case NumberDecimal:
+                    frame->decimalTotal = frame->decimalTotal.add(operand.getDecimal());
+                    frame->totalType = NumberDecimal;
+                    break;
+                case NumberDouble:
+                    frame->nonDecimalTotal.addDouble(operand.getDouble());
+                    if (frame->totalType != NumberDecimal)
+                        frame->totalType = NumberDouble;
+                    break;
+                case NumberLong:
+                    frame->nonDecimalTotal.addLong(operand.getLong());
+                    if (frame->totalType == NumberInt)
+                        frame->totalType = NumberLong;
+                    break;
+                case NumberInt:
+                    frame->nonDecimalTotal.addDouble(operand.getInt());
+                    break;
+                case Date:
+                    uassert(16612, "only one date allowed in an $add expression", !frame->haveDate);
+                    frame->haveDate = true;
+                    frame->nonDecimalTotal.addLong(operand.getDate().toMillisSinceEpoch());
+                    break;
+                default:
+                    uassert(16554,
+                            str::stream() << "$add only supports numeric or date types, not "
+                                          << typeName(operand.getType()),
+                            operand.nullish());
+                    return Value(BSONNULL);
+            }
+            if (--frame->remainingOperands > 0)
+                return boost::none;
+
+            if (frame->haveDate) {
+                int64_t longTotal;
+                if (frame->totalType == NumberDecimal) {
+                    longTotal =
+                        frame->decimalTotal.add(frame->nonDecimalTotal.getDecimal()).toLong();
+                } else {
+                    uassert(ErrorCodes::Overflow,
+                            "date overflow in $add",
+                            frame->nonDecimalTotal.fitsLong());
+                    longTotal = frame->nonDecimalTotal.getLong();
+                }
+                return Value(Date_t::fromMillisSinceEpoch(longTotal));
+            }
+            switch (frame->totalType) {
+                case NumberDecimal:
+                    return Value(frame->decimalTotal.add(frame->nonDecimalTotal.getDecimal()));
+                case NumberLong:
+                    dassert(frame->nonDecimalTotal.isInteger());
+                    if (frame->nonDecimalTotal.fitsLong())
+                        return Value(frame->nonDecimalTotal.getLong());
+                // Fallthrough.
+                case NumberInt:
+                    if (frame->nonDecimalTotal.fitsLong())
+                        return Value::createIntOrLong(frame->nonDecimalTotal.getLong());
+                // Fallthrough.
+                case NumberDouble:
+                    return Value(frame->nonDecimalTotal.getDouble());
+                default:
+                    massert(16417, "$add resulted in a non-numeric type", false);
+            }
+            MONGO_UNREACHABLE;
+        }
+        case OpCode::kMultiply: {
+            if (operand.numeric()) {
+                BSONType oldProductType = frame->productType;
+                frame->productType = Value::getWidestNumeric(frame->productType, operand.getType());
+                if (frame->productType == NumberDecimal) {
+                    // On finding the first decimal, convert the partial product to decimal.
+                    if (oldProductType != NumberDecimal) {
+                        frame->decimalProduct = oldProductType == NumberDouble
+                            ? Decimal128(frame->doubleProduct, Decimal128::kRoundTo15Digits)
+                            : Decimal128(static_cast<int64_t>(frame->longProduct));
+                    }
+                    frame->decimalProduct =
+                        frame->decimalProduct.multiply(operand.coerceToDecimal());
+                } else {
+                    frame->doubleProduct *= operand.coerceToDouble();
+                    if (mongoSignedMultiplyOverflow64(
+                            frame->longProduct, operand.coerceToLong(), &frame->longProduct)) {
+                        // The 'longProduct' would have overflowed, so we're abandoning it.
+                        frame->productType = NumberDouble;
+                    }
+                }
+            } else if (operand.nullish()) {
+                return Value(BSONNULL);
+            } else {
+                uasserted(16555,
+                          str::stream() << "$multiply only supports numeric types, not "
+                                        << typeName(operand.getType()));
+            }
+            if (--frame->remainingOperands > 0)
+                return boost::none;
+
+            if (frame->productType == NumberDouble)
+                return Value(frame->doubleProduct);
+            else if (frame->productType == NumberLong)
+                return Value(frame->longProduct);
+            else if (frame->productType == NumberInt)
+                return Value::createIntOrLong(frame->longProduct);
+            else if (frame->productType == NumberDecimal)
+                return Value(frame->decimalProduct);
+            else
+                massert(16418, "$multiply resulted in a non-numeric type", false);
+            MONGO_UNREACHABLE;
+        }
+        case OpCode::kSubtract: {
+            if (!frame->haveFirstOperand) {
+                frame->firstOperand = std::move(operand);
+                frame->haveFirstOperand = true;
+                return boost::none;
+            }
+            Value lhs = std::move(frame->firstOperand);
+            Value rhs = std::move(operand);
+
+            BSONType diffType = Value::getWidestNumeric(rhs.getType(), lhs.getType());
+
+            if (diffType == NumberDecimal) {
+                Decimal128 right = rhs.coerceToDecimal();
+                Decimal128 left = lhs.coerceToDecimal();
+                return Value(left.subtract(right));
+            } else if (diffType == NumberDouble) {
+                double right = rhs.coerceToDouble();
+                double left = lhs.coerceToDouble();
+                return Value(left - right);
+            } else if (diffType == NumberLong) {
+                long long right = rhs.coerceToLong();
+                long long left = lhs.coerceToLong();
+                return Value(left - right);
+            } else if (diffType == NumberInt) {
+                long long right = rhs.coerceToLong();
+                long long left = lhs.coerceToLong();
+                return Value::createIntOrLong(left - right);
+            } else if (lhs.nullish() || rhs.nullish()) {
+                return Value(BSONNULL);
+            } else if (lhs.getType() == Date) {
+                if (rhs.getType() == Date) {
+                    return Value(durationCount<Milliseconds>(lhs.getDate() - rhs.getDate()));
+                } else if (rhs.numeric()) {
+                    return Value(lhs.getDate() - Milliseconds(rhs.coerceToLong()));
+                } else {
+                    uasserted(16613,
+                              str::stream() << "cant $subtract a " << typeName(rhs.getType())
+                                            << " from a Date");
+                }
+            } else {
+                uasserted(16556,
+                          str::stream() << "cant $subtract a" << typeName(rhs.getType())
+                                        << " from a "
+                                        << typeName(lhs.getType()));
+            }
+        }
+        case OpCode::kCompare: {
+            if (!frame->haveFirstOperand) {
+                frame->firstOperand = std::move(operand);
+                frame->haveFirstOperand = true;
+                return boost::none;
+            }
+
+            int cmp = _expCtx->getValueComparator().compare(frame->firstOperand, operand);
+
+            // Make cmp one of 1, 0, or -1.
+            if (cmp == 0) {
+                // leave as 0
+            } else if (cmp < 0) {
+                cmp = -1;
+            } else if (cmp > 0) {
+                cmp = 1;
+            }
+
+            switch (frame->instruction->cmpOp) {
+                case ExpressionCompare::EQ:
+                    return Value(cmp == 0);
+                case ExpressionCompare::NE:
+                    return Value(cmp != 0);
+                case ExpressionCompare::GT:
+                    return Value(cmp > 0);
+                case ExpressionCompare::GTE:
+                    return Value(cmp >= 0);
+                case ExpressionCompare::LT:
+                    return Value(cmp < 0);
+                case ExpressionCompare::LTE:
+                    return Value(cmp <= 0);
+                case ExpressionCompare::CMP:
+                    return Value(cmp);
+            }
+            MONGO_UNREACHABLE;
+        }
+        default:
+            MONGO_UNREACHABLE;
+    }
+}
+
+ExpressionCompiled::ExpressionCompiled(const intrusive_ptr<ExpressionContext>& expCtx,
+                                       const intrusive_ptr<Expression>& original,
+                                       ExpressionProgram program)
+    : Expression(expCtx), _original(original), _program(std::move(program)) {}
+
+intrusive_ptr<Expression> ExpressionCompiled::tryCompile(
+    const intrusive_ptr<Expression>& expression) {
+    if (dynamic_cast<ExpressionCompiled*>(expression.get())) {
+        return expression;
+    }
+
+    auto program = ExpressionProgram::compile(expression);
+    if (!program || program->numOperators() == 0) {
+        return expression;
+    }
+    return new ExpressionCompiled(
+        expression->getExpressionContext(), expression, std::move(*program));
+}
+
+}  // namespace mongo
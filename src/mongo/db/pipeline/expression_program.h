@@ -0,0 +1,186 @@
+/**
+ * Copyright (C) 2017 MongoDB Inc.
+ *
+ * This program is free software: you can redistribute it and/or  modify
+ * it under the terms of the GNU Affero General Public License, version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, the copyright holders give permission to link the
+ * code of portions of this program with the OpenSSL library under certain
+ * conditions as described in each individual source file and distribute
+ * linked combinations including the program with the OpenSSL library. You
+ * must comply with the GNU Affero General Public License in all respects
+ * for all of the code used other than as permitted herein. If you modify
+ * file(s) with this exception, you may extend this exception to your
+ * version of the file(s), but you are not obligated to do so. If you do not
+ * wish to do so, delete this exception statement from your version. If you
+ * delete this exception statement from all source files in the program,
+ * then also delete it in the license file.
+ */
+
+#pragma once
+
+#include <boost/intrusive_ptr.hpp>
+#include <boost/optional.hpp>
+#include <vector>
+
+#include "mongo/db/pipeline/document.h"
+#include "mongo/db/pipeline/expression.h"
+#include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/value.h"
+
+namespace mongo {
+
+/**
+ * A flattened form of an arithmetic/comparison Expression tree that evaluates without recursive
+ * virtual dispatch.
+ *
+ * The instructions are laid out in the order in which the recursive interpreter would visit the
+ * corresponding tree nodes, and are executed with an explicit stack of operator frames. Operands
+ * are folded into their operator's frame as they are produced, so evaluation order, early returns
+ * on nullish operands and the order in which invalid operands are detected all match the
+ * Expression tree the program was compiled from.
+ */
+class ExpressionProgram {
+public:
+    /**
+     * Compiles 'expression' into a linear program, or returns boost::none if the tree contains a
+     * node the compiler does not understand. Only trees built from $add, $subtract, $multiply,
+     * the comparison operators, constants and field paths are compilable.
+     *
+     * The returned program shares ownership of the leaf expressions of 'expression'.
+     */
+    static boost::optional<ExpressionProgram> compile(
+        const boost::intrusive_ptr<Expression>& expression);
+
+    /**
+     * Evaluates the program against 'root', producing the same result (or the same failure) as
+     * evaluating the tree it was compiled from.
+     */
+    Value evaluate(const Document& root) const;
+
+    /**
+     * Returns the number of operator (non-leaf) instructions in the program. A program with no
+     * operators is a single constant or field path, and gains nothing from compilation.
+     */
+    size_t numOperators() const {
+        return _numOperators;
+    }
+
+private:
+    enum class OpCode {
+        kPushConstant,  // Push a value known at compile time.
+        kPushLeaf,      // Push the result of evaluating a leaf expression, e.g. a field path.
+        kAdd,
+        kSubtract,
+        kMultiply,
+        kCompare,
+    };
+
+    struct Instruction {
+        OpCode opCode;
+
+        // The number of operand values this operator consumes. Unused by the push opcodes.
+        size_t numOperands = 0;
+
+        // The index one past this operator's last operand instruction; jumped to when an operator
+        // produces its result before consuming all of its operands. Unused by the push opcodes.
+        size_t endIndex = 0;
+
+        // The value pushed by kPushConstant.
+        Value constant;
+
+        // The expression evaluated by kPushLeaf.
+        boost::intrusive_ptr<Expression> leaf;
+
+        // The comparison performed by kCompare.
+        ExpressionCompare::CmpOp cmpOp = ExpressionCompare::EQ;
+    };
+
+    struct Frame;
+
+    /**
+     * Appends the instructions for the subtree rooted at 'expression' to 'instructions' in the
+     * order the recursive interpreter would visit the corresponding nodes: each operator
+     * immediately before its operands. Returns false if the subtree contains a node the compiler
+     * does not understand, in which case 'instructions' must be discarded.
+     */
+    static bool compileSubtree(const boost::intrusive_ptr<Expression>& expression,
+                               std::vector<Instruction>* instructions,
+                               size_t* numOperators);
+
+    ExpressionProgram(std::vector<Instruction> instructions,
+                      size_t numOperators,
+                      const boost::intrusive_ptr<ExpressionContext>& expCtx);
+
+    /**
+     * Folds 'operand' into the operator frame on top of the stack. Returns the operator's result
+     * once it has one — either because 'operand' was its last operand or because it finished
+     * early, e.g. on a nullish operand to $add — and boost::none while it needs more operands.
+     */
+    boost::optional<Value> consumeOperand(Frame* frame, Value operand) const;
+
+    std::vector<Instruction> _instructions;
+    size_t _numOperators;
+    boost::intrusive_ptr<ExpressionContext> _expCtx;
+};
+
+/**
+ * An Expression that evaluates via the ExpressionProgram compiled from another expression.
+ * Everything other than evaluation — serialization, dependency analysis, computed paths — is
+ * delegated to the original expression, so outside of evaluate() a compiled expression is
+ * indistinguishable from the tree it replaced.
+ */
+class ExpressionCompiled final : public Expression {
+public:
+    /**
+     * Returns 'expression' wrapped in an ExpressionCompiled if it compiles to a program with at
+     * least one operator, and 'expression' itself otherwise. Intended to be called on an already
+     * optimized expression, after constant folding has run.
+     */
+    static boost::intrusive_ptr<Expression> tryCompile(
+        const boost::intrusive_ptr<Expression>& expression);
+
+    boost::intrusive_ptr<Expression> optimize() final {
+        return this;
+    }
+
+    void addDependencies(DepsTracker* deps) const final {
+        _original->addDependencies(deps);
+    }
+
+    Value serialize(bool explain) const final {
+        return _original->serialize(explain);
+    }
+
+    Value evaluate(const Document& root) const final {
+        return _program.evaluate(root);
+    }
+
+    ComputedPaths getComputedPaths(const std::string& exprFieldPath,
+                                   Variables::Id renamingVar) const final {
+        return _original->getComputedPaths(exprFieldPath, renamingVar);
+    }
+
+    const boost::intrusive_ptr<Expression>& getOriginal() const {
+        return _original;
+    }
+
+private:
+    ExpressionCompiled(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                       const boost::intrusive_ptr<Expression>& original,
+                       ExpressionProgram program);
+
+    boost::intrusive_ptr<Expression> _original;
+    ExpressionProgram _program;
+};
+
+}  // namespace mongo
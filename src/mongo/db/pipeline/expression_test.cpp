@@ -38,6 +38,7 @@
 #include "mongo/db/pipeline/document_value_test_util.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/pipeline/expression_program.h"
 #include "mongo/db/pipeline/value_comparator.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/unittest/unittest.h"
@@ -2112,6 +2113,117 @@ TEST(ExpressionConstantTest, ConstantOfValueMissingSerializesToRemoveSystemVar)
 
 }  // namespace Constant
 
+namespace Compiled {
+
+/** Parses the expression in 'specObject' and optimizes it, without compiling it. */
+intrusive_ptr<Expression> parseAndOptimize(const intrusive_ptr<ExpressionContextForTest>& expCtx,
+                                           BSONObj specObject) {
+    BSONElement specElement = specObject.firstElement();
+    VariablesParseState vps = expCtx->variablesParseState;
+    return Expression::parseOperand(expCtx, specElement, vps)->optimize();
+}
+
+TEST(ExpressionCompiledTest, CompiledResultMatchesInterpretedResult) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression = parseAndOptimize(
+        expCtx,
+        BSON("" << BSON("$add" << BSON_ARRAY(BSON("$multiply" << BSON_ARRAY("$a"
+                                                                            << "$b"))
+                                             << BSON("$subtract" << BSON_ARRAY("$c" << 2))
+                                             << 1))));
+    auto compiled = ExpressionCompiled::tryCompile(expression);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(compiled.get()));
+
+    auto input = fromBson(BSON("a" << 3 << "b" << 4 << "c" << 5));
+    ASSERT_VALUE_EQ(compiled->evaluate(input), expression->evaluate(input));
+    ASSERT_VALUE_EQ(compiled->evaluate(input), Value(16));
+}
+
+TEST(ExpressionCompiledTest, ComparisonOperatorsCompile) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression = parseAndOptimize(expCtx,
+                                       BSON("" << BSON("$lt" << BSON_ARRAY("$a"
+                                                                           << "$b"))));
+    auto compiled = ExpressionCompiled::tryCompile(expression);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(compiled.get()));
+
+    ASSERT_VALUE_EQ(compiled->evaluate(fromBson(BSON("a" << 1 << "b" << 2))), Value(true));
+    ASSERT_VALUE_EQ(compiled->evaluate(fromBson(BSON("a" << 2 << "b" << 1))), Value(false));
+}
+
+TEST(ExpressionCompiledTest, NullishOperandProducesNull) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression = parseAndOptimize(expCtx,
+                                       BSON("" << BSON("$add" << BSON_ARRAY("$a"
+                                                                            << "$missing"))));
+    auto compiled = ExpressionCompiled::tryCompile(expression);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(compiled.get()));
+
+    ASSERT_VALUE_EQ(compiled->evaluate(fromBson(BSON("a" << 1))), Value(BSONNULL));
+}
+
+TEST(ExpressionCompiledTest, NonNumericOperandFailsToEvaluate) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression = parseAndOptimize(expCtx,
+                                       BSON("" << BSON("$multiply" << BSON_ARRAY("$a" << 2))));
+    auto compiled = ExpressionCompiled::tryCompile(expression);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(compiled.get()));
+
+    ASSERT_THROWS(compiled->evaluate(fromBson(BSON("a"
+                                                   << "foo"))),
+                  UserException);
+}
+
+TEST(ExpressionCompiledTest, LeavesUnsupportedExpressionsUnchanged) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto concat = parseAndOptimize(expCtx,
+                                   BSON("" << BSON("$concat" << BSON_ARRAY("$a"
+                                                                           << "$b"))));
+    ASSERT_EQUALS(ExpressionCompiled::tryCompile(concat).get(), concat.get());
+
+    // A bare field path has no operators, so there is nothing to gain from compiling it.
+    auto fieldPath = parseAndOptimize(expCtx,
+                                      BSON(""
+                                           << "$a"));
+    ASSERT_EQUALS(ExpressionCompiled::tryCompile(fieldPath).get(), fieldPath.get());
+}
+
+TEST(ExpressionCompiledTest, SerializesAsOriginalExpression) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression = parseAndOptimize(expCtx,
+                                       BSON("" << BSON("$subtract" << BSON_ARRAY("$a"
+                                                                                 << "$b"))));
+    auto compiled = ExpressionCompiled::tryCompile(expression);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(compiled.get()));
+
+    ASSERT_VALUE_EQ(compiled->serialize(false), expression->serialize(false));
+}
+
+TEST(ExpressionCompiledTest, ObjectOptimizeCompilesComputedChildren) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto object = ExpressionObject::parse(expCtx,
+                                          BSON("total" << BSON("$add" << BSON_ARRAY("$a"
+                                                                                    << "$b"))
+                                                       << "name"
+                                                       << "$n"),
+                                          vps);
+    auto optimized = object->optimize();
+    auto optimizedObject = dynamic_cast<ExpressionObject*>(optimized.get());
+    ASSERT(optimizedObject);
+
+    auto&& children = optimizedObject->getChildExpressions();
+    ASSERT_EQUALS(children.size(), 2U);
+    ASSERT(dynamic_cast<ExpressionCompiled*>(children[0].second.get()));
+    ASSERT(dynamic_cast<ExpressionFieldPath*>(children[1].second.get()));
+
+    ASSERT_VALUE_EQ(optimized->evaluate(fromBson(BSON("a" << 1 << "b" << 2 << "n"
+                                                          << "x"))),
+                    Value(Document{{"total", 3}, {"name", "x"_sd}}));
+}
+
+}  // namespace Compiled
+
 TEST(ExpressionFromAccumulators, Avg) {
     assertExpectedResults("$avg",
                           {// $avg ignores non-numeric inputs.
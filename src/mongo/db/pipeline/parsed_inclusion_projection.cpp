@@ -32,6 +32,8 @@
 
 #include <algorithm>
 
+#include "mongo/db/pipeline/expression_program.h"
+
 namespace mongo {
 
 namespace parsed_aggregation_projection {
@@ -47,7 +49,10 @@ InclusionNode::InclusionNode(std::string pathToNode) : _pathToNode(std::move(pat
 
 void InclusionNode::optimize() {
     for (auto&& expressionIt : _expressions) {
-        _expressions[expressionIt.first] = expressionIt.second->optimize();
+        // Computed projection fields are evaluated once per input document, so lower them to
+        // flattened programs where the expression compiler understands them.
+        _expressions[expressionIt.first] =
+            ExpressionCompiled::tryCompile(expressionIt.second->optimize());
     }
     for (auto&& childPair : _children) {
         childPair.second->optimize();
@@ -38,6 +38,7 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/database.h"
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/client_memory_ledger.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/db_raii.h"
@@ -254,6 +255,7 @@ public:
             infoBuilder.append("host", hostName);
 
             client->reportState(infoBuilder);
+            ClientMemoryLedger::get(client).report(&infoBuilder);
 
             const auto& clientMetadata =
                 ClientMetadataIsMasterState::get(client).getClientMetadata();
@@ -49,12 +49,7 @@ boost::intrusive_ptr<TeeBuffer> TeeBuffer::create(size_t nConsumers, int bufferS
 }
 
 DocumentSource::GetNextResult TeeBuffer::getNext(size_t consumerId) {
-    size_t nConsumersStillProcessingThisBatch =
-        std::count_if(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
-            return info.nLeftToReturn > 0;
-        });
-
-    if (_buffer.empty() || nConsumersStillProcessingThisBatch == 0) {
+    if (_buffer.empty() || _nConsumersStillProcessing == 0) {
         loadNextBatch();
     }
 
@@ -70,7 +65,9 @@ DocumentSource::GetNextResult TeeBuffer::getNext(size_t consumerId) {
     }
 
     const size_t bufferIndex = _buffer.size() - _consumers[consumerId].nLeftToReturn;
-    --_consumers[consumerId].nLeftToReturn;
+    if (--_consumers[consumerId].nLeftToReturn == 0) {
+        --_nConsumersStillProcessing;
+    }
 
     return _buffer[bufferIndex];
 }
@@ -96,9 +93,13 @@ void TeeBuffer::loadNextBatch() {
     invariant(!input.isPaused());
 
     // Populate the pending returns.
+    _nConsumersStillProcessing = 0;
     for (size_t consumerId = 0; consumerId < _consumers.size(); ++consumerId) {
         if (_consumers[consumerId].stillInUse) {
             _consumers[consumerId].nLeftToReturn = _buffer.size();
+            if (!_buffer.empty()) {
+                ++_nConsumersStillProcessing;
+            }
         }
     }
 }
@@ -64,7 +64,10 @@ public:
      */
     void dispose(size_t consumerId) {
         _consumers[consumerId].stillInUse = false;
-        _consumers[consumerId].nLeftToReturn = 0;
+        if (_consumers[consumerId].nLeftToReturn > 0) {
+            _consumers[consumerId].nLeftToReturn = 0;
+            --_nConsumersStillProcessing;
+        }
         if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
                 return info.stillInUse;
             })) {
@@ -102,5 +105,10 @@ private:
         int nLeftToReturn = 0;
     };
     std::vector<ConsumerInfo> _consumers;
+
+    // The number of consumers with 'nLeftToReturn' > 0. Kept up to date incrementally so that
+    // getNext(), which every consumer calls once per buffered document, does not rescan
+    // '_consumers' to decide whether the batch has been fully consumed.
+    size_t _nConsumersStillProcessing = 0;
 };
 }  // namespace mongo
@@ -271,6 +271,15 @@ void Explain::statsToBSON(const PlanStageStats& stats,
     if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
         bob->appendNumber("nReturned", stats.common.advanced);
         bob->appendNumber("executionTimeMillisEstimate", stats.common.executionTimeMillis);
+        if (stats.common.timedWorks > 0) {
+            // Sampled tick-source timing scaled up to cover every work() call; see
+            // PlanStage::work() for the sampling policy.
+            const double scale =
+                static_cast<double>(stats.common.works) / stats.common.timedWorks;
+            bob->appendNumber(
+                "executionTimeNanosEstimate",
+                static_cast<long long>(stats.common.executionTimeNanosSampled * scale));
+        }
         bob->appendNumber("works", stats.common.works);
         bob->appendNumber("advanced", stats.common.advanced);
         bob->appendNumber("needTime", stats.common.needTime);
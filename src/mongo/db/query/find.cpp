@@ -50,8 +50,10 @@
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/internal_plans.h"
+#include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/query_planner_params.h"
+#include "mongo/db/query/query_shape_stats.h"
 #include "mongo/db/repl/replication_coordinator_global.h"
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/server_options.h"
@@ -154,7 +156,19 @@ void endQueryOp(OperationContext* opCtx,
     curOp->debug().setPlanSummaryMetrics(summaryStats);
 
     if (collection) {
-        collection->infoCache()->notifyOfQuery(opCtx, summaryStats.indexesUsed);
+        collection->infoCache()->notifyOfQuery(opCtx, summaryStats);
+
+        // Fold this query into the per-shape metrics registry. Internally generated plans
+        // (e.g. oplog scans) have no canonical query and are not tracked.
+        if (const CanonicalQuery* cq = exec.getCanonicalQuery()) {
+            QueryShapeStats::get(opCtx->getServiceContext())
+                .record(collection->ns().ns(),
+                        collection->infoCache()->getPlanCache()->computeKey(*cq),
+                        cq->getQueryObj(),
+                        durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()),
+                        summaryStats.totalKeysExamined,
+                        summaryStats.totalDocsExamined);
+        }
     }
 
     if (curOp->shouldDBProfile()) {
@@ -48,7 +48,6 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
-#include "mongo/util/transitional_tools_do_not_use/vector_spooling.h"
 
 namespace mongo {
 namespace {
@@ -324,29 +323,22 @@ bool PlanCache::shouldCacheQuery(const CanonicalQuery& query) {
 //
 
 CachedSolution::CachedSolution(const PlanCacheKey& key, const PlanCacheEntry& entry)
-    : plannerData(entry.plannerData.size()),
+    : plannerData(entry.plannerData),
       key(key),
       query(entry.query.getOwned()),
       sort(entry.sort.getOwned()),
       projection(entry.projection.getOwned()),
       collation(entry.collation.getOwned()),
       decisionWorks(entry.decision->stats[0]->common.works) {
-    // CachedSolution should not having any references into
-    // cache entry. All relevant data should be cloned/copied.
-    for (size_t i = 0; i < entry.plannerData.size(); ++i) {
-        verify(entry.plannerData[i]);
-        plannerData[i] = entry.plannerData[i]->clone();
+    // The planner data is immutable once cached, so sharing it with the entry is safe even
+    // after the entry itself is evicted or replaced. The BSON query shape members are deep
+    // copied since the entry owns their buffers.
+    for (size_t i = 0; i < plannerData.size(); ++i) {
+        verify(plannerData[i]);
     }
 }
 
-CachedSolution::~CachedSolution() {
-    for (std::vector<SolutionCacheData*>::const_iterator i = plannerData.begin();
-         i != plannerData.end();
-         ++i) {
-        SolutionCacheData* scd = *i;
-        delete scd;
-    }
-}
+CachedSolution::~CachedSolution() {}
 
 //
 // PlanCacheEntry
@@ -364,28 +356,25 @@ PlanCacheEntry::PlanCacheEntry(const std::vector<QuerySolution*>& solutions,
     // Copy the solution's cache data into the plan cache entry.
     for (size_t i = 0; i < solutions.size(); ++i) {
         invariant(solutions[i]->cacheData.get());
-        plannerData[i] = solutions[i]->cacheData->clone();
+        plannerData[i].reset(solutions[i]->cacheData->clone());
     }
 }
 
+PlanCacheEntry::PlanCacheEntry(std::vector<std::shared_ptr<const SolutionCacheData>> plannerData,
+                               PlanRankingDecision* why)
+    : plannerData(std::move(plannerData)), decision(why) {
+    invariant(why);
+}
+
 PlanCacheEntry::~PlanCacheEntry() {
     for (size_t i = 0; i < feedback.size(); ++i) {
         delete feedback[i];
     }
-    for (size_t i = 0; i < plannerData.size(); ++i) {
-        delete plannerData[i];
-    }
 }
 
 PlanCacheEntry* PlanCacheEntry::clone() const {
-    std::vector<std::unique_ptr<QuerySolution>> solutions;
-    for (size_t i = 0; i < plannerData.size(); ++i) {
-        auto qs = stdx::make_unique<QuerySolution>();
-        qs->cacheData.reset(plannerData[i]->clone());
-        solutions.push_back(std::move(qs));
-    }
-    PlanCacheEntry* entry = new PlanCacheEntry(
-        transitional_tools_do_not_use::unspool_vector(solutions), decision->clone());
+    // The immutable planner data is shared rather than deep copied.
+    PlanCacheEntry* entry = new PlanCacheEntry(plannerData, decision->clone());
 
     // Copy query shape.
     entry->query = query.getOwned();
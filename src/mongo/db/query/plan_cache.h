@@ -29,6 +29,7 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <set>
 
 #include "mongo/db/exec/plan_stats.h"
@@ -201,8 +202,9 @@ public:
     CachedSolution(const PlanCacheKey& key, const PlanCacheEntry& entry);
     ~CachedSolution();
 
-    // Owned here.
-    std::vector<SolutionCacheData*> plannerData;
+    // Shared with the PlanCacheEntry this solution was created from. SolutionCacheData is
+    // immutable once cached, so sharing avoids deep-copying the index tree on every cache hit.
+    std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // Key used to provide feedback on the entry.
     PlanCacheKey key;
@@ -254,9 +256,9 @@ public:
     //
 
     // Data provided to the planner to allow it to recreate the solutions this entry
-    // represents. Each SolutionCacheData is fully owned here, so in order to return
-    // it from the cache a deep copy is made and returned inside CachedSolution.
-    std::vector<SolutionCacheData*> plannerData;
+    // represents. Each SolutionCacheData is immutable once cached and is shared,
+    // refcounted, with the CachedSolutions returned from the cache.
+    std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // TODO: Do we really want to just hold a copy of the CanonicalQuery?  For now we just
     // extract the data we need.
@@ -279,6 +281,14 @@ public:
     // Annotations from cached runs.  The CachedPlanStage provides these stats about its
     // runs when they complete.
     std::vector<PlanCacheEntryFeedback*> feedback;
+
+private:
+    /**
+     * All-member constructor used by clone(). Shares the immutable planner data rather than
+     * deep-copying it.
+     */
+    PlanCacheEntry(std::vector<std::shared_ptr<const SolutionCacheData>> plannerData,
+                   PlanRankingDecision* why);
 };
 
 /**
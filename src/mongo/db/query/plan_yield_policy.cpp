@@ -118,10 +118,18 @@ bool PlanYieldPolicy::yield(stdx::function<void()> beforeYieldingFn,
                 // Just reset the snapshot. Leave all LockManager locks alone.
                 opCtx->recoveryUnit()->abandonSnapshot();
             } else {
+                // A read from the majority committed snapshot sees the same data whether its
+                // snapshot is reopened or not, so the yield only needs to release lock manager
+                // resources. Keeping the snapshot open skips the reopen on restore; executor
+                // state is still saved and restored since the yield permits catalog changes.
+                const bool retainSnapshot =
+                    internalQueryExecYieldRetainCommittedSnapshot.load() &&
+                    opCtx->recoveryUnit()->isReadingFromMajorityCommittedSnapshot();
+
                 // Release and reacquire locks.
                 if (beforeYieldingFn)
                     beforeYieldingFn();
-                QueryYield::yieldAllLocks(opCtx, whileYieldingFn, _planYielding->nss());
+                QueryYield::yieldAllLocks(opCtx, whileYieldingFn, _planYielding->nss(), retainSnapshot);
             }
 
             return _planYielding->restoreStateWithoutRetrying();
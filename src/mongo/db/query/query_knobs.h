@@ -48,6 +48,10 @@ extern AtomicDouble internalQueryPlanEvaluationCollFraction;
 // Stop working plans once a plan returns this many results.
 extern AtomicInt32 internalQueryPlanEvaluationMaxResults;
 
+// Do we stop working candidate plans whose productivity has fallen far behind the
+// current leader's before the trial period ends?
+extern AtomicBool internalQueryPlanEvaluationEarlyElimination;
+
 // Do we give a big ranking bonus to intersection plans?
 extern AtomicBool internalQueryForceIntersectionPlans;
 
@@ -107,6 +111,15 @@ extern AtomicInt32 internalQueryExecYieldIterations;
 // Yield if it's been at least this many milliseconds since we last yielded.
 extern AtomicInt32 internalQueryExecYieldPeriodMS;
 
+// Time every Nth work() call per stage with the tick source to build the nanosecond-resolution
+// per-stage time estimates reported by explain. Values <= 0 turn the sampling off.
+extern AtomicInt32 internalQueryExecStageTimingSampleInterval;
+
+// Keep the storage engine snapshot open across yields for plans reading from the majority
+// committed snapshot. Such reads see the same data either way, so the yield only needs to
+// release lock manager resources; skipping the snapshot reopen makes their yields cheaper.
+extern AtomicBool internalQueryExecYieldRetainCommittedSnapshot;
+
 // Limit the size that we write without yielding to 16MB / 64 (max expected number of indexes)
 const int64_t insertVectorMaxBytes = 256 * 1024;
 
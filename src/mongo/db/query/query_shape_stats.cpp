@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query/query_shape_stats.h"
+
+#include <algorithm>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+namespace {
+
+const auto getQueryShapeStats = ServiceContext::declareDecoration<QueryShapeStats>();
+
+/**
+ * Returns the index of the histogram bucket whose range contains 'micros'.
+ */
+size_t latencyBucketFor(long long micros) {
+    const auto& bounds = OperationLatencyHistogram::kLowerBounds;
+    return std::upper_bound(bounds.begin(), bounds.end(), static_cast<uint64_t>(micros)) -
+        bounds.begin() - 1;
+}
+
+}  // namespace
+
+// static
+QueryShapeStats& QueryShapeStats::get(ServiceContext* service) {
+    return getQueryShapeStats(service);
+}
+
+void QueryShapeStats::record(StringData ns,
+                             StringData shapeKey,
+                             const BSONObj& representativeQuery,
+                             long long micros,
+                             long long keysExamined,
+                             long long docsExamined) {
+    std::string key;
+    key.reserve(ns.size() + 1 + shapeKey.size());
+    key.append(ns.rawData(), ns.size());
+    key.push_back('|');
+    key.append(shapeKey.rawData(), shapeKey.size());
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _shapes.find(StringData(key));
+    if (it == _shapes.end()) {
+        if (_shapes.size() >= kMaxTrackedShapes) {
+            _untracked++;
+            return;
+        }
+        it = _shapes.try_emplace(StringData(key)).first;
+        it->second.ns = ns.toString();
+        it->second.representativeQuery = representativeQuery.getOwned();
+    }
+
+    ShapeMetrics& metrics = it->second;
+    metrics.count++;
+    metrics.totalMicros += micros;
+    metrics.maxMicros = std::max(metrics.maxMicros, micros);
+    metrics.totalKeysExamined += keysExamined;
+    metrics.totalDocsExamined += docsExamined;
+    metrics.latencyBuckets[latencyBucketFor(micros)]++;
+}
+
+void QueryShapeStats::append(BSONObjBuilder* builder) const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    builder->appendNumber("numShapes", static_cast<long long>(_shapes.size()));
+    builder->appendNumber("untracked", _untracked);
+
+    BSONArrayBuilder shapes(builder->subarrayStart("shapes"));
+    for (auto&& entry : _shapes) {
+        const ShapeMetrics& metrics = entry.second;
+        BSONObjBuilder shape(shapes.subobjStart());
+        shape.append("ns", metrics.ns);
+        shape.append("query", metrics.representativeQuery);
+        shape.appendNumber("count", metrics.count);
+        shape.appendNumber("totalMicros", metrics.totalMicros);
+        shape.appendNumber("maxMicros", metrics.maxMicros);
+        shape.appendNumber("totalKeysExamined", metrics.totalKeysExamined);
+        shape.appendNumber("totalDocsExamined", metrics.totalDocsExamined);
+        {
+            BSONArrayBuilder histogram(shape.subarrayStart("latencyHistogram"));
+            for (size_t i = 0; i < metrics.latencyBuckets.size(); i++) {
+                if (metrics.latencyBuckets[i] == 0) {
+                    continue;
+                }
+                BSONObjBuilder bucket(histogram.subobjStart());
+                bucket.appendNumber(
+                    "micros", static_cast<long long>(OperationLatencyHistogram::kLowerBounds[i]));
+                bucket.appendNumber("count", metrics.latencyBuckets[i]);
+            }
+        }
+    }
+}
+
+}  // namespace mongo
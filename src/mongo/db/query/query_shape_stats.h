@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class ServiceContext;
+
+/**
+ * A bounded registry of execution metrics keyed by query shape, where the shape is the plan
+ * cache key of the canonical query (match/sort/projection structure plus index
+ * compatibility). Find operations report their latency and examined counts here on
+ * completion, so regressed shapes can be found with the 'queryShapeStats' command instead of
+ * by scraping slow-op log lines.
+ */
+class QueryShapeStats {
+    MONGO_DISALLOW_COPYING(QueryShapeStats);
+
+public:
+    // Once this many distinct shapes are tracked, further shapes are counted but not itemized.
+    static const size_t kMaxTrackedShapes = 1024;
+
+    struct ShapeMetrics {
+        // The namespace and the first query observed with this shape, kept for readability;
+        // the shape key itself is an opaque encoding.
+        std::string ns;
+        BSONObj representativeQuery;
+
+        long long count = 0;
+        long long totalMicros = 0;
+        long long maxMicros = 0;
+        long long totalKeysExamined = 0;
+        long long totalDocsExamined = 0;
+
+        // Latency histogram over the same bucket bounds as the global operation histogram.
+        std::array<long long, OperationLatencyHistogram::kMaxBuckets> latencyBuckets{};
+    };
+
+    QueryShapeStats() = default;
+
+    /**
+     * Retrieves the QueryShapeStats decoration on 'service'.
+     */
+    static QueryShapeStats& get(ServiceContext* service);
+
+    /**
+     * Folds one completed query into the metrics for ('ns', 'shapeKey').
+     * 'representativeQuery' is retained (owned) only for the first sighting of a shape.
+     */
+    void record(StringData ns,
+                StringData shapeKey,
+                const BSONObj& representativeQuery,
+                long long micros,
+                long long keysExamined,
+                long long docsExamined);
+
+    /**
+     * Appends all tracked shapes and their metrics to 'builder'.
+     */
+    void append(BSONObjBuilder* builder) const;
+
+private:
+    mutable stdx::mutex _mutex;
+
+    // Keyed by "<ns>|<shapeKey>".
+    StringMap<ShapeMetrics> _shapes;
+
+    // Number of queries not itemized because the registry was at capacity.
+    long long _untracked = 0;
+};
+
+}  // namespace mongo
@@ -46,7 +46,8 @@ MONGO_FP_DECLARE(setYieldAllLocksWait);
 // static
 void QueryYield::yieldAllLocks(OperationContext* opCtx,
                                stdx::function<void()> whileYieldingFn,
-                               const NamespaceString& planExecNS) {
+                               const NamespaceString& planExecNS,
+                               bool retainStorageSnapshot) {
     // Things have to happen here in a specific order:
     //   * Release lock mgr locks
     //   * Go to sleep
@@ -63,8 +64,11 @@ void QueryYield::yieldAllLocks(OperationContext* opCtx,
     }
 
     // Top-level locks are freed, release any potential low-level (storage engine-specific
-    // locks). If we are yielding, we are at a safe place to do so.
-    opCtx->recoveryUnit()->abandonSnapshot();
+    // locks). If we are yielding, we are at a safe place to do so. Snapshot-stable reads may
+    // instead keep the snapshot open, since reopening it would expose the same data.
+    if (!retainStorageSnapshot) {
+        opCtx->recoveryUnit()->abandonSnapshot();
+    }
 
     // Track the number of yields in CurOp.
     CurOp::get(opCtx)->yielded();
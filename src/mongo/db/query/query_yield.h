@@ -50,10 +50,15 @@ public:
      * If in a nested context (eg DBDirectClient), does nothing.
      *
      * The whileYieldingFn will be executed after unlocking the locks and before re-acquiring them.
+     *
+     * If 'retainStorageSnapshot' is true, the storage engine snapshot is kept open across the
+     * yield instead of being abandoned. Only valid for reads whose visible data cannot change
+     * with a new snapshot, i.e. reads from the majority committed snapshot.
      */
     static void yieldAllLocks(OperationContext* opCtx,
                               stdx::function<void()> whileYieldingFn,
-                              const NamespaceString& planExecNS);
+                              const NamespaceString& planExecNS,
+                              bool retainStorageSnapshot = false);
 };
 
 }  // namespace mongo
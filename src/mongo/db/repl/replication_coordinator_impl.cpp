@@ -199,28 +199,21 @@ private:
 };
 
 void ReplicationCoordinatorImpl::WaiterList::add_inlock(WaiterType waiter) {
-    _list.push_back(waiter);
+    _waiters.emplace(waiter->opTime, waiter);
 }
 
 void ReplicationCoordinatorImpl::WaiterList::signalAndRemoveIf_inlock(
-    stdx::function<bool(WaiterType)> func) {
-    // Only advance iterator when the element doesn't match.
-    for (auto it = _list.begin(); it != _list.end();) {
-        if (!func(*it)) {
+    stdx::function<bool(WaiterType)> func, boost::optional<OpTime> opTime) {
+    // The waiters are sorted by the optime they wait on, so once we pass "opTime" every
+    // remaining waiter is waiting on an optime that has not been reached and can be skipped.
+    for (auto it = _waiters.begin(); it != _waiters.end() && (!opTime || it->first <= *opTime);) {
+        if (!func(it->second)) {
             ++it;
             continue;
         }
 
-        WaiterType waiter = std::move(*it);
-        if (it == std::prev(_list.end())) {
-            // Iterator will be invalid after erasing the last element, so set it to the
-            // next one (i.e. end()).
-            it = _list.erase(it);
-        } else {
-            // Iterator is still valid after pop_back().
-            std::swap(*it, _list.back());
-            _list.pop_back();
-        }
+        WaiterType waiter = it->second;
+        it = _waiters.erase(it);
 
         // It's important to call notify() after the waiter has been removed from the list
         // since notify() might remove the waiter itself.
@@ -229,21 +222,23 @@ void ReplicationCoordinatorImpl::WaiterList::signalAndRemoveIf_inlock(
 }
 
 void ReplicationCoordinatorImpl::WaiterList::signalAndRemoveAll_inlock() {
-    std::vector<WaiterType> list = std::move(_list);
+    std::multimap<OpTime, WaiterType> waiters;
+    _waiters.swap(waiters);
     // Call notify() after removing the waiters from the list.
-    for (auto& waiter : list) {
-        waiter->notify_inlock();
+    for (auto& entry : waiters) {
+        entry.second->notify_inlock();
     }
 }
 
 bool ReplicationCoordinatorImpl::WaiterList::remove_inlock(WaiterType waiter) {
-    auto it = std::find(_list.begin(), _list.end(), waiter);
-    if (it == _list.end()) {
-        return false;
+    auto range = _waiters.equal_range(waiter->opTime);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == waiter) {
+            _waiters.erase(it);
+            return true;
+        }
     }
-    std::swap(*it, _list.back());
-    _list.pop_back();
-    return true;
+    return false;
 }
 
 namespace {
@@ -1034,8 +1029,9 @@ void ReplicationCoordinatorImpl::_setMyLastAppliedOpTime_inlock(const OpTime& op
     invariant(isRollbackAllowed || myMemberData->getLastAppliedOpTime() <= opTime);
     myMemberData->setLastAppliedOpTime(opTime, _replExecutor->now());
     _updateLastCommittedOpTime_inlock();
-    _opTimeWaiterList.signalAndRemoveIf_inlock(
-        [opTime](Waiter* waiter) { return waiter->opTime <= opTime; });
+    // The list is sorted by the waited-on optime, so the bound alone selects exactly the
+    // newly satisfied waiters.
+    _opTimeWaiterList.signalAndRemoveIf_inlock([](Waiter*) { return true; }, opTime);
 }
 
 void ReplicationCoordinatorImpl::_setMyLastDurableOpTime_inlock(const OpTime& opTime,
@@ -2672,6 +2668,11 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig_inlock(const ReplSetConfig& newC
     }
     _updateLastCommittedOpTime_inlock();
 
+    // A config change can make a write concern unsatisfiable, which counts as done waiting.
+    // That does not depend on replication progress, so rescan the whole waiter list rather
+    // than the optime-bounded prefix examined on progress updates.
+    _wakeReadyWaiters_inlock();
+
     // Set election id if we're primary.
     if (oldConfig.isInitialized() && _memberState.primary()) {
         if (oldConfig.getProtocolVersion() > newConfig.getProtocolVersion()) {
@@ -2693,11 +2694,13 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig_inlock(const ReplSetConfig& newC
     return action;
 }
 
-void ReplicationCoordinatorImpl::_wakeReadyWaiters_inlock() {
-    _replicationWaiterList.signalAndRemoveIf_inlock([this](Waiter* waiter) {
-        return _doneWaitingForReplication_inlock(
-            waiter->opTime, SnapshotName::min(), *waiter->writeConcern);
-    });
+void ReplicationCoordinatorImpl::_wakeReadyWaiters_inlock(boost::optional<OpTime> opTime) {
+    _replicationWaiterList.signalAndRemoveIf_inlock(
+        [this](Waiter* waiter) {
+            return _doneWaitingForReplication_inlock(
+                waiter->opTime, SnapshotName::min(), *waiter->writeConcern);
+        },
+        opTime);
 }
 
 Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(
@@ -2932,8 +2935,10 @@ void ReplicationCoordinatorImpl::_updateLastCommittedOpTime_inlock() {
     // Wake up any threads waiting for replication that now have their replication
     // check satisfied.  We must do this regardless of whether we updated the lastCommittedOpTime,
     // as lastCommittedOpTime may be based on durable optimes whereas some waiters may be
-    // waiting on applied (but not necessarily durable) optimes.
-    _wakeReadyWaiters_inlock();
+    // waiting on applied (but not necessarily durable) optimes.  No write concern can be
+    // satisfied past the greatest applied optime any node has reported, so bound the scan
+    // of the optime-ordered waiter list there.
+    _wakeReadyWaiters_inlock(_topCoord->latestKnownAppliedOpTime());
 }
 
 void ReplicationCoordinatorImpl::advanceCommitPoint(const OpTime& committedOpTime) {
@@ -3272,8 +3277,9 @@ void ReplicationCoordinatorImpl::_updateCommittedSnapshot_inlock(
 
     _externalState->updateCommittedSnapshot(newCommittedSnapshot.name);
 
-    // Wake up any threads waiting for read concern or write concern.
-    _wakeReadyWaiters_inlock();
+    // Wake up any threads waiting for read concern or write concern.  A committed snapshot
+    // advance can only newly satisfy waiters up to the snapshot's optime.
+    _wakeReadyWaiters_inlock(newCommittedSnapshot.opTime);
 }
 
 void ReplicationCoordinatorImpl::dropAllSnapshots() {
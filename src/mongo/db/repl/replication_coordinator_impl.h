@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -532,13 +533,19 @@ private:
         void add_inlock(WaiterType waiter);
         // Returns whether waiter is found and removed.
         bool remove_inlock(WaiterType waiter);
-        // Signals and removes all waiters that satisfy the condition.
-        void signalAndRemoveIf_inlock(stdx::function<bool(WaiterType)> fun);
+        // Signals and removes all waiters that satisfy the condition. If "opTime" is given,
+        // only waiters waiting on an optime less than or equal to it are examined; since no
+        // waiter can become ready before the optime it waits on is reached, callers pass the
+        // optime that progress just advanced to so that unaffected waiters are never scanned.
+        void signalAndRemoveIf_inlock(stdx::function<bool(WaiterType)> fun,
+                                      boost::optional<OpTime> opTime = boost::none);
         // Signals and removes all waiters from the list.
         void signalAndRemoveAll_inlock();
 
     private:
-        std::vector<WaiterType> _list;
+        // Waiters sorted by the optime they are waiting on, so that progress updates only
+        // examine the prefix of waiters whose target optime has been reached.
+        std::multimap<OpTime, WaiterType> _waiters;
     };
 
     typedef std::vector<executor::TaskExecutor::CallbackHandle> HeartbeatHandles;
@@ -615,8 +622,10 @@ private:
 
     /**
      * Helper to wake waiters in _replicationWaiterList that are doneWaitingForReplication.
+     * If "opTime" is given, only waiters waiting on an optime less than or equal to it are
+     * examined; callers pass the greatest optime the triggering event could have satisfied.
      */
-    void _wakeReadyWaiters_inlock();
+    void _wakeReadyWaiters_inlock(boost::optional<OpTime> opTime = boost::none);
 
     /**
      * Scheduled to cause the ReplicationCoordinator to reconsider any state that might
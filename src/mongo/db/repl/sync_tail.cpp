@@ -781,11 +781,11 @@ void SyncTail::oplogApplication(ReplicationCoordinator* replCoord) {
             continue;  // Try again.
         }
 
-        // Extract some info from ops that we'll need after releasing the batch below.
-        const auto firstOpTimeInBatch =
-            fassertStatusOK(40299, OpTime::parseFromOplogEntry(ops.front().raw));
-        const auto lastOpTimeInBatch =
-            fassertStatusOK(28773, OpTime::parseFromOplogEntry(ops.back().raw));
+        // Extract some info from ops that we'll need after releasing the batch below. The
+        // entries were already parsed when they were batched, so use their materialized
+        // fields rather than re-parsing the raw BSON.
+        const auto firstOpTimeInBatch = ops.front().getOpTime();
+        const auto lastOpTimeInBatch = ops.back().getOpTime();
 
         // Make sure the oplog doesn't go back in time or repeat an entry.
         if (firstOpTimeInBatch <= replCoord->getMyLastAppliedOpTime()) {
@@ -388,6 +388,14 @@ public:
                                               const ReplSetTagPattern& tagPattern,
                                               bool durablyWritten) = 0;
 
+    /**
+     * Returns the greatest optime that any node, including this one, is known to have
+     * applied, as reported through heartbeats and replSetUpdatePosition. No write concern
+     * can be satisfied for an optime past this, so callers may use it to bound scans over
+     * waiters ordered by the optime they wait on.
+     */
+    virtual OpTime latestKnownAppliedOpTime() const = 0;
+
     /**
      * Returns a vector of members that have applied the operation with OpTime 'op'.
      * "durablyWritten" indicates whether the operation has to be durably applied.
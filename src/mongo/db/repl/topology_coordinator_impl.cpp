@@ -1133,6 +1133,20 @@ bool TopologyCoordinatorImpl::haveTaggedNodesReachedOpTime(const OpTime& opTime,
     return false;
 }
 
+OpTime TopologyCoordinatorImpl::latestKnownAppliedOpTime() const {
+    // Unlike _latestKnownOpTime(), consider every member regardless of whether it is up or
+    // still in the config, to match the counting rules of haveNumNodesReachedOpTime() and
+    // haveTaggedNodesReachedOpTime() above.
+    OpTime latest = getMyLastAppliedOpTime();
+    for (auto&& memberData : _memberData) {
+        const OpTime& memberOpTime = memberData.getLastAppliedOpTime();
+        if (memberOpTime > latest) {
+            latest = memberOpTime;
+        }
+    }
+    return latest;
+}
+
 HeartbeatResponseAction TopologyCoordinatorImpl::checkMemberTimeouts(Date_t now) {
     HeartbeatResponseAction result = HeartbeatResponseAction::makeNoAction();
     for (int memberIndex = 0; memberIndex < static_cast<int>(_memberData.size()); memberIndex++) {
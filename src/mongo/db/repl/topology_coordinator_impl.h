@@ -232,6 +232,7 @@ public:
     virtual bool haveTaggedNodesReachedOpTime(const OpTime& opTime,
                                               const ReplSetTagPattern& tagPattern,
                                               bool durablyWritten);
+    virtual OpTime latestKnownAppliedOpTime() const;
     virtual std::vector<HostAndPort> getHostsWrittenTo(const OpTime& op,
                                                        bool durablyWritten,
                                                        bool skipSelf);
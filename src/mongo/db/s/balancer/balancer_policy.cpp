@@ -245,6 +245,7 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
                                                      const set<ShardId>& excludedShards) {
     ShardId best;
     unsigned minChunks = numeric_limits<unsigned>::max();
+    double bestOpsRate = -1.0;
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
@@ -256,12 +257,21 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
         }
 
         unsigned myChunks = distribution.numberOfChunksInShard(stat.shardId);
-        if (myChunks >= minChunks) {
+        if (myChunks > minChunks) {
+            continue;
+        }
+
+        // On equal chunk counts prefer the shard with the lower measured operation rate, so that
+        // ties break toward idle shards instead of statistics iteration order. Shards without a
+        // measured rate never displace an already-chosen one.
+        if (myChunks == minChunks &&
+            !(stat.hasOpsRate() && bestOpsRate >= 0 && stat.opsPerSecond < bestOpsRate)) {
             continue;
         }
 
         best = stat.shardId;
         minChunks = myChunks;
+        bestOpsRate = stat.opsPerSecond;
     }
 
     return best;
@@ -273,6 +283,7 @@ ShardId BalancerPolicy::_getMostOverloadedShard(const ShardStatisticsVector& sha
                                                 const set<ShardId>& excludedShards) {
     ShardId worst;
     unsigned maxChunks = 0;
+    double worstOpsRate = -1.0;
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
@@ -280,11 +291,18 @@ ShardId BalancerPolicy::_getMostOverloadedShard(const ShardStatisticsVector& sha
 
         const unsigned shardChunkCount =
             distribution.numberOfChunksInShardWithTag(stat.shardId, chunkTag);
-        if (shardChunkCount <= maxChunks)
+        if (shardChunkCount < maxChunks)
+            continue;
+
+        // On equal chunk counts prefer donating from the shard with the higher measured operation
+        // rate, so load drains from the hottest of otherwise equal shards.
+        if (shardChunkCount == maxChunks &&
+            !(stat.hasOpsRate() && worstOpsRate >= 0 && stat.opsPerSecond > worstOpsRate))
             continue;
 
         worst = stat.shardId;
         maxChunks = shardChunkCount;
+        worstOpsRate = stat.opsPerSecond;
     }
 
     return worst;
@@ -44,13 +44,15 @@ ClusterStatistics::ShardStatistics::ShardStatistics(ShardId inShardId,
                                                     uint64_t inCurrSizeMB,
                                                     bool inIsDraining,
                                                     std::set<std::string> inShardTags,
-                                                    std::string inMongoVersion)
+                                                    std::string inMongoVersion,
+                                                    double inOpsPerSecond)
     : shardId(std::move(inShardId)),
       maxSizeMB(inMaxSizeMB),
       currSizeMB(inCurrSizeMB),
       isDraining(inIsDraining),
       shardTags(std::move(inShardTags)),
-      mongoVersion(std::move(inMongoVersion)) {}
+      mongoVersion(std::move(inMongoVersion)),
+      opsPerSecond(inOpsPerSecond) {}
 
 bool ClusterStatistics::ShardStatistics::isSizeMaxed() const {
     if (!maxSizeMB || !currSizeMB) {
@@ -68,6 +70,10 @@ bool ClusterStatistics::ShardStatistics::isSizeExceeded() const {
     return currSizeMB > maxSizeMB;
 }
 
+bool ClusterStatistics::ShardStatistics::hasOpsRate() const {
+    return opsPerSecond >= 0;
+}
+
 BSONObj ClusterStatistics::ShardStatistics::toBSON() const {
     BSONObjBuilder builder;
     builder.append("id", shardId.toString());
@@ -79,6 +85,10 @@ BSONObj ClusterStatistics::ShardStatistics::toBSON() const {
         arrayBuilder.append(shardTags);
     }
 
+    if (hasOpsRate()) {
+        builder.append("opsPerSecond", opsPerSecond);
+    }
+
     builder.append("version", mongoVersion);
     return builder.obj();
 }
@@ -62,7 +62,8 @@ public:
                         uint64_t currSizeMB,
                         bool isDraining,
                         std::set<std::string> shardTags,
-                        std::string mongoVersion);
+                        std::string mongoVersion,
+                        double opsPerSecond = -1.0);
 
         /**
          * Returns true if a shard is not allowed to receive any new chunks because it has reached
@@ -76,6 +77,11 @@ public:
          */
         bool isSizeExceeded() const;
 
+        /**
+         * Returns true if an operation rate has been measured for this shard.
+         */
+        bool hasOpsRate() const;
+
         /**
          * Returns BSON representation of this shard's statistics, for reporting purposes.
          */
@@ -98,6 +104,10 @@ public:
 
         // Version of mongod, which runs on this shard's primary
         std::string mongoVersion;
+
+        // Rate of operations (sum of the opcounters) observed on this shard's primary between the
+        // last two statistics rounds. Negative when no rate has been measured yet.
+        double opsPerSecond{-1.0};
     };
 
     virtual ~ClusterStatistics();
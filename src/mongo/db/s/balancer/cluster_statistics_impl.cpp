@@ -53,14 +53,11 @@ namespace {
 const char kVersionField[] = "version";
 
 /**
- * Executes the serverStatus command against the specified shard and obtains the version of the
- * running MongoD service.
- *
- * Returns the MongoD version in strig format or an error. Known error codes are:
+ * Executes the serverStatus command against the specified shard's primary and returns the full
+ * response. Known error codes are:
  *  ShardNotFound if shard by that id is not available on the registry
- *  NoSuchKey if the version could not be retrieved
  */
-StatusWith<string> retrieveShardMongoDVersion(OperationContext* opCtx, ShardId shardId) {
+StatusWith<BSONObj> retrieveShardServerStatus(OperationContext* opCtx, ShardId shardId) {
     auto shardRegistry = Grid::get(opCtx)->shardRegistry();
     auto shardStatus = shardRegistry->getShard(opCtx, shardId);
     if (!shardStatus.isOK()) {
@@ -81,15 +78,7 @@ StatusWith<string> retrieveShardMongoDVersion(OperationContext* opCtx, ShardId s
         return commandResponse.getValue().commandStatus;
     }
 
-    BSONObj serverStatus = std::move(commandResponse.getValue().response);
-
-    string version;
-    Status status = bsonExtractStringField(serverStatus, kVersionField, &version);
-    if (!status.isOK()) {
-        return status;
-    }
-
-    return version;
+    return std::move(commandResponse.getValue().response);
 }
 
 }  // namespace
@@ -129,15 +118,23 @@ StatusWith<vector<ShardStatistics>> ClusterStatisticsImpl::getStats(OperationCon
         }
 
         string mongoDVersion;
+        double opsPerSecond = -1.0;
+
+        auto serverStatusStatus = retrieveShardServerStatus(opCtx, shard.getName());
+        if (serverStatusStatus.isOK()) {
+            const BSONObj& serverStatus = serverStatusStatus.getValue();
 
-        auto mongoDVersionStatus = retrieveShardMongoDVersion(opCtx, shard.getName());
-        if (mongoDVersionStatus.isOK()) {
-            mongoDVersion = std::move(mongoDVersionStatus.getValue());
-        } else {
             // Since the mongod version is only used for reporting, there is no need to fail the
             // entire round if it cannot be retrieved, so just leave it empty
-            log() << "Unable to obtain shard version for " << shard.getName()
-                  << causedBy(mongoDVersionStatus.getStatus());
+            bsonExtractStringField(serverStatus, kVersionField, &mongoDVersion)
+                .transitional_ignore();
+
+            // Likewise the operation rate is advisory - the balancer policy treats a negative
+            // rate as unknown
+            opsPerSecond = _computeOpsRate(shard.getName(), serverStatus["opcounters"]);
+        } else {
+            log() << "Unable to obtain shard statistics for " << shard.getName()
+                  << causedBy(serverStatusStatus.getStatus());
         }
 
         std::set<string> shardTags;
@@ -151,10 +148,47 @@ StatusWith<vector<ShardStatistics>> ClusterStatisticsImpl::getStats(OperationCon
                            shardSizeStatus.getValue() / 1024 / 1024,
                            shard.getDraining(),
                            std::move(shardTags),
-                           std::move(mongoDVersion));
+                           std::move(mongoDVersion),
+                           opsPerSecond);
     }
 
     return stats;
 }
 
+double ClusterStatisticsImpl::_computeOpsRate(const ShardId& shardId,
+                                              const BSONElement& opcounters) {
+    if (!opcounters.isABSONObj()) {
+        return -1.0;
+    }
+
+    long long totalOps = 0;
+    for (auto&& counter : opcounters.Obj()) {
+        if (counter.isNumber()) {
+            totalOps += counter.safeNumberLong();
+        }
+    }
+
+    const Date_t now = Date_t::now();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    double rate = -1.0;
+
+    auto it = _previousOpCounters.find(shardId);
+    if (it != _previousOpCounters.end()) {
+        const auto elapsed = now - it->second.sampledAt;
+        const long long deltaOps = totalOps - it->second.totalOps;
+
+        // A negative delta means the shard's counters were reset (restart); drop the stale sample
+        // and report the rate as unknown until the next round.
+        if (elapsed >= Seconds(1) && deltaOps >= 0) {
+            rate = static_cast<double>(deltaOps) / durationCount<Seconds>(elapsed);
+        }
+    }
+
+    _previousOpCounters[shardId] = {totalOps, now};
+
+    return rate;
+}
+
 }  // namespace mongo
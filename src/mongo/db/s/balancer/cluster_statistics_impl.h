@@ -28,10 +28,16 @@
 
 #pragma once
 
+#include <map>
+
 #include "mongo/db/s/balancer/cluster_statistics.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
+class BSONElement;
+
 /**
  * Default implementation for the cluster statistics gathering utility. Uses a blocking method to
  * fetch the statistics and does not perform any caching. If any of the shards fails to report
@@ -43,6 +49,24 @@ public:
     ~ClusterStatisticsImpl();
 
     StatusWith<std::vector<ShardStatistics>> getStats(OperationContext* opCtx) override;
+
+private:
+    /**
+     * Derives the shard's operation rate by differencing the given serverStatus opcounters
+     * against the sample retained from the previous statistics round. Returns a negative value
+     * on the first round for a shard, or if the counters went backwards (shard restarted).
+     */
+    double _computeOpsRate(const ShardId& shardId, const BSONElement& opcounters);
+
+    // Opcounter totals retained from the previous statistics round, keyed by shard id. Guarded
+    // by _mutex.
+    struct OpCountersSample {
+        long long totalOps;
+        Date_t sampledAt;
+    };
+
+    stdx::mutex _mutex;
+    std::map<ShardId, OpCountersSample> _previousOpCounters;
 };
 
 }  // namespace mongo
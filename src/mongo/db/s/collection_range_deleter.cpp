@@ -35,8 +35,10 @@
 #include <algorithm>
 #include <utility>
 
+#include "mongo/base/counter.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbhelpers.h"
@@ -52,12 +54,15 @@
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/s/metadata_manager.h"
 #include "mongo/db/s/sharding_state.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/executor/task_executor.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -71,6 +76,29 @@ namespace {
 const WriteConcernOptions kMajorityWriteConcern(WriteConcernOptions::kMajority,
                                                 WriteConcernOptions::SyncMode::UNSET,
                                                 Seconds(60));
+
+// Budget, in milliseconds, for the foreground impact of a single orphan deletion batch.  A batch
+// that overruns the budget causes subsequent batches to shrink and the deleter to pause for the
+// overage before the next one; batches that finish within budget let the batch size grow back
+// toward the scheduler's limit.  Zero disables adaptation, restoring fixed-size batches.
+MONGO_EXPORT_SERVER_PARAMETER(rangeDeleterBatchTargetMillis, int, 10);
+
+// Cumulative range deleter progress, reported in serverStatus under "metrics.rangeDeleter".
+Counter64 rangeDeleterDocsDeleted;
+Counter64 rangeDeleterBatches;
+Counter64 rangeDeleterBatchesOverBudget;
+ServerStatusMetricField<Counter64> displayDocsDeleted("rangeDeleter.docsDeleted",
+                                                      &rangeDeleterDocsDeleted);
+ServerStatusMetricField<Counter64> displayBatches("rangeDeleter.batches", &rangeDeleterBatches);
+ServerStatusMetricField<Counter64> displayBatchesOverBudget("rangeDeleter.batchesOverBudget",
+                                                            &rangeDeleterBatchesOverBudget);
+
+// Batch size carried between batches by the adaptation in cleanUpNextRange.  Zero means no
+// pressure has been observed, so batches use the scheduler's full limit.
+AtomicInt32 adaptiveBatchSize{0};
+
+const int kMinBatchSize = 16;
+
 }  // unnamed namespace
 
 CollectionRangeDeleter::~CollectionRangeDeleter() {
@@ -88,6 +116,10 @@ auto CollectionRangeDeleter::cleanUpNextRange(OperationContext* opCtx,
 
     StatusWith<int> wrote = 0;
 
+    // Unit tests expect maxToDelete to be obeyed exactly, so they opt out of adaptation.
+    const int targetMillis = forTestOnly ? 0 : rangeDeleterBatchTargetMillis.load();
+    int batchMillis = 0;
+
     auto range = boost::optional<ChunkRange>(boost::none);
     auto notification = DeleteNotification();
     {
@@ -167,14 +199,40 @@ auto CollectionRangeDeleter::cleanUpNextRange(OperationContext* opCtx,
                 // clang-format on
             }
 
+            int numToDelete = maxToDelete;
+            if (targetMillis > 0) {
+                if (int adapted = adaptiveBatchSize.load()) {
+                    numToDelete = std::min(maxToDelete, std::max(adapted, kMinBatchSize));
+                }
+            }
+
+            Timer batchTimer;
             try {
                 auto keyPattern = scopedCollectionMetadata->getKeyPattern();
 
-                wrote = self->_doDeletion(opCtx, collection, keyPattern, *range, maxToDelete);
+                wrote = self->_doDeletion(opCtx, collection, keyPattern, *range, numToDelete);
             } catch (const DBException& e) {
                 wrote = e.toStatus();
                 warning() << e.what();
             }
+            batchMillis = batchTimer.millis();
+
+            if (!forTestOnly && wrote.isOK() && wrote.getValue() > 0) {
+                rangeDeleterDocsDeleted.increment(wrote.getValue());
+                rangeDeleterBatches.increment();
+                if (targetMillis > 0) {
+                    if (batchMillis > targetMillis) {
+                        rangeDeleterBatchesOverBudget.increment();
+                        adaptiveBatchSize.store(std::max(numToDelete / 2, kMinBatchSize));
+                    } else if (int adapted = adaptiveBatchSize.load()) {
+                        // Grow back gradually; on regaining the scheduler's limit, stop
+                        // constraining batches altogether.
+                        const int grown = adapted + adapted / 4 + 1;
+                        adaptiveBatchSize.store(grown >= maxToDelete ? 0 : grown);
+                    }
+                }
+            }
+
             if (!wrote.isOK() || wrote.getValue() == 0) {
                 if (wrote.isOK()) {
                     log() << "No documents remain to delete in " << nss << " range "
@@ -229,6 +287,13 @@ auto CollectionRangeDeleter::cleanUpNextRange(OperationContext* opCtx,
     }
 
     notification.abandon();
+
+    if (targetMillis > 0 && batchMillis > targetMillis) {
+        // Pace the deleter: pause for the time by which the batch overran its budget before
+        // starting the next one, so foreground operations on the collection get a comparable
+        // share of it.
+        return Date_t::now() + Milliseconds(batchMillis - targetMillis);
+    }
     return Date_t{};
 }
 
@@ -153,6 +153,11 @@ public:
      * watchers of ranges as they are done being deleted. It performs its own collection locking, so
      * it must be called without locks.
      *
+     * maxToDelete is an upper bound: unless the rangeDeleterBatchTargetMillis server parameter is
+     * zero, batches that overrun that budget of foreground impact cause later batches to shrink,
+     * and to be scheduled after a pause proportional to the overage, until batches fit the budget
+     * again.
+     *
      * If it should be scheduled to run again because there might be more documents to delete,
      * returns the time to begin, or boost::none otherwise.
      *
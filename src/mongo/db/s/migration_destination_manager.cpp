@@ -32,6 +32,7 @@
 
 #include "mongo/db/s/migration_destination_manager.h"
 
+#include <algorithm>
 #include <list>
 #include <vector>
 
@@ -42,6 +43,7 @@
 #include "mongo/db/catalog/database.h"
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/catalog/index_create.h"
+#include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbhelpers.h"
 #include "mongo/db/namespace_string.h"
@@ -55,10 +57,12 @@
 #include "mongo/db/s/migration_util.h"
 #include "mongo/db/s/move_timing_helper.h"
 #include "mongo/db/s/sharding_state.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/shard_key_pattern.h"
 #include "mongo/stdx/chrono.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/concurrency/notification.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
@@ -80,6 +84,25 @@ const WriteConcernOptions kMajorityWriteConcern(WriteConcernOptions::kMajority,
                                                 WriteConcernOptions::SyncMode::UNSET,
                                                 -1);
 
+// When the secondaryThrottle is off, the bulk clone still yields to replication if the majority
+// commit point has fallen more than kAdaptiveThrottleMaxLagSecs behind the last op this thread
+// applied. The check runs every kAdaptiveThrottleCheckIntervalDocs cloned documents and waits at
+// most kAdaptiveThrottleWaitMillis per check, so a healthy recipient clones at full speed while a
+// lagging one gets periodic, bounded pauses instead of driving its secondaries further behind.
+const int kAdaptiveThrottleCheckIntervalDocs = 256;
+const long long kAdaptiveThrottleMaxLagSecs = 10;
+const int kAdaptiveThrottleWaitMillis = 500;
+
+// Number of concurrent streams fetching and inserting initial clone data from the donor shard.
+// The donor hands out disjoint batches to every _migrateClone call from a single record-id pool,
+// so extra streams need no range partitioning. A value of 1 restores single-stream cloning.
+MONGO_EXPORT_SERVER_PARAMETER(migrateCloneStreams, int, 2);
+
+// Number of catch-up modifications applied per lock acquisition in _applyMigrateOp. Application
+// order within a transfer batch is unchanged (all deletions, then all reloads, each in sequence),
+// so grouping only amortizes locking and cannot reorder conflicting operations.
+const int kModsApplicationGroupDocs = 16;
+
 /**
  * Returns a human-readabale name of the migration manager's state.
  */
@@ -620,6 +643,10 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* opCtx,
         MONGO_FAIL_POINT_PAUSE_WHILE_SET(migrateThreadHangAtStep2);
     }
 
+    // Most recent optime applied by any clone stream. Folded into lastOpApplied below so that the
+    // pre-critical-section replication waits cover documents inserted by worker streams too.
+    repl::OpTime latestCloneOpTime;
+
     {
         // 3. Initial bulk clone
         setState(CLONE);
@@ -628,79 +655,185 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* opCtx,
 
         _chunkMarkedPending = true;  // no lock needed, only the migrate thread looks.
 
-        while (true) {
-            BSONObj res;
-            if (!conn->runCommand("admin",
-                                  migrateCloneRequest,
-                                  res)) {  // gets array of objects to copy, in disk order
-                setStateFail(str::stream() << "_migrateClone failed: " << redact(res.toString()));
-                conn.done();
-                return;
-            }
+        // Cloning runs on migrateCloneStreams concurrent streams (this thread plus workers), each
+        // with its own connection and operation context. The first failure on any stream stops
+        // the rest.
+        stdx::mutex cloneStatusMutex;
+        Status cloneStatus = Status::OK();
 
-            BSONObj arr = res["objects"].Obj();
-            int thisTime = 0;
-
-            BSONObjIterator i(arr);
-            while (i.more()) {
-                opCtx->checkForInterrupt();
+        auto cloneDocuments = [&](OperationContext* cloneOpCtx, DBClientBase* cloneConn) {
+            int docsInserted = 0;
+            while (true) {
+                cloneOpCtx->checkForInterrupt();
 
                 if (getState() == ABORT) {
-                    log() << "Migration aborted while copying documents";
                     return;
                 }
-
-                BSONObj docToClone = i.next().Obj();
                 {
-                    OldClientWriteContext cx(opCtx, _nss.ns());
-
-                    BSONObj localDoc;
-                    if (willOverrideLocalId(opCtx,
-                                            _nss,
-                                            min,
-                                            max,
-                                            shardKeyPattern,
-                                            cx.db(),
-                                            docToClone,
-                                            &localDoc)) {
-                        string errMsg = str::stream() << "cannot migrate chunk, local document "
-                                                      << redact(localDoc)
-                                                      << " has same _id as cloned "
-                                                      << "remote document " << redact(docToClone);
-
-                        warning() << errMsg;
-
-                        // Exception will abort migration cleanly
-                        uasserted(16976, errMsg);
+                    stdx::lock_guard<stdx::mutex> sl(cloneStatusMutex);
+                    if (!cloneStatus.isOK()) {
+                        return;
                     }
+                }
 
-                    Helpers::upsert(opCtx, _nss.ns(), docToClone, true);
+                BSONObj res;
+                if (!cloneConn->runCommand("admin",
+                                           migrateCloneRequest,
+                                           res)) {  // gets array of objects to copy, in disk order
+                    uasserted(40671,
+                              str::stream() << "_migrateClone failed: " << redact(res.toString()));
+                }
+
+                BSONObj arr = res["objects"].Obj();
+                if (arr.isEmpty()) {
+                    return;
+                }
+
+                BSONObjIterator i(arr);
+                while (i.more()) {
+                    cloneOpCtx->checkForInterrupt();
+
+                    if (getState() == ABORT) {
+                        return;
+                    }
+
+                    BSONObj docToClone = i.next().Obj();
+                    {
+                        OldClientWriteContext cx(cloneOpCtx, _nss.ns());
+
+                        BSONObj localDoc;
+                        if (willOverrideLocalId(cloneOpCtx,
+                                                _nss,
+                                                min,
+                                                max,
+                                                shardKeyPattern,
+                                                cx.db(),
+                                                docToClone,
+                                                &localDoc)) {
+                            string errMsg = str::stream() << "cannot migrate chunk, local document "
+                                                          << redact(localDoc)
+                                                          << " has same _id as cloned "
+                                                          << "remote document " << redact(docToClone);
+
+                            warning() << errMsg;
+
+                            // Exception will abort migration cleanly
+                            uasserted(16976, errMsg);
+                        }
+
+                        Helpers::upsert(cloneOpCtx, _nss.ns(), docToClone, true);
+                    }
+                    docsInserted++;
+
+                    {
+                        stdx::lock_guard<stdx::mutex> statsLock(_mutex);
+                        _numCloned++;
+                        _clonedBytes += docToClone.objsize();
+                    }
+
+                    if (writeConcern.shouldWaitForOtherNodes()) {
+                        repl::ReplicationCoordinator::StatusAndDuration replStatus =
+                            repl::getGlobalReplicationCoordinator()->awaitReplication(
+                                cloneOpCtx,
+                                repl::ReplClientInfo::forClient(cloneOpCtx->getClient()).getLastOp(),
+                                writeConcern);
+                        if (replStatus.status.code() == ErrorCodes::WriteConcernFailed) {
+                            warning() << "secondaryThrottle on, but doc insert timed out; "
+                                         "continuing";
+                        } else {
+                            massertStatusOK(replStatus.status);
+                        }
+                    } else if (docsInserted % kAdaptiveThrottleCheckIntervalDocs == 0) {
+                        // The secondaryThrottle is off, but don't let the bulk clone run the
+                        // recipient's secondaries arbitrarily far behind. If the majority commit
+                        // point lags the ops applied by this thread by more than the threshold,
+                        // pause briefly for replication to make progress before cloning on.
+                        auto replCoord = repl::getGlobalReplicationCoordinator();
+                        if (replCoord->getReplicationMode() ==
+                            repl::ReplicationCoordinator::modeReplSet) {
+                            const auto lastOpApplied =
+                                repl::ReplClientInfo::forClient(cloneOpCtx->getClient()).getLastOp();
+                            const auto committed = replCoord->getLastCommittedOpTime();
+                            const long long lagSecs =
+                                static_cast<long long>(lastOpApplied.getTimestamp().getSecs()) -
+                                static_cast<long long>(committed.getTimestamp().getSecs());
+                            if (lagSecs > kAdaptiveThrottleMaxLagSecs) {
+                                WriteConcernOptions lagWriteConcern(kMajorityWriteConcern);
+                                lagWriteConcern.wTimeout = kAdaptiveThrottleWaitMillis;
+                                repl::ReplicationCoordinator::StatusAndDuration replStatus =
+                                    replCoord->awaitReplication(
+                                        cloneOpCtx, lastOpApplied, lagWriteConcern);
+                                if (replStatus.status.code() == ErrorCodes::WriteConcernFailed) {
+                                    LOG(1) << "migrate clone paced by replication lag of "
+                                           << lagSecs << "s; continuing";
+                                } else {
+                                    massertStatusOK(replStatus.status);
+                                }
+                            }
+                        }
+                    }
                 }
-                thisTime++;
 
                 {
-                    stdx::lock_guard<stdx::mutex> statsLock(_mutex);
-                    _numCloned++;
-                    _clonedBytes += docToClone.objsize();
+                    stdx::lock_guard<stdx::mutex> sl(cloneStatusMutex);
+                    const auto lastOp =
+                        repl::ReplClientInfo::forClient(cloneOpCtx->getClient()).getLastOp();
+                    if (latestCloneOpTime < lastOp) {
+                        latestCloneOpTime = lastOp;
+                    }
+                }
+            }
+        };
+
+        const int numCloneStreams = std::max(1, migrateCloneStreams.load());
+
+        std::vector<stdx::thread> cloneWorkers;
+        for (int streamId = 1; streamId < numCloneStreams; streamId++) {
+            cloneWorkers.emplace_back([&, streamId] {
+                Client::initThread(str::stream() << "migrateCloneStream" << streamId);
+                auto workerOpCtx = Client::getCurrent()->makeOperationContext();
+
+                if (getGlobalAuthorizationManager()->isAuthEnabled()) {
+                    AuthorizationSession::get(workerOpCtx->getClient())
+                        ->grantInternalAuthorization();
                 }
 
-                if (writeConcern.shouldWaitForOtherNodes()) {
-                    repl::ReplicationCoordinator::StatusAndDuration replStatus =
-                        repl::getGlobalReplicationCoordinator()->awaitReplication(
-                            opCtx,
-                            repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp(),
-                            writeConcern);
-                    if (replStatus.status.code() == ErrorCodes::WriteConcernFailed) {
-                        warning() << "secondaryThrottle on, but doc insert timed out; "
-                                     "continuing";
-                    } else {
-                        massertStatusOK(replStatus.status);
+                try {
+                    ScopedDbConnection workerConn(fromShardConnString);
+                    cloneDocuments(workerOpCtx.get(), workerConn.get());
+                    workerConn.done();
+                } catch (const DBException& e) {
+                    stdx::lock_guard<stdx::mutex> sl(cloneStatusMutex);
+                    if (cloneStatus.isOK()) {
+                        cloneStatus = e.toStatus();
                     }
                 }
+            });
+        }
+
+        try {
+            cloneDocuments(opCtx, conn.get());
+        } catch (const DBException& e) {
+            stdx::lock_guard<stdx::mutex> sl(cloneStatusMutex);
+            if (cloneStatus.isOK()) {
+                cloneStatus = e.toStatus();
             }
+        }
 
-            if (thisTime == 0)
-                break;
+        for (auto& worker : cloneWorkers) {
+            worker.join();
+        }
+
+        if (getState() == ABORT) {
+            log() << "Migration aborted while copying documents";
+            return;
+        }
+
+        if (!cloneStatus.isOK()) {
+            setStateFail(str::stream() << "initial clone failed: "
+                                       << redact(cloneStatus.toString()));
+            conn.done();
+            return;
         }
 
         timing.done(3);
@@ -710,6 +843,9 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* opCtx,
     // If running on a replicated system, we'll need to flush the docs we cloned to the
     // secondaries
     repl::OpTime lastOpApplied = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    if (lastOpApplied < latestCloneOpTime) {
+        lastOpApplied = latestCloneOpTime;
+    }
 
     const BSONObj xferModsRequest = createTransferModsRequest(_nss, *_sessionId);
 
@@ -875,72 +1011,82 @@ bool MigrationDestinationManager::_applyMigrateOp(OperationContext* opCtx,
 
         BSONObjIterator i(xfer["deleted"].Obj());  // deleted documents
         while (i.more()) {
+            // Apply deletions in groups sharing one lock acquisition and client context, rather
+            // than relocking per document.
             Lock::CollectionLock clk(opCtx->lockState(), nss.ns(), MODE_X);
             OldClientContext ctx(opCtx, nss.ns());
 
-            BSONObj id = i.next().Obj();
-
-            // do not apply delete if doc does not belong to the chunk being migrated
-            BSONObj fullObj;
-            if (Helpers::findById(opCtx, ctx.db(), nss.ns(), id, fullObj)) {
-                if (!isInRange(fullObj, min, max, shardKeyPattern)) {
-                    if (MONGO_FAIL_POINT(failMigrationReceivedOutOfRangeOperation)) {
-                        invariant(0);
+            for (int numInGroup = 0; numInGroup < kModsApplicationGroupDocs && i.more();
+                 numInGroup++) {
+                BSONObj id = i.next().Obj();
+
+                // do not apply delete if doc does not belong to the chunk being migrated
+                BSONObj fullObj;
+                if (Helpers::findById(opCtx, ctx.db(), nss.ns(), id, fullObj)) {
+                    if (!isInRange(fullObj, min, max, shardKeyPattern)) {
+                        if (MONGO_FAIL_POINT(failMigrationReceivedOutOfRangeOperation)) {
+                            invariant(0);
+                        }
+                        continue;
                     }
-                    continue;
                 }
-            }
 
-            if (serverGlobalParams.moveParanoia) {
-                rs.goingToDelete(fullObj).transitional_ignore();
-            }
+                if (serverGlobalParams.moveParanoia) {
+                    rs.goingToDelete(fullObj).transitional_ignore();
+                }
 
-            deleteObjects(opCtx,
-                          ctx.db() ? ctx.db()->getCollection(opCtx, nss) : nullptr,
-                          nss,
-                          id,
-                          true /* justOne */,
-                          false /* god */,
-                          true /* fromMigrate */);
+                deleteObjects(opCtx,
+                              ctx.db() ? ctx.db()->getCollection(opCtx, nss) : nullptr,
+                              nss,
+                              id,
+                              true /* justOne */,
+                              false /* god */,
+                              true /* fromMigrate */);
 
-            *lastOpApplied = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
-            didAnything = true;
+                *lastOpApplied = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+                didAnything = true;
+            }
         }
     }
 
     if (xfer["reload"].isABSONObj()) {  // modified documents (insert/update)
         BSONObjIterator i(xfer["reload"].Obj());
         while (i.more()) {
+            // As with deletions, apply modifications in bounded groups per lock acquisition.
             OldClientWriteContext cx(opCtx, nss.ns());
 
-            BSONObj updatedDoc = i.next().Obj();
+            for (int numInGroup = 0; numInGroup < kModsApplicationGroupDocs && i.more();
+                 numInGroup++) {
+                BSONObj updatedDoc = i.next().Obj();
 
-            // do not apply insert/update if doc does not belong to the chunk being migrated
-            if (!isInRange(updatedDoc, min, max, shardKeyPattern)) {
-                if (MONGO_FAIL_POINT(failMigrationReceivedOutOfRangeOperation)) {
-                    invariant(0);
+                // do not apply insert/update if doc does not belong to the chunk being migrated
+                if (!isInRange(updatedDoc, min, max, shardKeyPattern)) {
+                    if (MONGO_FAIL_POINT(failMigrationReceivedOutOfRangeOperation)) {
+                        invariant(0);
+                    }
+                    continue;
                 }
-                continue;
-            }
 
-            BSONObj localDoc;
-            if (willOverrideLocalId(
-                    opCtx, nss, min, max, shardKeyPattern, cx.db(), updatedDoc, &localDoc)) {
-                string errMsg = str::stream() << "cannot migrate chunk, local document " << localDoc
-                                              << " has same _id as reloaded remote document "
-                                              << updatedDoc;
+                BSONObj localDoc;
+                if (willOverrideLocalId(
+                        opCtx, nss, min, max, shardKeyPattern, cx.db(), updatedDoc, &localDoc)) {
+                    string errMsg = str::stream() << "cannot migrate chunk, local document "
+                                                  << localDoc
+                                                  << " has same _id as reloaded remote document "
+                                                  << updatedDoc;
 
-                warning() << errMsg;
+                    warning() << errMsg;
 
-                // Exception will abort migration cleanly
-                uasserted(16977, errMsg);
-            }
+                    // Exception will abort migration cleanly
+                    uasserted(16977, errMsg);
+                }
 
-            // We are in write lock here, so sure we aren't killing
-            Helpers::upsert(opCtx, nss.ns(), updatedDoc, true);
+                // We are in write lock here, so sure we aren't killing
+                Helpers::upsert(opCtx, nss.ns(), updatedDoc, true);
 
-            *lastOpApplied = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
-            didAnything = true;
+                *lastOpApplied = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+                didAnything = true;
+            }
         }
     }
 
@@ -51,6 +51,7 @@
 #include "mongo/db/s/sharded_connection_info.h"
 #include "mongo/db/s/sharding_initialization_mongod.h"
 #include "mongo/db/s/type_shard_identity.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/executor/network_interface_factory.h"
 #include "mongo/executor/network_interface_thread_pool.h"
 #include "mongo/executor/task_executor_pool.h"
@@ -66,6 +67,7 @@
 #include "mongo/s/sharding_initialization.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/stringutils.h"
 
 #include <chrono>
 #include <ctime>
@@ -84,6 +86,15 @@ namespace {
 
 const auto getShardingState = ServiceContext::declareDecoration<ShardingState>();
 
+// Comma-separated list of collection namespaces whose routing metadata is loaded during startup,
+// before the server begins accepting traffic, so that the first operations against them do not
+// stall on a config server refresh.
+std::string shardingPrewarmNamespaces;
+ExportedServerParameter<std::string, ServerParameterType::kStartupOnly>
+    shardingPrewarmNamespacesSetting(ServerParameterSet::getGlobal(),
+                                     "shardingPrewarmNamespaces",
+                                     &shardingPrewarmNamespaces);
+
 /**
  * Updates the config server field of the shardIdentity document with the given connection string
  * if setName is equal to the config server replica set name.
@@ -247,12 +258,63 @@ Status ShardingState::onStaleShardVersion(OperationContext* opCtx,
         }
     }
 
+    // Collapse concurrent refreshes of the same collection: the first stale operation performs
+    // the reload, and operations that go stale while it is in progress wait for its outcome
+    // instead of each issuing their own config server reload.
+    std::shared_ptr<Notification<Status>> inProgressRefresh;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = _activeRefreshes.find(nss.ns());
+        if (it != _activeRefreshes.end()) {
+            inProgressRefresh = it->second;
+        } else {
+            _activeRefreshes.emplace(nss.ns(), std::make_shared<Notification<Status>>());
+        }
+    }
+    if (inProgressRefresh) {
+        return inProgressRefresh->get(opCtx);
+    }
+
+    Status status = Status::OK();
     try {
         _refreshMetadata(opCtx, nss);
-        return Status::OK();
     } catch (const DBException& ex) {
         log() << "Failed to refresh metadata for collection" << nss << causedBy(redact(ex));
-        return ex.toStatus();
+        status = ex.toStatus();
+    }
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = _activeRefreshes.find(nss.ns());
+        invariant(it != _activeRefreshes.end());
+        it->second->set(status);
+        _activeRefreshes.erase(it);
+    }
+    return status;
+}
+
+void ShardingState::prewarmHotCollections(OperationContext* opCtx) {
+    if (shardingPrewarmNamespaces.empty()) {
+        return;
+    }
+    invariant(enabled());
+
+    std::vector<std::string> namespaces;
+    splitStringDelim(shardingPrewarmNamespaces, &namespaces, ',');
+    for (const auto& ns : namespaces) {
+        const NamespaceString nss(ns);
+        if (!nss.isValid()) {
+            warning() << "Ignoring invalid namespace '" << ns
+                      << "' in shardingPrewarmNamespaces";
+            continue;
+        }
+        log() << "Prewarming sharding metadata for " << nss.ns();
+        ChunkVersion unusedShardVersion;
+        Status status = refreshMetadataNow(opCtx, nss, &unusedShardVersion);
+        if (!status.isOK()) {
+            warning() << "Failed to prewarm sharding metadata for " << nss.ns()
+                      << causedBy(redact(status));
+        }
     }
 }
 
@@ -43,6 +43,7 @@
 #include "mongo/stdx/memory.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/concurrency/notification.h"
 
 namespace mongo {
 
@@ -145,11 +146,24 @@ public:
     /**
      * Refreshes the local metadata based on whether the expected version is higher than what we
      * have cached.
+     *
+     * Concurrent calls for the same collection are collapsed into one config server reload: the
+     * first stale operation performs the refresh and the rest wait for its outcome. A waiter whose
+     * expected version is still not covered by the joined refresh simply fails its operation's
+     * version check again and triggers a new refresh.
      */
     Status onStaleShardVersion(OperationContext* opCtx,
                                const NamespaceString& nss,
                                const ChunkVersion& expectedVersion);
 
+    /**
+     * Loads routing metadata for the collections named in the shardingPrewarmNamespaces startup
+     * parameter, so that the first operations against them do not stall on a refresh. Called once
+     * at startup, after sharding awareness has been initialized and before the server begins
+     * accepting traffic. Best-effort: failures are logged and ignored.
+     */
+    void prewarmHotCollections(OperationContext* opCtx);
+
     /**
      * Refreshes collection metadata by asking the config server for the latest information.
      * Starts a new config server request.
@@ -325,6 +339,11 @@ private:
     // holding X lock on the respective namespace.
     CollectionShardingStateMap _collections;
 
+    // Namespaces with a metadata refresh in progress, each mapped to a notification signaled with
+    // the refresh's outcome. Used by onStaleShardVersion to collapse concurrent refreshes of the
+    // same collection into one.
+    stdx::unordered_map<std::string, std::shared_ptr<Notification<Status>>> _activeRefreshes;
+
     // The id for the cluster this shard belongs to.
     OID _clusterId;
 
@@ -79,6 +79,10 @@ struct ServerGlobalParams {
     std::string transportLayer;       // --transportLayer (must be either "asio" or "legacy")
     int maxConns = DEFAULT_MAX_CONN;  // Maximum number of simultaneous open connections.
 
+    // --serviceExecutor ("synchronous": thread per connection; "asio": sessions share a
+    // fixed pool of worker threads driven by the asio transport layer)
+    std::string serviceExecutor;
+
     int unixSocketPermissions = DEFAULT_UNIX_PERMS;  // permissions for the UNIX domain socket
 
     std::string keyFile;           // Path to keyfile, or empty if none.
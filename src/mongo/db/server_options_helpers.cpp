@@ -210,6 +210,14 @@ Status addGeneralServerOptions(moe::OptionSection* options) {
         .hidden()
         .setDefault(moe::Value("asio"));
 
+    options
+        ->addOptionChaining("net.serviceExecutor",
+                            "serviceExecutor",
+                            moe::String,
+                            "sets the service executor implementation")
+        .hidden()
+        .setDefault(moe::Value("synchronous"));
+
     options
         ->addOptionChaining(
             "logpath",
@@ -808,6 +816,20 @@ Status storeServerOptions(const moe::Environment& params) {
         }
     }
 
+    if (params.count("net.serviceExecutor")) {
+        serverGlobalParams.serviceExecutor = params["net.serviceExecutor"].as<std::string>();
+        if (serverGlobalParams.serviceExecutor != "synchronous" &&
+            serverGlobalParams.serviceExecutor != "asio") {
+            return {ErrorCodes::BadValue,
+                    "Unsupported value for serviceExecutor. Must be \"synchronous\" or \"asio\""};
+        }
+        if (serverGlobalParams.serviceExecutor == "asio" &&
+            serverGlobalParams.transportLayer != "asio") {
+            return {ErrorCodes::BadValue,
+                    "serviceExecutor \"asio\" requires transportLayer \"asio\""};
+        }
+    }
+
     if (params.count("security.transitionToAuth")) {
         serverGlobalParams.transitionToAuth = params["security.transitionToAuth"].as<bool>();
     }
@@ -35,6 +35,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/service_executor_base.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/assert_util.h"
@@ -193,6 +194,10 @@ ServiceEntryPoint* ServiceContext::getServiceEntryPoint() const {
     return _serviceEntryPoint.get();
 }
 
+transport::ServiceExecutorBase* ServiceContext::getServiceExecutor() const {
+    return _serviceExecutor.get();
+}
+
 TickSource* ServiceContext::getTickSource() const {
     return _tickSource.get();
 }
@@ -225,6 +230,10 @@ void ServiceContext::setTransportLayer(std::unique_ptr<transport::TransportLayer
     _transportLayer = std::move(tl);
 }
 
+void ServiceContext::setServiceExecutor(std::unique_ptr<transport::ServiceExecutorBase> exec) {
+    _serviceExecutor = std::move(exec);
+}
+
 void ServiceContext::ClientDeleter::operator()(Client* client) const {
     ServiceContext* const service = client->getServiceContext();
     {
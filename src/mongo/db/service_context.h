@@ -54,6 +54,7 @@ class OpObserver;
 class ServiceEntryPoint;
 
 namespace transport {
+class ServiceExecutorBase;
 class TransportLayer;
 }  // namespace transport
 
@@ -362,6 +363,14 @@ public:
      */
     ServiceEntryPoint* getServiceEntryPoint() const;
 
+    /**
+     * Get the ServiceExecutor that runs sessions for this service context, or nullptr if
+     * sessions each run on a dedicated thread.
+     *
+     * See ServiceExecutorBase for more details.
+     */
+    transport::ServiceExecutorBase* getServiceExecutor() const;
+
     /**
      * Waits for the ServiceContext to be fully initialized and for all TransportLayers to have been
      * added/started.
@@ -436,6 +445,13 @@ public:
      */
     void setTransportLayer(std::unique_ptr<transport::TransportLayer> tl);
 
+    /**
+     * Binds a ServiceExecutor to the service context. The executor should have already been
+     * started. When set, the ServiceEntryPoint runs sessions on the executor's worker pool
+     * instead of spawning a thread per connection.
+     */
+    void setServiceExecutor(std::unique_ptr<transport::ServiceExecutorBase> exec);
+
 protected:
     ServiceContext();
 
@@ -478,6 +494,11 @@ private:
      */
     std::unique_ptr<ServiceEntryPoint> _serviceEntryPoint;
 
+    /**
+     * The ServiceExecutor, if sessions run on a shared worker pool.
+     */
+    std::unique_ptr<transport::ServiceExecutorBase> _serviceExecutor;
+
     /**
      * Vector of registered observers.
      */
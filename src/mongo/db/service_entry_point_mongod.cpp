@@ -32,6 +32,9 @@
 
 #include "mongo/db/service_entry_point_mongod.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "mongo/db/audit.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/impersonation_session.h"
@@ -43,6 +46,7 @@
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/diag_log.h"
+#include "mongo/db/ingress_admission.h"
 #include "mongo/db/introspect.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/lasterror.h"
@@ -61,9 +65,11 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/session_catalog.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/db/stats/recent_slow_ops.h"
 #include "mongo/db/stats/top.h"
 #include "mongo/rpc/factory.h"
 #include "mongo/rpc/metadata.h"
+#include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/rpc/metadata/config_server_metadata.h"
 #include "mongo/rpc/metadata/logical_time_metadata.h"
 #include "mongo/rpc/metadata/oplog_query_metadata.h"
@@ -510,6 +516,36 @@ bool runCommandImpl(OperationContext* opCtx,
  * replication state. All the logic here is independent of any particular command; any
  * functionality relevant to a specific command should be confined to its run() method.
  */
+/**
+ * Applies ingress admission control to one command invocation. Internal operations --
+ * DBDirectClient re-entry, clients without a network session, and commands against the admin,
+ * local and config databases (which carry replication and sharding traffic) -- bypass
+ * admission so that load shedding can never stall the cluster's own machinery. The returned
+ * ticket holds the operation's slot and must stay alive until the command finishes.
+ */
+IngressAdmissionController::Ticket admitOperation(OperationContext* opCtx,
+                                                  const std::string& dbname) {
+    Client* client = opCtx->getClient();
+    if (client->isInDirectClient() || !client->session()) {
+        return {};
+    }
+
+    if (dbname == NamespaceString::kAdminDb || dbname == NamespaceString::kLocalDb ||
+        dbname == NamespaceString::kConfigDb) {
+        return {};
+    }
+
+    // Bill the operation to the client's self-reported application name when there is one,
+    // otherwise to the database it targets.
+    StringData tenant = dbname;
+    const auto& metadata = ClientMetadataIsMasterState::get(client).getClientMetadata();
+    if (metadata && !metadata->getApplicationName().empty()) {
+        tenant = metadata->getApplicationName();
+    }
+
+    return IngressAdmissionController::get(opCtx->getServiceContext()).admit(tenant);
+}
+
 void execCommandDatabase(OperationContext* opCtx,
                          Command* command,
                          const OpMsgRequest& request,
@@ -542,7 +578,11 @@ void execCommandDatabase(OperationContext* opCtx,
         BSONElement shardVersionFieldIdx;
         BSONElement queryOptionMaxTimeMSField;
 
-        StringMap<int> topLevelFields;
+        // Duplicate top-level fields are detected with a linear scan of the names already seen.
+        // Command objects have few top-level fields, so this is cheaper than building a
+        // per-request hash table, which costs an allocation per field on every operation.
+        std::vector<StringData> topLevelFields;
+        topLevelFields.reserve(16);
         for (auto&& element : request.body) {
             StringData fieldName = element.fieldNameStringData();
             if (fieldName == QueryRequest::cmdOptionMaxTimeMS) {
@@ -558,7 +598,9 @@ void execCommandDatabase(OperationContext* opCtx,
             uassert(ErrorCodes::FailedToParse,
                     str::stream() << "Parsed command object contains duplicate top level key: "
                                   << fieldName,
-                    topLevelFields[fieldName]++ == 0);
+                    std::find(topLevelFields.begin(), topLevelFields.end(), fieldName) ==
+                        topLevelFields.end());
+            topLevelFields.push_back(fieldName);
         }
 
         if (Command::isHelpRequest(helpField)) {
@@ -576,6 +618,11 @@ void execCommandDatabase(OperationContext* opCtx,
         ImpersonationSessionGuard guard(opCtx);
         uassertStatusOK(Command::checkAuthorization(command, opCtx, dbname, request.body));
 
+        // Admission runs after authentication so unauthenticated clients cannot occupy slots.
+        // A rejection throws TooManyRequests, which the catch below turns into an ordinary
+        // error response without the operation ever reaching the ticket holders.
+        auto admissionTicket = admitOperation(opCtx, dbname);
+
         repl::ReplicationCoordinator* replCoord =
             repl::ReplicationCoordinator::get(opCtx->getClient()->getServiceContext());
         const bool iAmPrimary = replCoord->canAcceptWritesForDatabase_UNSAFE(opCtx, dbname);
@@ -1181,6 +1228,10 @@ DbResponse ServiceEntryPointMongod::handleRequest(OperationContext* opCtx, const
             durationCount<Microseconds>(currentOp.elapsedTimeExcludingPauses()),
             currentOp.getReadWriteType());
 
+    if (debug.executionTimeMicros > logThresholdMs * 1000LL) {
+        RecentSlowOps::get(opCtx->getServiceContext()).record(&currentOp);
+    }
+
     const bool shouldSample = serverGlobalParams.sampleRate == 1.0
         ? true
         : c.getPrng().nextCanonicalDouble() < serverGlobalParams.sampleRate;
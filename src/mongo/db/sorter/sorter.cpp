@@ -157,6 +157,7 @@ public:
                  std::shared_ptr<FileDeleter> fileDeleter)
         : _settings(settings),
           _done(false),
+          _bufferCapacity(0),
           _fileName(fileName),
           _fileDeleter(fileDeleter),
           _file(_fileName.c_str(), std::ios::in | std::ios::binary) {
@@ -204,7 +205,12 @@ private:
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
+        // A merge revisits every run's buffer once per block; reuse the existing allocation when
+        // it is already big enough rather than paying for a fresh one per block.
+        if (static_cast<size_t>(blockSize) > _bufferCapacity) {
+            _buffer.reset(new char[blockSize]);
+            _bufferCapacity = blockSize;
+        }
         read(_buffer.get(), blockSize);
         massert(16816, "file too short?", !_done);
 
@@ -223,6 +229,7 @@ private:
                     status.isOK());
             blockSize = outLen;
             _buffer.swap(out);
+            _bufferCapacity = blockSize;
         }
 
         if (!compressed) {
@@ -244,6 +251,7 @@ private:
 
         // hold on to decompressed data and throw out compressed data at block exit
         _buffer.swap(decompressionBuffer);
+        _bufferCapacity = uncompressedSize;
         _reader.reset(new BufReader(_buffer.get(), uncompressedSize));
     }
 
@@ -266,6 +274,7 @@ private:
     const Settings _settings;
     bool _done;
     std::unique_ptr<char[]> _buffer;
+    size_t _bufferCapacity;  // allocated size of '_buffer', which may exceed the current block
     std::unique_ptr<BufReader> _reader;
     std::string _fileName;
     std::shared_ptr<FileDeleter> _fileDeleter;  // Must outlive _file
@@ -429,6 +438,26 @@ public:
         }
 
         spill();
+
+        // A single merge pass over dozens of runs thrashes the file system and evicts each run's
+        // read buffer before it is refilled. Cascade the merge instead: combine the oldest runs
+        // into a single larger run on disk until no more than kMaxMergeFanIn remain for the final
+        // pass. Merged runs replace their inputs at the front of '_iters' so that ties are still
+        // resolved in insertion order, preserving the stability of the overall sort.
+        while (_iters.size() > kMaxMergeFanIn) {
+            std::vector<std::shared_ptr<Iterator>> batch(_iters.begin(),
+                                                         _iters.begin() + kMaxMergeFanIn);
+            _iters.erase(_iters.begin(), _iters.begin() + kMaxMergeFanIn);
+
+            std::unique_ptr<Iterator> merged(Iterator::merge(batch, _opts, _comp));
+            SortedFileWriter<Key, Value> writer(_opts, _settings);
+            while (merged->more()) {
+                Data data = merged->next();
+                writer.addAlreadySorted(data.first, data.second);
+            }
+            _iters.insert(_iters.begin(), std::shared_ptr<Iterator>(writer.done()));
+        }
+
         return Iterator::merge(_iters, _opts, _comp);
     }
 
@@ -491,6 +520,10 @@ private:
         _memUsed = 0;
     }
 
+    // The largest number of spilled runs merged in one pass; chosen so each run's read buffer
+    // stays resident while the merge round-robins between them.
+    static const size_t kMaxMergeFanIn = 16;
+
     const Comparator _comp;
     const Settings _settings;
     SortOptions _opts;
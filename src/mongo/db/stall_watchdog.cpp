@@ -0,0 +1,201 @@
+// stall_watchdog.cpp
+
+/**
+*    Copyright (C) 2017 MongoDB Inc.
+*
+*    This program is free software: you can redistribute it and/or  modify
+*    it under the terms of the GNU Affero General Public License, version 3,
+*    as published by the Free Software Foundation.
+*
+*    This program is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*    GNU Affero General Public License for more details.
+*
+*    You should have received a copy of the GNU Affero General Public License
+*    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*    As a special exception, the copyright holders give permission to link the
+*    code of portions of this program with the OpenSSL library under certain
+*    conditions as described in each individual source file and distribute
+*    linked combinations including the program with the OpenSSL library. You
+*    must comply with the GNU Affero General Public License in all respects for
+*    all of the code used other than as permitted herein. If you modify file(s)
+*    with this exception, you may extend this exception to your version of the
+*    file(s), but you are not obligated to do so. If you do not wish to do so,
+*    delete this exception statement from your version. If you delete this
+*    exception statement from all source files in the program, then also delete
+*    it in the license file.
+*/
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kControl
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stall_watchdog.h"
+
+#include "mongo/base/counter.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/locker.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/background.h"
+#include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/exit.h"
+#include "mongo/util/log.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+namespace {
+
+MONGO_EXPORT_SERVER_PARAMETER(stallWatchdogEnabled, bool, false);
+MONGO_EXPORT_SERVER_PARAMETER(stallWatchdogIntervalSecs, int, 1);
+
+// How long the storage tickets must remain exhausted, with operations queued behind them, before
+// the watchdog dumps the active operations to the log.
+MONGO_EXPORT_SERVER_PARAMETER(stallWatchdogStallSecs, int, 5);
+
+// Minimum time between two dumps, so a prolonged stall does not flood the log.
+MONGO_EXPORT_SERVER_PARAMETER(stallWatchdogCooldownSecs, int, 300);
+
+// Upper bound on the number of operations reported per dump.
+MONGO_EXPORT_SERVER_PARAMETER(stallWatchdogMaxOperations, int, 100);
+
+Counter64 stallWatchdogDumps;
+ServerStatusMetricField<Counter64> stallWatchdogDumpsDisplay("stallWatchdog.dumps",
+                                                             &stallWatchdogDumps);
+
+bool ticketsExhausted(LockMode mode) {
+    TicketHolder* holder = Locker::getGlobalThrottling(mode);
+    return holder && holder->available() <= 0 && holder->queued() > 0;
+}
+
+void appendTicketState(StringData name, LockMode mode, BSONObjBuilder* builder) {
+    TicketHolder* holder = Locker::getGlobalThrottling(mode);
+    if (!holder) {
+        return;
+    }
+
+    BSONObjBuilder bbb(builder->subobjStart(name));
+    bbb.append("out", holder->used());
+    bbb.append("available", holder->available());
+    bbb.append("totalTickets", holder->outof());
+    bbb.append("queueLength", holder->queued());
+    bbb.done();
+}
+
+void dumpActiveOperations(ServiceContext* serviceContext) {
+    {
+        BSONObjBuilder ticketState;
+        appendTicketState("read", MODE_IS, &ticketState);
+        appendTicketState("write", MODE_IX, &ticketState);
+        log() << "stall watchdog: storage tickets exhausted for "
+              << stallWatchdogStallSecs.load() << "s or more, dumping active operations; tickets: "
+              << ticketState.obj();
+    }
+
+    const int maxOps = stallWatchdogMaxOperations.load();
+    int dumped = 0;
+
+    for (ServiceContext::LockedClientsCursor cursor(serviceContext); Client* client =
+                                                                         cursor.next();) {
+        invariant(client);
+
+        stdx::lock_guard<Client> lk(*client);
+
+        OperationContext* clientOpCtx = client->getOperationContext();
+        if (!clientOpCtx) {
+            continue;
+        }
+
+        if (dumped >= maxOps) {
+            log() << "stall watchdog: truncating dump at " << maxOps << " operations";
+            break;
+        }
+
+        BSONObjBuilder infoBuilder;
+        client->reportState(infoBuilder);
+        infoBuilder.append("opid", clientOpCtx->getOpID());
+        CurOp::get(clientOpCtx)->reportState(&infoBuilder, true);
+
+        log() << "stall watchdog op: " << redact(infoBuilder.obj());
+        dumped++;
+    }
+
+    log() << "stall watchdog: dumped " << dumped << " active operations";
+    stallWatchdogDumps.increment();
+}
+
+/**
+ * Watches the global storage ticket holders, which gate admission of reads and writes into the
+ * storage engine. When both remain exhausted with a queue behind them for a sustained period -
+ * the signature of a stall - the active operations are dumped to the log while the stall is
+ * still in progress, so there is on-box evidence without a human having to catch it live. The
+ * dumps are visible in the log and counted under metrics.stallWatchdog.dumps. Disabled by
+ * default; enable with the stallWatchdogEnabled server parameter.
+ */
+class StallWatchdog : public BackgroundJob {
+public:
+    virtual std::string name() const {
+        return "StallWatchdog";
+    }
+
+    virtual void run() {
+        Client::initThread(name().c_str());
+
+        int stalledSecs = 0;
+        Date_t lastDump;
+
+        while (!globalInShutdownDeprecated()) {
+            const int intervalSecs = std::max(stallWatchdogIntervalSecs.load(), 1);
+
+            {
+                MONGO_IDLE_THREAD_BLOCK;
+                sleepsecs(intervalSecs);
+            }
+
+            if (!stallWatchdogEnabled.load()) {
+                stalledSecs = 0;
+                continue;
+            }
+
+            if (ticketsExhausted(MODE_IX) || ticketsExhausted(MODE_IS)) {
+                stalledSecs += intervalSecs;
+            } else {
+                stalledSecs = 0;
+                continue;
+            }
+
+            if (stalledSecs < stallWatchdogStallSecs.load()) {
+                continue;
+            }
+
+            const Date_t now = Date_t::now();
+            if (now - lastDump < Seconds(stallWatchdogCooldownSecs.load())) {
+                continue;
+            }
+
+            lastDump = now;
+            stalledSecs = 0;
+
+            try {
+                dumpActiveOperations(getGlobalServiceContext());
+            } catch (const DBException& e) {
+                warning() << "stall watchdog failed to dump operations: " << redact(e);
+            }
+        }
+    }
+};
+
+}  // namespace
+
+void startStallWatchdog() {
+    StallWatchdog* watchdog = new StallWatchdog();
+    watchdog->go();
+}
+
+}  // namespace mongo
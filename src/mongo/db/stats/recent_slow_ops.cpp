@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/recent_slow_ops.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+const auto getRecentSlowOps = ServiceContext::declareDecoration<RecentSlowOps>();
+
+}  // namespace
+
+// static
+RecentSlowOps& RecentSlowOps::get(ServiceContext* service) {
+    return getRecentSlowOps(service);
+}
+
+void RecentSlowOps::record(CurOp* curOp) {
+    const OpDebug& debug = curOp->debug();
+
+    // Build the summary outside the lock; only the ring insertion is serialized.
+    BSONObjBuilder bob;
+    bob.appendDate("ts", jsTime());
+    bob.append("op", logicalOpToString(curOp->getLogicalOp()));
+    bob.append("ns", curOp->getNS());
+    if (!curOp->getPlanSummary().empty()) {
+        bob.append("planSummary", curOp->getPlanSummary());
+    }
+    bob.append("millis", debug.executionTimeMicros / 1000);
+    if (debug.cpuTimeMicros >= 0) {
+        bob.append("cpuTimeMicros", debug.cpuTimeMicros);
+    }
+    if (debug.nreturned >= 0) {
+        bob.append("nreturned", debug.nreturned);
+    }
+    if (debug.keysExamined >= 0) {
+        bob.append("keysExamined", debug.keysExamined);
+    }
+    if (debug.docsExamined >= 0) {
+        bob.append("docsExamined", debug.docsExamined);
+    }
+    if (debug.writeConflicts > 0) {
+        bob.append("writeConflicts", debug.writeConflicts);
+    }
+    BSONObj entry = bob.obj();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_entries.size() < kNumEntries) {
+        _entries.push_back(std::move(entry));
+    } else {
+        _entries[_nextSlot] = std::move(entry);
+    }
+    _nextSlot = (_nextSlot + 1) % kNumEntries;
+}
+
+void RecentSlowOps::append(BSONArrayBuilder* builder) const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_entries.empty()) {
+        return;
+    }
+    const size_t start = (_entries.size() < kNumEntries) ? 0 : _nextSlot;
+    for (size_t i = 0; i < _entries.size(); i++) {
+        builder->append(_entries[(start + i) % _entries.size()]);
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,83 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+
+class BSONArrayBuilder;
+class CurOp;
+class ServiceContext;
+
+/**
+ * A fixed-size ring buffer of summaries of recently completed operations that exceeded the
+ * slow operation threshold (serverGlobalParams.slowMS). Unlike the database profiler this
+ * never writes to a collection, so it can stay on in production: fast operations pay only the
+ * threshold comparison, and slow operations pay one small BSON summary plus a brief mutex
+ * acquisition. Entries are surfaced by the 'recentSlowOps' serverStatus section.
+ */
+class RecentSlowOps {
+    MONGO_DISALLOW_COPYING(RecentSlowOps);
+
+public:
+    // Number of summaries retained; the oldest entry is overwritten once the buffer is full.
+    static const size_t kNumEntries = 128;
+
+    RecentSlowOps() = default;
+
+    /**
+     * Retrieves the RecentSlowOps decoration on 'service'.
+     */
+    static RecentSlowOps& get(ServiceContext* service);
+
+    /**
+     * Summarizes the completed operation described by 'curOp' into the buffer. Callers are
+     * expected to have already checked the operation against the slow threshold.
+     */
+    void record(CurOp* curOp);
+
+    /**
+     * Appends the buffered summaries to 'builder', oldest first.
+     */
+    void append(BSONArrayBuilder* builder) const;
+
+private:
+    mutable stdx::mutex _mutex;
+
+    // Ring storage; grows up to kNumEntries, after which '_nextSlot' wraps.
+    std::vector<BSONObj> _entries;
+    size_t _nextSlot = 0;
+};
+
+}  // namespace mongo
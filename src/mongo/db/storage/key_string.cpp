@@ -340,6 +340,12 @@ void KeyString::resetToKey(const BSONObj& obj, Ordering ord, Discriminator discr
 void KeyString::_appendAllElementsForIndexing(const BSONObj& obj,
                                               Ordering ord,
                                               Discriminator discriminator) {
+    // A key encodes to approximately the size of its source object, so pre-size the buffer in
+    // one step rather than discovering the needed capacity through repeated doublings. Keys
+    // that encode larger (e.g. decimal continuations) still grow as before.
+    _buffer.reserveBytes(obj.objsize());
+    _buffer.claimReservedBytes(obj.objsize());
+
     int elemCount = 0;
     BSONObjIterator it(obj);
     while (auto elem = it.next()) {
@@ -1100,9 +1106,28 @@ void toBson(BufReader* reader,
                 readType<uint8_t>(reader, inverted), reader, typeBits, inverted, version, &stream);
         } else {
             StringData name = readCString(reader);
+            const uint8_t ctype = readType<uint8_t>(reader, inverted);
+
+            // Direct-append fast paths for the types that dominate covered-index scans.
+            // These skip the BSONObjBuilderValueStream indirection taken by toBsonValue().
+            if (ctype == CType::kStringLike) {
+                const uint8_t originalType = typeBits->readStringLike();
+                std::string scratch;
+                if (originalType == TypeBits::kString) {
+                    builder->append(name, readCStringWithNuls(reader, &scratch));
+                } else {
+                    dassert(originalType == TypeBits::kSymbol);
+                    builder->appendSymbol(name, readCStringWithNuls(reader, &scratch));
+                }
+                continue;
+            }
+            if (ctype == CType::kOID) {
+                builder->append(name, OID::from(reader->skip(OID::kOIDSize)));
+                continue;
+            }
+
             BSONObjBuilderValueStream& stream = *builder << name;
-            toBsonValue(
-                readType<uint8_t>(reader, inverted), reader, typeBits, inverted, version, &stream);
+            toBsonValue(ctype, reader, typeBits, inverted, version, &stream);
         }
     }
 }
@@ -66,6 +66,30 @@ Status WiredTigerGlobalOptions::add(moe::OptionSection* options) {
                            "use a compressor for log records [none|snappy|zlib]")
         .format("(:?none)|(:?snappy)|(:?zlib)", "(none/snappy/zlib)")
         .setDefault(moe::Value(std::string("snappy")));
+    wiredTigerOptions
+        .addOptionChaining("storage.wiredTiger.engineConfig.fileManagerCloseIdleTimeSecs",
+                           "wiredTigerFileManagerCloseIdleTimeSecs",
+                           moe::Int,
+                           "seconds a file handle must be idle before the file manager sweep "
+                           "may close it; 0 means never close idle handles")
+        .validRange(0, 100000)
+        .setDefault(moe::Value(100000));
+    wiredTigerOptions
+        .addOptionChaining("storage.wiredTiger.engineConfig.fileManagerCloseScanIntervalSecs",
+                           "wiredTigerFileManagerCloseScanIntervalSecs",
+                           moe::Int,
+                           "seconds between file manager sweeps looking for idle file handles "
+                           "to close")
+        .validRange(1, 100000)
+        .setDefault(moe::Value(10));
+    wiredTigerOptions
+        .addOptionChaining("storage.wiredTiger.engineConfig.fileManagerCloseHandleMinimum",
+                           "wiredTigerFileManagerCloseHandleMinimum",
+                           moe::Int,
+                           "number of open file handles below which the file manager sweep "
+                           "will not close any, regardless of idle time")
+        .validRange(0, 1000000)
+        .setDefault(moe::Value(250));
     wiredTigerOptions.addOptionChaining("storage.wiredTiger.engineConfig.directoryForIndexes",
                                         "wiredTigerDirectoryForIndexes",
                                         moe::Switch,
@@ -119,10 +143,6 @@ Status WiredTigerGlobalOptions::store(const moe::Environment& params,
         wiredTigerGlobalOptions.cacheSizeGB =
             params["storage.wiredTiger.engineConfig.cacheSizeGB"].as<double>();
     }
-    if (params.count("storage.syncPeriodSecs")) {
-        wiredTigerGlobalOptions.checkpointDelaySecs =
-            static_cast<size_t>(params["storage.syncPeriodSecs"].as<double>());
-    }
     if (params.count("storage.wiredTiger.engineConfig.statisticsLogDelaySecs")) {
         wiredTigerGlobalOptions.statisticsLogDelaySecs =
             params["storage.wiredTiger.engineConfig.statisticsLogDelaySecs"].as<int>();
@@ -131,6 +151,18 @@ Status WiredTigerGlobalOptions::store(const moe::Environment& params,
         wiredTigerGlobalOptions.journalCompressor =
             params["storage.wiredTiger.engineConfig.journalCompressor"].as<std::string>();
     }
+    if (params.count("storage.wiredTiger.engineConfig.fileManagerCloseIdleTimeSecs")) {
+        wiredTigerGlobalOptions.fileManagerCloseIdleTimeSecs =
+            params["storage.wiredTiger.engineConfig.fileManagerCloseIdleTimeSecs"].as<int>();
+    }
+    if (params.count("storage.wiredTiger.engineConfig.fileManagerCloseScanIntervalSecs")) {
+        wiredTigerGlobalOptions.fileManagerCloseScanIntervalSecs =
+            params["storage.wiredTiger.engineConfig.fileManagerCloseScanIntervalSecs"].as<int>();
+    }
+    if (params.count("storage.wiredTiger.engineConfig.fileManagerCloseHandleMinimum")) {
+        wiredTigerGlobalOptions.fileManagerCloseHandleMinimum =
+            params["storage.wiredTiger.engineConfig.fileManagerCloseHandleMinimum"].as<int>();
+    }
     if (params.count("storage.wiredTiger.engineConfig.directoryForIndexes")) {
         wiredTigerGlobalOptions.directoryForIndexes =
             params["storage.wiredTiger.engineConfig.directoryForIndexes"].as<bool>();
@@ -41,8 +41,10 @@ class WiredTigerGlobalOptions {
 public:
     WiredTigerGlobalOptions()
         : cacheSizeGB(0),
-          checkpointDelaySecs(0),
           statisticsLogDelaySecs(0),
+          fileManagerCloseIdleTimeSecs(100000),
+          fileManagerCloseScanIntervalSecs(10),
+          fileManagerCloseHandleMinimum(250),
           directoryForIndexes(false),
           useCollectionPrefixCompression(false),
           useIndexPrefixCompression(false){};
@@ -51,9 +53,11 @@ public:
     Status store(const moe::Environment& params, const std::vector<std::string>& args);
 
     double cacheSizeGB;
-    size_t checkpointDelaySecs;
     size_t statisticsLogDelaySecs;
     std::string journalCompressor;
+    size_t fileManagerCloseIdleTimeSecs;
+    size_t fileManagerCloseScanIntervalSecs;
+    size_t fileManagerCloseHandleMinimum;
     bool directoryForIndexes;
     std::string engineConfig;
 
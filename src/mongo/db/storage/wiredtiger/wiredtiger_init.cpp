@@ -102,6 +102,7 @@ public:
         // Intentionally leaked.
         new WiredTigerServerStatusSection(kv);
         new WiredTigerEngineRuntimeConfigParameter(kv);
+        new WiredTigerTableRuntimeConfigParameter(kv);
 
         KVStorageEngineOptions options;
         options.directoryPerDB = params.directoryperdb;
@@ -145,11 +145,22 @@ public:
         LOG(1) << "starting " << name() << " thread";
 
         while (!_shuttingDown.load()) {
+            // 'syncdelay' is a runtime server parameter, so re-read it on every pass rather
+            // than latching the startup value. Operators can lower it to spread writeback
+            // over smaller, more frequent checkpoints during traffic peaks, then restore it.
+            const double secs = storageGlobalParams.syncdelay.load();
+            if (secs <= 0) {
+                // As with the mmapv1 flusher, a syncdelay of 0 disables periodic
+                // checkpoints; poll for the setting (or shutdown) changing.
+                stdx::unique_lock<stdx::mutex> lock(_mutex);
+                _condvar.wait_for(lock, stdx::chrono::seconds(5));
+                continue;
+            }
+
             {
                 stdx::unique_lock<stdx::mutex> lock(_mutex);
-                _condvar.wait_for(lock,
-                                  stdx::chrono::seconds(static_cast<std::int64_t>(
-                                      wiredTigerGlobalOptions.checkpointDelaySecs)));
+                _condvar.wait_for(
+                    lock, stdx::chrono::milliseconds(static_cast<std::int64_t>(secs * 1000)));
             }
 
             try {
@@ -274,7 +285,14 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
         // If we're readOnly skip all WAL-related settings.
         ss << "log=(enabled=true,archive=true,path=journal,compressor=";
         ss << wiredTigerGlobalOptions.journalCompressor << "),";
-        ss << "file_manager=(close_idle_time=100000),";  //~28 hours, will put better fix in 3.1.x
+        // The default idle time is very long (~28 hours) because closing and reopening data
+        // handles is expensive; deployments with very many collections can lower these to bound
+        // the number of cached idle handles instead.
+        ss << "file_manager=(close_idle_time="
+           << wiredTigerGlobalOptions.fileManagerCloseIdleTimeSecs
+           << ",close_scan_interval=" << wiredTigerGlobalOptions.fileManagerCloseScanIntervalSecs
+           << ",close_handle_minimum=" << wiredTigerGlobalOptions.fileManagerCloseHandleMinimum
+           << "),";
         ss << "statistics_log=(wait=" << wiredTigerGlobalOptions.statisticsLogDelaySecs << "),";
         ss << "verbose=(recovery_progress),";
     }
@@ -365,6 +383,7 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openWriteTransaction.used());
         bbb.append("available", openWriteTransaction.available());
         bbb.append("totalTickets", openWriteTransaction.outof());
+        bbb.append("queueLength", openWriteTransaction.queued());
         bbb.done();
     }
     {
@@ -372,6 +391,7 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openReadTransaction.used());
         bbb.append("available", openReadTransaction.available());
         bbb.append("totalTickets", openReadTransaction.outof());
+        bbb.append("queueLength", openReadTransaction.queued());
         bbb.done();
     }
     bb.done();
@@ -802,6 +822,12 @@ int WiredTigerKVEngine::reconfigure(const char* str) {
     return _conn->reconfigure(_conn, str);
 }
 
+int WiredTigerKVEngine::alterTable(const char* uri, const char* config) {
+    WiredTigerSession session(_conn);
+    WT_SESSION* s = session.getSession();
+    return s->alter(s, uri, config);
+}
+
 void WiredTigerKVEngine::_checkIdentPath(StringData ident) {
     size_t start = 0;
     size_t idx;
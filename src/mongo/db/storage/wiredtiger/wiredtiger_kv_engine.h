@@ -158,6 +158,10 @@ public:
         return &_sessionCache->snapshotManager();
     }
 
+    WiredTigerSessionCache* getSessionCache() const {
+        return _sessionCache.get();
+    }
+
     void setJournalListener(JournalListener* jl) final;
 
     // wiredtiger specific
@@ -165,6 +169,11 @@ public:
     // held by this class
     int reconfigure(const char* str);
 
+    // Calls WT_SESSION::alter on the given table using a temporary session. Used to change
+    // per-table runtime settings such as 'cache_resident'. May return EBUSY if the table's
+    // handle cannot be acquired exclusively.
+    int alterTable(const char* uri, const char* config);
+
     WT_CONNECTION* getConnection() {
         return _conn;
     }
@@ -92,4 +92,75 @@ Status WiredTigerEngineRuntimeConfigParameter::setFromString(const std::string&
 
     return Status::OK();
 }
+
+WiredTigerTableRuntimeConfigParameter::WiredTigerTableRuntimeConfigParameter(
+    WiredTigerKVEngine* engine)
+    : ServerParameter(
+          ServerParameterSet::getGlobal(), "wiredTigerTableRuntimeConfig", false, true),
+      _engine(engine) {}
+
+void WiredTigerTableRuntimeConfigParameter::append(OperationContext* opCtx,
+                                                   BSONObjBuilder& b,
+                                                   const std::string& name) {
+    b << name << "";
+}
+
+Status WiredTigerTableRuntimeConfigParameter::set(const BSONElement& newValueElement) {
+    try {
+        return setFromString(newValueElement.String());
+    } catch (const MsgAssertionException& msg) {
+        return Status(
+            ErrorCodes::BadValue,
+            mongoutils::str::stream()
+                << "Invalid value for wiredTigerTableRuntimeConfig via setParameter command: "
+                << newValueElement
+                << ", exception: "
+                << msg.what());
+    }
+}
+
+Status WiredTigerTableRuntimeConfigParameter::setFromString(const std::string& str) {
+    size_t pos = str.find('\0');
+    if (pos != std::string::npos) {
+        return Status(ErrorCodes::BadValue,
+                      (str::stream()
+                       << "WiredTiger configuration strings cannot have embedded null characters. "
+                          "Embedded null found at position "
+                       << pos));
+    }
+
+    pos = str.find(' ');
+    if (pos == std::string::npos || pos + 1 == str.size()) {
+        return Status(ErrorCodes::BadValue,
+                      "wiredTigerTableRuntimeConfig expects \"<uri> <config>\", e.g. "
+                      "\"table:collection-2-123456 cache_resident=true\"");
+    }
+
+    const string uri = str.substr(0, pos);
+    const string config = str.substr(pos + 1);
+
+    if (uri.compare(0, 6, "table:") != 0) {
+        return Status(ErrorCodes::BadValue,
+                      (str::stream() << "wiredTigerTableRuntimeConfig may only alter \"table:\" "
+                                        "objects, got: "
+                                     << uri));
+    }
+
+    log() << "Altering WiredTiger table \"" << uri << "\" with config string: \"" << config
+          << "\"";
+
+    int ret = _engine->alterTable(uri.c_str(), config.c_str());
+    if (ret != 0) {
+        string result = (mongoutils::str::stream() << "WiredTiger table alter failed with error "
+                                                      "code ("
+                                                   << ret
+                                                   << "): "
+                                                   << wiredtiger_strerror(ret));
+        error() << result;
+
+        return Status(ErrorCodes::BadValue, result);
+    }
+
+    return Status::OK();
+}
 }
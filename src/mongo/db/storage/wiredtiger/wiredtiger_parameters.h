@@ -46,6 +46,26 @@ public:
 
     virtual Status setFromString(const std::string& str);
 
+private:
+    WiredTigerKVEngine* _engine;
+};
+
+/**
+ * WT_SESSION::alter setParameter support, for changing per-table runtime settings such as
+ * 'cache_resident'. The value is "<uri> <config>", e.g.
+ * "table:collection-2-123456 cache_resident=true".
+ */
+class WiredTigerTableRuntimeConfigParameter : public ServerParameter {
+    MONGO_DISALLOW_COPYING(WiredTigerTableRuntimeConfigParameter);
+
+public:
+    explicit WiredTigerTableRuntimeConfigParameter(WiredTigerKVEngine* engine);
+
+    virtual void append(OperationContext* opCtx, BSONObjBuilder& b, const std::string& name);
+    virtual Status set(const BSONElement& newValueElement);
+
+    virtual Status setFromString(const std::string& str);
+
 private:
     WiredTigerKVEngine* _engine;
 };
@@ -42,6 +42,7 @@
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/oplog_hack.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
@@ -94,6 +95,12 @@ MONGO_FP_DECLARE(WTPausePrimaryOplogDurabilityLoop);
 
 const std::string kWiredTigerEngineName = "wiredTiger";
 
+// Minimum age, in hours, the newest entry covered by the oldest oplog stone must reach before
+// the stone may be truncated, even when the oplog exceeds its configured size. Zero means size
+// alone governs truncation. Useful to guarantee a point-in-time restore or resync window on
+// write-heavy nodes that would otherwise roll the oplog over quickly.
+MONGO_EXPORT_SERVER_PARAMETER(oplogMinRetentionHours, double, 0.0);
+
 class WiredTigerRecordStore::OplogStones::InsertChange final : public RecoveryUnit::Change {
 public:
     InsertChange(OplogStones* oplogStones,
@@ -176,6 +183,33 @@ void WiredTigerRecordStore::OplogStones::kill() {
     _oplogReclaimCv.notify_one();
 }
 
+bool WiredTigerRecordStore::OplogStones::hasExcessStones_inlock() const {
+    int64_t totalBytes = 0;
+    for (std::deque<OplogStones::Stone>::const_iterator it = _stones.begin(); it != _stones.end();
+         ++it) {
+        totalBytes += it->bytes;
+    }
+
+    if (totalBytes <= _rs->cappedMaxSize()) {
+        return false;
+    }
+
+    const double minRetentionHours = oplogMinRetentionHours.load();
+    if (minRetentionHours <= 0.0) {
+        return true;
+    }
+
+    // Truncating the oldest stone drops every entry up to and including its last record, so the
+    // stone may only be reclaimed once that record has aged past the retention window. Oplog
+    // RecordIds encode the entry's timestamp, with the seconds in the high 32 bits.
+    const unsigned int newestCoveredSecs =
+        static_cast<unsigned int>(_stones.front().lastRecord.repr() >> 32);
+    const double ageSeconds =
+        static_cast<double>(Date_t::now().toTimeT()) - static_cast<double>(newestCoveredSecs);
+
+    return ageSeconds >= minRetentionHours * 3600.0;
+}
+
 void WiredTigerRecordStore::OplogStones::awaitHasExcessStonesOrDead() {
     // Wait until kill() is called or there are too many oplog stones.
     stdx::unique_lock<stdx::mutex> lock(_oplogReclaimMutex);
@@ -611,7 +645,6 @@ WiredTigerRecordStore::WiredTigerRecordStore(OperationContext* ctx, Params param
       _cappedSleep(0),
       _cappedSleepMS(0),
       _cappedCallback(params.cappedCallback),
-      _cappedDeleteCheckCount(0),
       _useOplogHack(shouldUseOplogHack(ctx, _uri)),
       _sizeStorer(params.sizeStorer),
       _sizeStorerCounter(0),
@@ -1101,23 +1134,34 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
 
     RecordId highestId = RecordId();
     dassert(nRecords != 0);
-    for (size_t i = 0; i < nRecords; i++) {
-        auto& record = records[i];
-        if (_useOplogHack) {
+    if (_useOplogHack) {
+        for (size_t i = 0; i < nRecords; i++) {
+            auto& record = records[i];
             StatusWith<RecordId> status =
                 oploghack::extractKey(record.data.data(), record.data.size());
             if (!status.isOK())
                 return status.getStatus();
             record.id = status.getValue();
-        } else if (_isCapped) {
-            stdx::lock_guard<stdx::mutex> lk(_uncommittedRecordIdsMutex);
+            dassert(record.id > highestId);
+            highestId = record.id;
+        }
+    } else if (_isCapped) {
+        // Take the mutex once for the whole batch rather than once per record.
+        stdx::lock_guard<stdx::mutex> lk(_uncommittedRecordIdsMutex);
+        for (size_t i = 0; i < nRecords; i++) {
+            auto& record = records[i];
             record.id = _nextId();
             _addUncommittedRecordId_inlock(opCtx, record.id);
-        } else {
+            dassert(record.id > highestId);
+            highestId = record.id;
+        }
+    } else {
+        for (size_t i = 0; i < nRecords; i++) {
+            auto& record = records[i];
             record.id = _nextId();
+            dassert(record.id > highestId);
+            highestId = record.id;
         }
-        dassert(record.id > highestId);
-        highestId = record.id;
     }
 
     if (_useOplogHack && (highestId > _oplog_highestSeen)) {
@@ -1953,6 +1997,46 @@ std::unique_ptr<RecordCursor> StandardWiredTigerRecordStore::getRandomCursorWith
     return stdx::make_unique<RandomCursor>(opCtx, *this, extraConfig);
 }
 
+std::vector<std::unique_ptr<RecordCursor>> StandardWiredTigerRecordStore::getManyCursors(
+    OperationContext* opCtx) const {
+    // Don't bother splitting collections where a partition would be smaller than this; the
+    // per-cursor overhead would outweigh the parallelism.
+    static const long long kMinRecordsPerCursor = 8 * 1024;
+    static const long long kMaxCursors = 64;
+
+    std::vector<std::unique_ptr<RecordCursor>> cursors;
+
+    // Capped collections have insert-order visibility rules that the range cursors do not
+    // implement, so they always get a single standard cursor.
+    const long long records = numRecords(opCtx);
+    if (isCapped() || records < 2 * kMinRecordsPerCursor) {
+        cursors.push_back(getCursor(opCtx, /*forward=*/true));
+        return cursors;
+    }
+
+    // Find the highest assigned RecordId in our snapshot; ids run from 1 up to it.
+    auto reverseCursor = getCursor(opCtx, /*forward=*/false);
+    auto lastRecord = reverseCursor->next();
+    if (!lastRecord) {
+        cursors.push_back(getCursor(opCtx, /*forward=*/true));
+        return cursors;
+    }
+    const int64_t maxId = lastRecord->id.repr();
+
+    // Split the id space into contiguous, equally wide ranges. RecordIds are allocated
+    // densely by _nextId() so this yields roughly equal partitions unless deletions have
+    // been heavily skewed toward one end of the collection.
+    const long long numCursors = std::min(kMaxCursors, records / kMinRecordsPerCursor);
+    for (long long i = 0; i < numCursors; i++) {
+        const RecordId start(1 + maxId * i / numCursors);
+        const RecordId end(i + 1 == numCursors ? RecordId()
+                                               : RecordId(1 + maxId * (i + 1) / numCursors));
+        cursors.push_back(
+            stdx::make_unique<WiredTigerRecordStoreRangeCursor>(opCtx, *this, start, end));
+    }
+    return cursors;
+}
+
 WiredTigerRecordStoreStandardCursor::WiredTigerRecordStoreStandardCursor(
     OperationContext* opCtx, const WiredTigerRecordStore& rs, bool forward)
     : WiredTigerRecordStoreCursorBase(opCtx, rs, forward) {}
@@ -1974,6 +2058,32 @@ bool WiredTigerRecordStoreStandardCursor::hasWrongPrefix(WT_CURSOR* cursor,
     return false;
 }
 
+WiredTigerRecordStoreRangeCursor::WiredTigerRecordStoreRangeCursor(OperationContext* opCtx,
+                                                                   const WiredTigerRecordStore& rs,
+                                                                   RecordId start,
+                                                                   RecordId end)
+    : WiredTigerRecordStoreStandardCursor(opCtx, rs, /*forward=*/true), _endExclusive(end) {
+    // Position just before 'start' by pretending the record preceding the range was the last
+    // one returned, then let restore()'s search_near() repositioning find the first record
+    // with id >= 'start'. When 'start' is the first possible id this leaves _lastReturnedId
+    // null and the cursor simply begins at the head of the table.
+    invariant(!start.isNull());
+    _lastReturnedId = RecordId(start.repr() - 1);
+    restore();
+}
+
+boost::optional<Record> WiredTigerRecordStoreRangeCursor::next() {
+    if (_eof)
+        return {};
+
+    auto record = WiredTigerRecordStoreStandardCursor::next();
+    if (record && !_endExclusive.isNull() && record->id >= _endExclusive) {
+        _eof = true;
+        return {};
+    }
+    return record;
+}
+
 
 // Prefixed Implementations:
 
@@ -176,7 +176,8 @@ public:
     virtual std::unique_ptr<RecordCursor> getRandomCursorWithOptions(
         OperationContext* opCtx, StringData extraConfig) const = 0;
 
-    std::vector<std::unique_ptr<RecordCursor>> getManyCursors(OperationContext* opCtx) const final;
+    virtual std::vector<std::unique_ptr<RecordCursor>> getManyCursors(
+        OperationContext* opCtx) const;
 
     virtual Status truncate(OperationContext* opCtx);
 
@@ -328,8 +329,6 @@ private:
     CappedCallback* _cappedCallback;
     stdx::mutex _cappedCallbackMutex;  // guards _cappedCallback.
 
-    // See comment in ::cappedDeleteAsNeeded
-    int _cappedDeleteCheckCount;
     mutable stdx::timed_mutex _cappedDeleterMutex;
 
     const bool _useOplogHack;
@@ -368,6 +367,15 @@ public:
     virtual std::unique_ptr<RecordCursor> getRandomCursorWithOptions(
         OperationContext* opCtx, StringData extraConfig) const override;
 
+    /**
+     * Partitions the collection into contiguous RecordId ranges, one forward cursor per
+     * range, so that callers (e.g. the parallelCollectionScan command) can drive the ranges
+     * concurrently from separate operation contexts. Falls back to a single cursor for
+     * capped or small collections.
+     */
+    virtual std::vector<std::unique_ptr<RecordCursor>> getManyCursors(
+        OperationContext* opCtx) const override;
+
 protected:
     virtual RecordId getKey(WT_CURSOR* cursor) const;
 
@@ -467,7 +475,7 @@ private:
     bool isVisible(const RecordId& id);
 };
 
-class WiredTigerRecordStoreStandardCursor final : public WiredTigerRecordStoreCursorBase {
+class WiredTigerRecordStoreStandardCursor : public WiredTigerRecordStoreCursorBase {
 public:
     WiredTigerRecordStoreStandardCursor(OperationContext* opCtx,
                                         const WiredTigerRecordStore& rs,
@@ -490,6 +498,25 @@ protected:
     virtual void initCursorToBeginning(){};
 };
 
+/**
+ * A forward cursor over the half-open RecordId range ['start', 'end'). Produced by
+ * StandardWiredTigerRecordStore::getManyCursors() so that contiguous partitions of a
+ * collection can be scanned independently. A null 'end' leaves the range unbounded on the
+ * right.
+ */
+class WiredTigerRecordStoreRangeCursor final : public WiredTigerRecordStoreStandardCursor {
+public:
+    WiredTigerRecordStoreRangeCursor(OperationContext* opCtx,
+                                     const WiredTigerRecordStore& rs,
+                                     RecordId start,
+                                     RecordId end);
+
+    boost::optional<Record> next();
+
+private:
+    const RecordId _endExclusive;
+};
+
 class WiredTigerRecordStorePrefixedCursor final : public WiredTigerRecordStoreCursorBase {
 public:
     WiredTigerRecordStorePrefixedCursor(OperationContext* opCtx,
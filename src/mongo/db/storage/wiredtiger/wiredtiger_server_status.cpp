@@ -54,6 +54,12 @@ bool WiredTigerServerStatusSection::includeByDefault() const {
     return true;
 }
 
+Milliseconds WiredTigerServerStatusSection::cacheTTL() const {
+    // Marshalling the statistics cursor is expensive enough that concurrent monitoring pollers
+    // should share one result rather than each walking it.
+    return Milliseconds(500);
+}
+
 BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                                                        const BSONElement& configElement) const {
     // The session does not open a transaction here as one is not needed and opening one would
@@ -76,6 +82,8 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
 
     WiredTigerKVEngine::appendGlobalStats(bob);
 
+    _engine->getSessionCache()->appendGroupCommitStats(bob);
+
     return bob.obj();
 }
 
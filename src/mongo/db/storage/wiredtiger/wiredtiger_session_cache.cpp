@@ -35,7 +35,11 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#include <iterator>
+
 #include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/storage/journal_listener.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
@@ -43,9 +47,16 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
+// How long, in microseconds, the thread that wins the right to sync the journal waits before
+// syncing, so that writers committing in the meantime are covered by the same sync instead of
+// queueing up for their own. Raising this trades up to that much added j:true latency for
+// larger commit groups. 0 disables the window.
+MONGO_EXPORT_SERVER_PARAMETER(wiredTigerJournalGroupWindowMicros, int, 0);
+
 WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn, uint64_t epoch, uint64_t cursorEpoch)
     : _epoch(epoch),
       _cursorEpoch(cursorEpoch),
@@ -77,15 +88,20 @@ WiredTigerSession::~WiredTigerSession() {
 }
 
 WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri, uint64_t id, bool forRecordStore) {
-    // Find the most recently used cursor
-    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        if (i->_id == id) {
-            WT_CURSOR* c = i->_cursor;
-            _cursors.erase(i);
-            _cursorsOut++;
-            _cursorsCached--;
-            return c;
+    // Find the most recently used cursor for this table
+    auto indexIt = _cursorIndex.find(id);
+    if (indexIt != _cursorIndex.end()) {
+        invariant(!indexIt->second.empty());
+        CursorCache::iterator i = indexIt->second.back();
+        indexIt->second.pop_back();
+        if (indexIt->second.empty()) {
+            _cursorIndex.erase(indexIt);
         }
+        WT_CURSOR* c = i->_cursor;
+        _cursors.erase(i);
+        _cursorsOut++;
+        _cursorsCached--;
+        return c;
     }
 
     WT_CURSOR* c = NULL;
@@ -107,6 +123,7 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
 
     // Cursors are pushed to the front of the list and removed from the back
     _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
+    _cursorIndex[id].push_back(_cursors.begin());
     _cursorsCached++;
 
     // "Old" is defined as not used in the last N**2 operations, if we have N cursors cached.
@@ -115,7 +132,18 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
     // would like to cache N cursors in that case, so any given cursor could go N**2 operations
     // in between use.
     while (_cursorGen - _cursors.back()._gen > 10000) {
-        cursor = _cursors.back()._cursor;
+        CursorCache::iterator last = std::prev(_cursors.end());
+
+        // The list's back is the globally oldest entry, so for its id it must be the oldest as
+        // well, which is the front of that id's iterator vector.
+        auto indexIt = _cursorIndex.find(last->_id);
+        invariant(indexIt != _cursorIndex.end() && indexIt->second.front() == last);
+        indexIt->second.erase(indexIt->second.begin());
+        if (indexIt->second.empty()) {
+            _cursorIndex.erase(indexIt);
+        }
+
+        cursor = last->_cursor;
         _cursors.pop_back();
         _cursorsCached--;
         invariantWTOK(cursor->close(cursor));
@@ -125,14 +153,19 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
 void WiredTigerSession::closeAllCursors(const std::string& uri) {
     invariant(_session);
 
+    bool removed = false;
     for (auto i = _cursors.begin(); i != _cursors.end();) {
         WT_CURSOR* cursor = i->_cursor;
         if (cursor && uri == cursor->uri) {
             invariantWTOK(cursor->close(cursor));
             i = _cursors.erase(i);
+            removed = true;
         } else
             ++i;
     }
+    if (removed) {
+        _rebuildCursorIndex();
+    }
 }
 
 void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
@@ -141,6 +174,10 @@ void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
     _cursorEpoch = _cache->getCursorEpoch();
     auto toDrop = engine->filterCursorsWithQueuedDrops(&_cursors);
 
+    if (!toDrop.empty()) {
+        _rebuildCursorIndex();
+    }
+
     for (auto i = toDrop.begin(); i != toDrop.end(); i++) {
         WT_CURSOR* cursor = i->_cursor;
         if (cursor) {
@@ -149,6 +186,15 @@ void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
     }
 }
 
+void WiredTigerSession::_rebuildCursorIndex() {
+    _cursorIndex.clear();
+    // The list is ordered newest to oldest, and each id's iterator vector oldest to newest.
+    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
+        auto& iters = _cursorIndex[i->_id];
+        iters.insert(iters.begin(), i);
+    }
+}
+
 namespace {
 AtomicUInt64 nextTableId(1);
 }
@@ -226,8 +272,18 @@ void WiredTigerSessionCache::waitUntilDurable(bool forceCheckpoint) {
     uint32_t current = _lastSyncTime.loadRelaxed();  // synchronized with writes through mutex
     if (current != start) {
         // Someone else synced already since we read lastSyncTime, so we're done!
+        _journalSyncsCoalesced.fetchAndAdd(1);
         return;
     }
+
+    // Before claiming the sync, optionally wait so that writers committing right now are covered
+    // by our sync and take the coalesced path above rather than queueing up for their own.
+    // Threads that arrive during the window block on _lastSyncMutex and observe the bumped
+    // _lastSyncTime once we're done.
+    const int groupWindowMicros = wiredTigerJournalGroupWindowMicros.load();
+    if (groupWindowMicros > 0) {
+        sleepmicros(groupWindowMicros);
+    }
     _lastSyncTime.store(current + 1);
 
     // Nobody has synched yet, so we have to sync ourselves.
@@ -247,13 +303,29 @@ void WiredTigerSessionCache::waitUntilDurable(bool forceCheckpoint) {
         invariantWTOK(s->checkpoint(s, NULL));
         LOG(4) << "created checkpoint";
     }
+    _journalSyncs.fetchAndAdd(1);
     _journalListener->onDurable(token);
 }
 
+void WiredTigerSessionCache::appendGroupCommitStats(BSONObjBuilder& b) const {
+    BSONObjBuilder bb(b.subobjStart("journalGroupCommits"));
+    bb.append("syncs", static_cast<long long>(_journalSyncs.load()));
+    bb.append("coalescedWaiters", static_cast<long long>(_journalSyncsCoalesced.load()));
+    bb.append("groupWindowMicros", wiredTigerJournalGroupWindowMicros.load());
+    bb.done();
+}
+
+WiredTigerSessionCache::SessionCacheShard& WiredTigerSessionCache::_getShard() {
+    return _shards[std::hash<std::thread::id>()(stdx::this_thread::get_id()) % kNumSessionShards];
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (size_t i = 0; i < kNumSessionShards; i++) {
+        stdx::lock_guard<stdx::mutex> lock(_shards[i].lock);
+        SessionCache& sessions = _shards[i].sessions;
+        for (SessionCache::iterator j = sessions.begin(); j != sessions.end(); j++) {
+            (*j)->closeAllCursors(uri);
+        }
     }
 }
 
@@ -261,20 +333,28 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (size_t i = 0; i < kNumSessionShards; i++) {
+        stdx::lock_guard<stdx::mutex> lock(_shards[i].lock);
+        SessionCache& sessions = _shards[i].sessions;
+        for (SessionCache::iterator j = sessions.begin(); j != sessions.end(); j++) {
+            (*j)->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. The increment
+    // happens before any shard is swept, and releaseSession() rechecks the epoch under the shard
+    // lock, so no session from the old epoch can be returned to a shard that has already been
+    // emptied here.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    SessionCache swap;
+    for (size_t i = 0; i < kNumSessionShards; i++) {
+        stdx::lock_guard<stdx::mutex> lock(_shards[i].lock);
+        SessionCache& sessions = _shards[i].sessions;
+        swap.insert(swap.end(), sessions.begin(), sessions.end());
+        sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -292,12 +372,24 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
+        SessionCacheShard& shard = _getShard();
+        stdx::lock_guard<stdx::mutex> lock(shard.lock);
+        if (!shard.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = shard.sessions.back();
+            shard.sessions.pop_back();
+            return UniqueWiredTigerSession(cachedSession);
+        }
+    }
+
+    // Our shard is empty; steal an idle session from another shard before paying for a new
+    // WT_SESSION.
+    for (size_t i = 0; i < kNumSessionShards; i++) {
+        stdx::lock_guard<stdx::mutex> lock(_shards[i].lock);
+        if (!_shards[i].sessions.empty()) {
+            WiredTigerSession* cachedSession = _shards[i].sessions.back();
+            _shards[i].sessions.pop_back();
             return UniqueWiredTigerSession(cachedSession);
         }
     }
@@ -346,10 +438,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     uint64_t currentEpoch = _epoch.load();
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+        SessionCacheShard& shard = _getShard();
+        stdx::lock_guard<stdx::mutex> lock(shard.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            shard.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
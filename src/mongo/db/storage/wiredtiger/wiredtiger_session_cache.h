@@ -33,6 +33,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -40,10 +41,12 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_snapshot_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/spin_lock.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
 class WiredTigerKVEngine;
 class WiredTigerSessionCache;
 
@@ -117,6 +120,12 @@ private:
     // The cursor cache is a list of pairs that contain an ID and cursor
     typedef std::list<WiredTigerCachedCursor> CursorCache;
 
+    /**
+     * Rebuilds '_cursorIndex' from '_cursors'. Called after operations that remove arbitrary
+     * entries from the cursor cache (all of which are DDL-driven and rare).
+     */
+    void _rebuildCursorIndex();
+
     // Used internally by WiredTigerSessionCache
     uint64_t _getEpoch() const {
         return _epoch;
@@ -132,6 +141,11 @@ private:
     WiredTigerSessionCache* _cache;  // not owned
     WT_SESSION* _session;            // owned
     CursorCache _cursors;            // owned
+
+    // Indexes '_cursors' by table id so the per-operation cursor checkout is a hash lookup
+    // instead of a list scan. For each id the iterators are ordered oldest to newest.
+    stdx::unordered_map<uint64_t, std::vector<CursorCache::iterator>> _cursorIndex;
+
     uint64_t _cursorGen;
     int _cursorsCached, _cursorsOut;
 };
@@ -193,6 +207,12 @@ public:
      */
     void waitUntilDurable(bool forceCheckpoint);
 
+    /**
+     * Appends group-commit statistics for waitUntilDurable (sync count, waiters satisfied
+     * without their own sync, configured window) to 'b', under "journalGroupCommits".
+     */
+    void appendGroupCommitStats(BSONObjBuilder& b) const;
+
     WT_CONNECTION* conn() const {
         return _conn;
     }
@@ -221,9 +241,23 @@ private:
     AtomicUInt32 _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // Idle sessions are sharded into several independently locked free-lists, keyed by the
+    // calling thread, so that getSession()/releaseSession() traffic from many client threads
+    // does not all serialize on a single mutex. A thread whose shard is empty steals from the
+    // other shards before paying for a new WT_SESSION.
+    struct SessionCacheShard {
+        stdx::mutex lock;
+        SessionCache sessions;
+    };
+    static const size_t kNumSessionShards = 16;
+    SessionCacheShard _shards[kNumSessionShards];
+
+    /**
+     * Returns the shard the calling thread checks sessions in and out of.
+     */
+    SessionCacheShard& _getShard();
 
     // Bumped when all open sessions need to be closed
     AtomicUInt64 _epoch;  // atomic so we can check it outside of the lock
@@ -235,6 +269,11 @@ private:
     AtomicUInt32 _lastSyncTime;
     stdx::mutex _lastSyncMutex;
 
+    // Group-commit statistics for waitUntilDurable: how many syncs we have performed, and how
+    // many callers were satisfied by another thread's sync without performing their own.
+    AtomicUInt64 _journalSyncs;
+    AtomicUInt64 _journalSyncsCoalesced;
+
     // Notified when we commit to the journal.
     JournalListener* _journalListener = &NoOpJournalListener::instance;
     // Protects _journalListener.
@@ -72,6 +72,12 @@ ServerStatusMetricField<Counter64> ttlDeletedDocumentsDisplay("ttl.deletedDocume
 MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorEnabled, bool, true);
 MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorSleepSecs, int, 60);  // used for testing
 
+// Maximum number of documents deleted per batch within a TTL pass; zero or a negative value
+// deletes everything expired in one unbounded batch. Between batches the TTL monitor releases
+// the collection lock and sleeps ttlMonitorBatchPauseMS so foreground operations get through.
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorBatchSize, int, 1000);
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorBatchPauseMS, int, 10);
+
 class TTLMonitor : public BackgroundJob {
 public:
     TTLMonitor() {}
@@ -167,6 +173,10 @@ private:
     /**
      * Remove documents from the collection using the specified TTL index after a sufficient amount
      * of time has passed according to its expiry specification.
+     *
+     * Deletes in batches of at most ttlMonitorBatchSize documents, dropping the collection lock
+     * and sleeping ttlMonitorBatchPauseMS between batches, so that a large expired backlog is
+     * drained without monopolizing the collection for the length of the whole pass.
      */
     void doTTLForIndex(OperationContext* opCtx, BSONObj idx) {
         const NamespaceString collectionNSS(idx["ns"].String());
@@ -180,30 +190,63 @@ private:
         }
 
         const BSONObj key = idx["key"].Obj();
-        const StringData name = idx["name"].valueStringData();
         if (key.nFields() != 1) {
             error() << "key for ttl index can only have 1 field, skipping ttl job for: " << idx;
             return;
         }
 
+        const long long batchSize = ttlMonitorBatchSize.load();
+        while (true) {
+            long long numDeleted = 0;
+            if (!doTTLDeleteBatch(opCtx, idx, batchSize, &numDeleted)) {
+                return;
+            }
+
+            ttlDeletedDocuments.increment(numDeleted);
+            LOG(1) << "deleted: " << numDeleted;
+
+            if (batchSize <= 0 || numDeleted < batchSize) {
+                return;
+            }
+
+            // More expired documents remain. Let foreground operations through before taking
+            // the collection lock again.
+            sleepmillis(ttlMonitorBatchPauseMS.load());
+        }
+    }
+
+    /**
+     * Runs a single bounded delete over the expired range of 'idx', removing at most 'batchSize'
+     * documents (all expired documents if 'batchSize' is zero or negative). Returns false if no
+     * further batches should be attempted for this index; on success, reports the number of
+     * documents deleted in 'numDeleted'.
+     */
+    bool doTTLDeleteBatch(OperationContext* opCtx,
+                          BSONObj idx,
+                          long long batchSize,
+                          long long* numDeleted) {
+        const NamespaceString collectionNSS(idx["ns"].String());
+        const BSONObj key = idx["key"].Obj();
+        const StringData name = idx["name"].valueStringData();
+
         LOG(1) << "ns: " << collectionNSS << " key: " << key << " name: " << name;
 
         AutoGetCollection autoGetCollection(opCtx, collectionNSS, MODE_IX);
         Collection* collection = autoGetCollection.getCollection();
         if (!collection) {
             // Collection was dropped.
-            return;
+            return false;
         }
 
         if (!repl::getGlobalReplicationCoordinator()->canAcceptWritesFor(opCtx, collectionNSS)) {
-            return;
+            return false;
         }
 
         IndexDescriptor* desc = collection->getIndexCatalog()->findIndexByName(opCtx, name);
         if (!desc) {
             LOG(1) << "index not found (index build in progress? index dropped?), skipping "
                    << "ttl job for: " << idx;
-            return;
+            return false;
         }
 
         // Re-read 'idx' from the descriptor, in case the collection or index definition changed
@@ -212,7 +255,7 @@ private:
 
         if (IndexType::INDEX_BTREE != IndexNames::nameToType(desc->getAccessMethodName())) {
             error() << "special index can't be used as a ttl index, skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         BSONElement secondsExpireElt = idx[secondsExpireField];
@@ -220,7 +263,7 @@ private:
             error() << "ttl indexes require the " << secondsExpireField << " field to be "
                     << "numeric but received a type of " << typeName(secondsExpireElt.type())
                     << ", skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         const Date_t kDawnOfTime =
@@ -249,6 +292,9 @@ private:
         DeleteStageParams params;
         params.isMulti = true;
         params.canonicalQuery = canonicalQuery.getValue().get();
+        if (batchSize > 0) {
+            params.limit = batchSize;
+        }
 
         auto exec =
             InternalPlanner::deleteWithIndexScan(opCtx,
@@ -265,12 +311,11 @@ private:
         if (!result.isOK()) {
             error() << "ttl query execution for index " << idx
                     << " failed with status: " << redact(result);
-            return;
+            return false;
         }
 
-        const long long numDeleted = DeleteStage::getNumDeleted(*exec);
-        ttlDeletedDocuments.increment(numDeleted);
-        LOG(1) << "deleted: " << numDeleted;
+        *numDeleted = DeleteStage::getNumDeleted(*exec);
+        return true;
     }
 };
 
@@ -0,0 +1,299 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+/** @file exec_perftests.cpp : micro-benchmarks for individual PlanStages.
+ *
+ *        In the spirit of perftests.cpp, these run quickly enough to be part of the normal
+ *        dbtest run and report throughput rather than asserting on it, so regressions in the
+ *        exec layer show up in the "stats" lines of the test output.  Each benchmark drives a
+ *        single stage (or a minimal stage tree) directly via work() over a small synthetic
+ *        collection in whatever storage engine dbtest was started with; run with
+ *        --storageEngine ephemeralForTest to measure the exec layer without I/O effects.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/client.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/collection_scan.h"
+#include "mongo/db/exec/index_scan.h"
+#include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/projection.h"
+#include "mongo/db/exec/sort.h"
+#include "mongo/db/exec/sort_key_generator.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/matcher/extensions_callback_disallow_extensions.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/dbtests/dbtests.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/util/debug_util.h"
+#include "mongo/util/timer.h"
+
+namespace ExecPerfTests {
+
+using std::cout;
+using std::endl;
+using std::fixed;
+using std::left;
+using std::right;
+using std::setprecision;
+using std::setw;
+using std::string;
+using stdx::make_unique;
+
+/**
+ * Base class for a PlanStage benchmark.  Populates a synthetic collection, repeatedly runs
+ * timed() until howLongMillis() has elapsed, then reports docs/sec and ns/doc for the
+ * documents the stage produced.
+ */
+class StageBench {
+public:
+    StageBench() : _client(&_opCtx) {}
+
+    virtual ~StageBench() {}
+
+    void run() {
+        {
+            OldClientWriteContext ctx(&_opCtx, ns());
+            for (int i = 0; i < numDocs(); ++i) {
+                _client.insert(ns(), BSON("foo" << i << "bar" << numDocs() - i));
+            }
+        }
+        prep();
+
+        int hlm = howLongMillis();
+        DEV {
+            // Debug build timings aren't meaningful; just verify that the benchmark runs.
+            hlm = std::min(hlm, 100);
+        }
+
+        Timer t;
+        unsigned long long docs = 0;
+        do {
+            docs += timed();
+        } while (t.micros() < hlm * 1000LL);
+        say(docs, t.micros());
+
+        {
+            OldClientWriteContext ctx(&_opCtx, ns());
+            _client.dropCollection(ns());
+        }
+    }
+
+protected:
+    virtual string name() = 0;
+
+    /**
+     * One timed pass of the stage under test over the collection.  Returns the number of
+     * documents the stage produced.
+     */
+    virtual size_t timed() = 0;
+
+    // Extra setup (e.g. index builds) after the documents are inserted.
+    virtual void prep() {}
+
+    virtual int howLongMillis() {
+        return 2000;
+    }
+
+    static int numDocs() {
+        return 10000;
+    }
+
+    static const char* ns() {
+        return "unittests.ExecPerfTests";
+    }
+
+    // Works 'root' to EOF, freeing produced members so the WorkingSet doesn't grow.
+    size_t drain(PlanStage* root, WorkingSet* ws) {
+        size_t count = 0;
+        while (!root->isEOF()) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = root->work(&id);
+            if (PlanStage::ADVANCED == state) {
+                ws->free(id);
+                ++count;
+            } else {
+                verify(PlanStage::FAILURE != state && PlanStage::DEAD != state);
+            }
+        }
+        return count;
+    }
+
+    void addIndex(const BSONObj& spec) {
+        ASSERT_OK(dbtests::createIndex(&_opCtx, ns(), spec));
+    }
+
+    IndexDescriptor* getIndex(const BSONObj& spec, Collection* collection) {
+        std::vector<IndexDescriptor*> indexes;
+        collection->getIndexCatalog()->findIndexesByKeyPattern(&_opCtx, spec, false, &indexes);
+        verify(!indexes.empty());
+        return indexes[0];
+    }
+
+    void say(unsigned long long docs, long long micros) {
+        const unsigned long long docsPerSec = (docs * 1000 * 1000) / (micros > 0 ? micros : 1);
+        const double nsPerDoc = docs > 0 ? (micros * 1000.0) / docs : 0.0;
+        cout << "stats " << setw(30) << left << name() << ' ' << right << setw(10) << docsPerSec
+             << " docs/sec " << right << setw(9) << fixed << setprecision(1) << nsPerDoc
+             << " ns/doc" << endl;
+    }
+
+    const ServiceContext::UniqueOperationContext _txnPtr = cc().makeOperationContext();
+    OperationContext& _opCtx = *_txnPtr;
+    DBDirectClient _client;
+};
+
+// Full forward collection scan, no filter.
+class CollScanBench : public StageBench {
+public:
+    string name() {
+        return "exec_collscan";
+    }
+
+    size_t timed() {
+        AutoGetCollectionForReadCommand ctx(&_opCtx, NamespaceString(ns()));
+
+        CollectionScanParams params;
+        params.collection = ctx.getCollection();
+        params.direction = CollectionScanParams::FORWARD;
+        params.tailable = false;
+
+        WorkingSet ws;
+        CollectionScan scan(&_opCtx, params, &ws, NULL);
+        return drain(&scan, &ws);
+    }
+};
+
+// Full index scan over {foo: 1}, no filter.
+class IxScanBench : public StageBench {
+public:
+    void prep() {
+        addIndex(BSON("foo" << 1));
+    }
+
+    string name() {
+        return "exec_ixscan";
+    }
+
+    size_t timed() {
+        AutoGetCollectionForReadCommand ctx(&_opCtx, NamespaceString(ns()));
+
+        IndexScanParams params;
+        params.descriptor = getIndex(BSON("foo" << 1), ctx.getCollection());
+        params.bounds.isSimpleRange = true;
+        params.bounds.startKey = BSON("" << 0);
+        params.bounds.endKey = BSON("" << numDocs());
+        params.bounds.boundInclusion = BoundInclusion::kIncludeBothStartAndEndKeys;
+        params.direction = 1;
+
+        WorkingSet ws;
+        IndexScan scan(&_opCtx, params, &ws, NULL);
+        return drain(&scan, &ws);
+    }
+};
+
+// Blocking sort of the whole collection by a field the insertion order doesn't match.
+class SortBench : public StageBench {
+public:
+    string name() {
+        return "exec_sort";
+    }
+
+    size_t timed() {
+        AutoGetCollectionForReadCommand ctx(&_opCtx, NamespaceString(ns()));
+
+        auto ws = make_unique<WorkingSet>();
+
+        CollectionScanParams csParams;
+        csParams.collection = ctx.getCollection();
+        csParams.direction = CollectionScanParams::FORWARD;
+        csParams.tailable = false;
+        auto scan = make_unique<CollectionScan>(&_opCtx, csParams, ws.get(), nullptr);
+
+        SortStageParams params;
+        params.collection = ctx.getCollection();
+        params.pattern = BSON("bar" << 1);
+        params.limit = 0;
+
+        auto keyGenStage = make_unique<SortKeyGeneratorStage>(
+            &_opCtx, scan.release(), ws.get(), params.pattern, nullptr);
+
+        SortStage sort(&_opCtx, params, ws.get(), keyGenStage.release());
+        return drain(&sort, ws.get());
+    }
+};
+
+// Simple inclusion projection over a collection scan, using the SIMPLE_DOC fast path.
+class ProjectionBench : public StageBench {
+public:
+    string name() {
+        return "exec_projection";
+    }
+
+    size_t timed() {
+        AutoGetCollectionForReadCommand ctx(&_opCtx, NamespaceString(ns()));
+
+        auto ws = make_unique<WorkingSet>();
+
+        CollectionScanParams csParams;
+        csParams.collection = ctx.getCollection();
+        csParams.direction = CollectionScanParams::FORWARD;
+        csParams.tailable = false;
+        auto scan = make_unique<CollectionScan>(&_opCtx, csParams, ws.get(), nullptr);
+
+        ProjectionStageParams params(ExtensionsCallbackDisallowExtensions());
+        params.projImpl = ProjectionStageParams::SIMPLE_DOC;
+        params.projObj = BSON("_id" << 0 << "foo" << 1);
+
+        ProjectionStage proj(&_opCtx, params, ws.get(), scan.release());
+        return drain(&proj, ws.get());
+    }
+};
+
+class All : public Suite {
+public:
+    All() : Suite("execperf") {}
+
+    void setupTests() {
+        add<CollScanBench>();
+        add<IxScanBench>();
+        add<SortBench>();
+        add<ProjectionBench>();
+    }
+};
+
+SuiteInstance<All> all;
+}  // namespace ExecPerfTests
@@ -619,6 +619,12 @@ public:
         assertEquals(bson(), fromjson(tojson(bson())), "mode: <default>");
         assertEquals(bson(), fromjson(tojson(bson(), Strict)), "mode: strict");
         assertEquals(bson(), fromjson(tojson(bson(), TenGen)), "mode: tengen");
+
+        // The streaming overload must produce the same BSON as the throwing one.
+        BSONObjBuilder streamed;
+        Status status = fromjson(json(), &streamed);
+        ASSERT(status.isOK());
+        assertEquals(bson(), streamed.obj(), "mode: json-to-builder");
     }
 
 protected:
@@ -0,0 +1,230 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+/** @file matcher_perftests.cpp : micro-benchmarks for MatchExpression evaluation.
+ *
+ *        In the spirit of exec_perftests.cpp, these run quickly enough to be part of the
+ *        normal dbtest run and report throughput rather than asserting on it, so matcher
+ *        regressions show up in the "stats" lines of the test output.  Each benchmark parses
+ *        one representative predicate once and then drives matches() over an in-memory
+ *        generated corpus; no collection or storage engine is involved.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "mongo/db/json.h"
+#include "mongo/db/matcher/extensions_callback_disallow_extensions.h"
+#include "mongo/db/matcher/matcher.h"
+#include "mongo/dbtests/dbtests.h"
+#include "mongo/util/debug_util.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/timer.h"
+
+namespace MatcherPerfTests {
+
+using std::cout;
+using std::endl;
+using std::fixed;
+using std::left;
+using std::right;
+using std::setprecision;
+using std::setw;
+using std::string;
+using std::vector;
+
+/**
+ * Base class for a matcher benchmark.  Subclasses supply the predicate and the corpus;
+ * run() parses the predicate once, repeatedly sweeps the corpus until howLongMillis() has
+ * elapsed, and reports docs/sec and ns/doc.
+ */
+class MatcherBench {
+public:
+    virtual ~MatcherBench() {}
+
+    void run() {
+        const vector<BSONObj> corpus = makeCorpus();
+        const CollatorInterface* collator = nullptr;
+        Matcher matcher(query(), ExtensionsCallbackDisallowExtensions(), collator);
+
+        int hlm = howLongMillis();
+        DEV {
+            // Debug build timings aren't meaningful; just verify that the benchmark runs.
+            hlm = std::min(hlm, 100);
+        }
+
+        Timer t;
+        unsigned long long docs = 0;
+        unsigned long long matched = 0;
+        do {
+            for (auto&& doc : corpus) {
+                if (matcher.matches(doc)) {
+                    ++matched;
+                }
+            }
+            docs += corpus.size();
+        } while (t.micros() < hlm * 1000LL);
+        const long long micros = t.micros();
+
+        // Defeat any temptation of the optimizer to discard match results.
+        verify(matched <= docs);
+
+        const unsigned long long docsPerSec = (docs * 1000 * 1000) / (micros > 0 ? micros : 1);
+        const double nsPerDoc = docs > 0 ? (micros * 1000.0) / docs : 0.0;
+        cout << "stats " << setw(30) << left << name() << ' ' << right << setw(10) << docsPerSec
+             << " docs/sec " << right << setw(9) << fixed << setprecision(1) << nsPerDoc
+             << " ns/doc" << endl;
+    }
+
+protected:
+    virtual string name() = 0;
+
+    // The predicate under test.
+    virtual BSONObj query() = 0;
+
+    // The corpus swept by each timed pass.
+    virtual vector<BSONObj> makeCorpus() = 0;
+
+    virtual int howLongMillis() {
+        return 2000;
+    }
+
+    static const int kCorpusSize = 10000;
+
+    // Documents shaped like typical event records: a scalar, a dotted subdocument, an array,
+    // and a short string taking one of two values.
+    static vector<BSONObj> standardCorpus() {
+        vector<BSONObj> corpus;
+        corpus.reserve(kCorpusSize);
+        for (int i = 0; i < kCorpusSize; ++i) {
+            corpus.push_back(BSON("a" << i << "sub" << BSON("b" << i % 100) << "arr"
+                                      << BSON_ARRAY(i << i + 1 << i + 2)
+                                      << "s"
+                                      << (i % 2 ? "frontend-request" : "backend-request")));
+        }
+        return corpus;
+    }
+};
+
+// $eq against a dotted path, exercising per-document path traversal.
+class DottedEqBench : public MatcherBench {
+    string name() {
+        return "matcher_eq_dotted";
+    }
+    BSONObj query() {
+        return fromjson("{'sub.b': 50}");
+    }
+    vector<BSONObj> makeCorpus() {
+        return standardCorpus();
+    }
+};
+
+// $in with a given number of equalities; half the corpus values fall in the list.
+template <int N>
+class InBench : public MatcherBench {
+    string name() {
+        return str::stream() << "matcher_in_" << N;
+    }
+    BSONObj query() {
+        BSONArrayBuilder values;
+        for (int i = 0; i < N; ++i) {
+            values.append(i * 2);
+        }
+        return BSON("a" << BSON("$in" << values.arr()));
+    }
+    vector<BSONObj> makeCorpus() {
+        vector<BSONObj> corpus;
+        corpus.reserve(kCorpusSize);
+        for (int i = 0; i < kCorpusSize; ++i) {
+            // Values span twice the list's range so hits and misses both occur.
+            corpus.push_back(BSON("a" << (i * 4) % (4 * N)));
+        }
+        return corpus;
+    }
+};
+
+// $elemMatch over a small array field.
+class ElemMatchBench : public MatcherBench {
+    string name() {
+        return "matcher_elemmatch";
+    }
+    BSONObj query() {
+        return fromjson("{arr: {$elemMatch: {$gte: 5000, $lt: 5003}}}");
+    }
+    vector<BSONObj> makeCorpus() {
+        return standardCorpus();
+    }
+};
+
+// Anchored-prefix regex over a short string field.
+class RegexPrefixBench : public MatcherBench {
+    string name() {
+        return "matcher_regex_prefix";
+    }
+    BSONObj query() {
+        return fromjson("{s: /^frontend/}");
+    }
+    vector<BSONObj> makeCorpus() {
+        return standardCorpus();
+    }
+};
+
+// Unanchored "contains" regex, the literal-substring prefilter case.
+class RegexContainsBench : public MatcherBench {
+    string name() {
+        return "matcher_regex_contains";
+    }
+    BSONObj query() {
+        return fromjson("{s: /end-req/}");
+    }
+    vector<BSONObj> makeCorpus() {
+        return standardCorpus();
+    }
+};
+
+class All : public Suite {
+public:
+    All() : Suite("matcherperf") {}
+
+    void setupTests() {
+        add<DottedEqBench>();
+        add<InBench<10>>();
+        add<InBench<1000>>();
+        add<InBench<100000>>();
+        add<ElemMatchBench>();
+        add<RegexPrefixBench>();
+        add<RegexContainsBench>();
+    }
+};
+
+SuiteInstance<All> all;
+}  // namespace MatcherPerfTests
@@ -0,0 +1,346 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+/** @file pipeline_perftests.cpp : micro-benchmarks for aggregation DocumentSources.
+ *
+ *        These drive representative pipelines ($match, $group, $sort, $unwind and a combined
+ *        pipeline) over a generated in-memory corpus, so they measure the pipeline layer itself
+ *        rather than the storage and query layers underneath it. A pass-through timing stage is
+ *        interposed between every pair of benchmarked stages, which lets each stage's self time
+ *        be reported separately even though the stages pull from each other. Like the other
+ *        perftests, throughput is printed rather than asserted on. $lookup is not benchmarked
+ *        here because it requires a MongoProcessInterface wired up to foreign collections; it is
+ *        exercised end-to-end by the jstests instead.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "mongo/db/client.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/pipeline/aggregation_request.h"
+#include "mongo/db/pipeline/document.h"
+#include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/dbtests/dbtests.h"
+#include "mongo/util/debug_util.h"
+#include "mongo/util/timer.h"
+
+namespace PipelinePerfTests {
+
+using boost::intrusive_ptr;
+using std::cout;
+using std::endl;
+using std::fixed;
+using std::left;
+using std::right;
+using std::setprecision;
+using std::setw;
+using std::string;
+using std::vector;
+
+static const NamespaceString nss("unittests.PipelinePerfTests");
+
+/**
+ * A pass-through DocumentSource that records how long its source took to produce each result and
+ * how many documents it produced. Bracketing a benchmarked stage with two of these gives the
+ * stage's self time as the difference of the two accumulated times.
+ */
+class DocumentSourceTimer final : public DocumentSource {
+public:
+    static intrusive_ptr<DocumentSourceTimer> create(
+        const intrusive_ptr<ExpressionContext>& expCtx) {
+        return new DocumentSourceTimer(expCtx);
+    }
+
+    GetNextResult getNext() final {
+        Timer timer;
+        auto next = pSource->getNext();
+        _micros += timer.micros();
+        if (next.isAdvanced()) {
+            ++_docs;
+        }
+        return next;
+    }
+
+    const char* getSourceName() const final {
+        return "$_timer";
+    }
+
+    Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final {
+        MONGO_UNREACHABLE;  // Only interposed inside benchmarks; never serialized.
+    }
+
+    long long micros() const {
+        return _micros;
+    }
+
+    size_t docs() const {
+        return _docs;
+    }
+
+private:
+    explicit DocumentSourceTimer(const intrusive_ptr<ExpressionContext>& expCtx)
+        : DocumentSource(expCtx) {}
+
+    long long _micros = 0;
+    size_t _docs = 0;
+};
+
+/**
+ * Base class for a pipeline benchmark. Generates a corpus once, then repeatedly parses the
+ * pipeline given by pipelineSpec(), wires it to a DocumentSourceMock holding the corpus with a
+ * DocumentSourceTimer around every stage, and drains it until howLongMillis() has elapsed.
+ * Reports docs/sec and ns/doc of self time for each stage, plus a line for the whole pipeline.
+ */
+class PipelineBench {
+public:
+    PipelineBench()
+        : _ctx(new ExpressionContextForTest(&_opCtx, AggregationRequest(nss, {}))) {
+        _ctx->tempDir = storageGlobalParams.dbpath + "/_tmp";
+    }
+
+    virtual ~PipelineBench() {}
+
+    void run() {
+        const std::deque<DocumentSource::GetNextResult> corpus = makeCorpus();
+
+        int hlm = howLongMillis();
+        DEV {
+            // Debug build timings aren't meaningful; just verify that the benchmark runs.
+            hlm = std::min(hlm, 100);
+        }
+
+        vector<string> stageNames;
+        vector<long long> selfMicros;
+        vector<unsigned long long> docsOut;
+        long long pipelineMicros = 0;
+        unsigned long long pipelineDocs = 0;
+
+        Timer total;
+        do {
+            runOnce(corpus, &stageNames, &selfMicros, &docsOut, &pipelineMicros, &pipelineDocs);
+        } while (total.micros() < hlm * 1000LL);
+
+        for (size_t i = 0; i < stageNames.size(); i++) {
+            say(name() + ":" + stageNames[i], docsOut[i], selfMicros[i]);
+        }
+        say(name(), pipelineDocs, pipelineMicros);
+    }
+
+protected:
+    virtual string name() = 0;
+
+    // The pipeline under test, one BSON stage spec per entry.
+    virtual vector<BSONObj> pipelineSpec() = 0;
+
+    virtual int howLongMillis() {
+        return 2000;
+    }
+
+    static int numDocs() {
+        return 10000;
+    }
+
+    /**
+     * The default corpus: 'foo' cycles through 100 distinct values, 'bar' is unique and inversely
+     * ordered so sorts can't cheat, and 'tags' is a small array for $unwind.
+     */
+    virtual std::deque<DocumentSource::GetNextResult> makeCorpus() {
+        std::deque<DocumentSource::GetNextResult> corpus;
+        for (int i = 0; i < numDocs(); i++) {
+            corpus.push_back(Document(BSON("_id" << i << "foo" << i % 100 << "bar"
+                                                 << numDocs() - i
+                                                 << "tags"
+                                                 << BSON_ARRAY("a"
+                                                               << "b"
+                                                               << "c"))));
+        }
+        return corpus;
+    }
+
+private:
+    /**
+     * One pass over the corpus with freshly parsed stages, since stages like $group and $sort
+     * accumulate state. Per-stage self times and document counts are added into the output
+     * vectors, which are sized (and 'stageNames' populated) on the first pass.
+     */
+    void runOnce(const std::deque<DocumentSource::GetNextResult>& corpus,
+                 vector<string>* stageNames,
+                 vector<long long>* selfMicros,
+                 vector<unsigned long long>* docsOut,
+                 long long* pipelineMicros,
+                 unsigned long long* pipelineDocs) {
+        vector<intrusive_ptr<DocumentSource>> stages;
+        for (auto&& stageSpec : pipelineSpec()) {
+            for (auto&& stage : DocumentSource::parse(_ctx, stageSpec)) {
+                stages.push_back(stage);
+            }
+        }
+
+        if (stageNames->empty()) {
+            for (auto&& stage : stages) {
+                stageNames->push_back(stage->getSourceName());
+            }
+            selfMicros->resize(stages.size());
+            docsOut->resize(stages.size());
+        }
+
+        // Wire up mock -> timer -> stage -> timer -> stage -> ... -> timer. The timer below each
+        // stage measures its input's inclusive time; the timer above it measures the stage's.
+        intrusive_ptr<DocumentSource> tail = DocumentSourceMock::create(corpus);
+        vector<intrusive_ptr<DocumentSourceTimer>> timers;
+        timers.push_back(DocumentSourceTimer::create(_ctx));
+        timers.back()->setSource(tail.get());
+        tail = timers.back();
+        for (auto&& stage : stages) {
+            stage->setSource(tail.get());
+            timers.push_back(DocumentSourceTimer::create(_ctx));
+            timers.back()->setSource(stage.get());
+            tail = timers.back();
+        }
+
+        while (!tail->getNext().isEOF()) {
+        }
+
+        for (size_t i = 0; i < stages.size(); i++) {
+            (*selfMicros)[i] += timers[i + 1]->micros() - timers[i]->micros();
+            (*docsOut)[i] += timers[i + 1]->docs();
+        }
+        *pipelineMicros += timers.back()->micros();
+        *pipelineDocs += timers.back()->docs();
+    }
+
+    void say(const string& what, unsigned long long docs, long long micros) {
+        const unsigned long long docsPerSec = (docs * 1000 * 1000) / (micros > 0 ? micros : 1);
+        const double nsPerDoc = docs > 0 ? (micros * 1000.0) / docs : 0.0;
+        cout << "stats " << setw(40) << left << what << ' ' << right << setw(10) << docsPerSec
+             << " docs/sec " << right << setw(9) << fixed << setprecision(1) << nsPerDoc
+             << " ns/doc" << endl;
+    }
+
+    const ServiceContext::UniqueOperationContext _txnPtr = cc().makeOperationContext();
+    OperationContext& _opCtx = *_txnPtr;
+    intrusive_ptr<ExpressionContextForTest> _ctx;
+};
+
+// Selective $match keeping half the corpus.
+class MatchBench : public PipelineBench {
+public:
+    string name() {
+        return "pipeline_match";
+    }
+
+    vector<BSONObj> pipelineSpec() {
+        return {BSON("$match" << BSON("foo" << BSON("$lt" << 50)))};
+    }
+};
+
+// $group with 100 output groups and two accumulated fields.
+class GroupBench : public PipelineBench {
+public:
+    string name() {
+        return "pipeline_group";
+    }
+
+    vector<BSONObj> pipelineSpec() {
+        return {BSON("$group" << BSON("_id"
+                                      << "$foo"
+                                      << "count"
+                                      << BSON("$sum" << 1)
+                                      << "total"
+                                      << BSON("$sum"
+                                              << "$bar")))};
+    }
+};
+
+// Blocking $sort by a field the corpus order doesn't match.
+class SortBench : public PipelineBench {
+public:
+    string name() {
+        return "pipeline_sort";
+    }
+
+    vector<BSONObj> pipelineSpec() {
+        return {BSON("$sort" << BSON("bar" << 1))};
+    }
+};
+
+// $unwind tripling the corpus.
+class UnwindBench : public PipelineBench {
+public:
+    string name() {
+        return "pipeline_unwind";
+    }
+
+    vector<BSONObj> pipelineSpec() {
+        return {BSON("$unwind"
+                     << "$tags")};
+    }
+};
+
+// A representative multi-stage pipeline, to show how the stages' self times compose.
+class MatchGroupSortBench : public PipelineBench {
+public:
+    string name() {
+        return "pipeline_match_group_sort";
+    }
+
+    vector<BSONObj> pipelineSpec() {
+        return {BSON("$match" << BSON("foo" << BSON("$lt" << 50))),
+                BSON("$group" << BSON("_id"
+                                      << "$foo"
+                                      << "total"
+                                      << BSON("$sum"
+                                              << "$bar"))),
+                BSON("$sort" << BSON("total" << 1))};
+    }
+};
+
+class All : public Suite {
+public:
+    All() : Suite("pipelineperf") {}
+
+    void setupTests() {
+        add<MatchBench>();
+        add<GroupBench>();
+        add<SortBench>();
+        add<UnwindBench>();
+        add<MatchGroupSortBench>();
+    }
+};
+
+SuiteInstance<All> all;
+}  // namespace PipelinePerfTests
@@ -317,6 +317,45 @@ void ConnectionPool::SpecificPool::getConnection(const HostAndPort& hostAndPort,
         timeout = _parent->_options.refreshTimeout;
     }
 
+    // Fast path: if no requests are waiting ahead of us and a healthy connection is ready,
+    // check it out directly. This skips the request queue and the cancel/re-arm of the
+    // request timer that queueing would cause, which is most of the work a checkout does
+    // under the pool mutex in the common case.
+    if (_requests.empty()) {
+        while (_readyPool.size()) {
+            // _readyPool is an LRUCache, so its begin() object is the MRU item.
+            auto iter = _readyPool.begin();
+
+            // Grab the connection and cancel its timeout
+            auto conn = std::move(iter->second);
+            _readyPool.erase(iter);
+            conn->cancelTimeout();
+
+            if (!conn->isHealthy()) {
+                log() << "dropping unhealthy pooled connection to " << conn->getHostAndPort();
+
+                // Drop the bad connection and try the next one.
+                conn.reset();
+                continue;
+            }
+
+            auto connPtr = conn.get();
+
+            // check out the connection
+            _checkedOutPool[connPtr] = std::move(conn);
+
+            updateStateInLock();
+
+            spawnConnections(lk);
+
+            // pass it to the user
+            connPtr->resetToUnknown();
+            lk.unlock();
+            cb(ConnectionHandle(connPtr, ConnectionHandleDeleter(_parent)));
+            return;
+        }
+    }
+
     const auto expiration = _parent->_factory->now() + timeout;
 
     _requests.push(make_pair(expiration, std::move(cb)));
@@ -378,12 +378,20 @@ Status NetworkInterfaceASIO::startCommand(const TaskExecutor::CallbackHandle& cb
                 const auto adjustedTimeout = timeout - getConnectionDuration;
                 const auto requestId = op->_request.id;
 
-                try {
-                    op->_timeoutAlarm =
-                        op->_owner->_timerFactory->make(&op->_strand, adjustedTimeout);
-                } catch (std::system_error& e) {
-                    severe() << "Failed to construct timer for AsyncOp: " << e.what();
-                    fassertFailed(40334);
+                if (op->_timeoutAlarm) {
+                    // The timer outlives individual operations on a recycled AsyncOp, so
+                    // re-arm it instead of allocating a new one. Any handler still pending
+                    // from the previous operation is canceled by this and is ignored via
+                    // its stale generation.
+                    op->_timeoutAlarm->expireAfter(adjustedTimeout);
+                } else {
+                    try {
+                        op->_timeoutAlarm =
+                            op->_owner->_timerFactory->make(&op->_strand, adjustedTimeout);
+                    } catch (std::system_error& e) {
+                        severe() << "Failed to construct timer for AsyncOp: " << e.what();
+                        fassertFailed(40334);
+                    }
                 }
 
                 std::shared_ptr<AsyncOp::AccessControl> access;
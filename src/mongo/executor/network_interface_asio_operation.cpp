@@ -235,7 +235,8 @@ void NetworkInterfaceASIO::AsyncOp::reset() {
     // We don't reset _connection as we want to reuse it.
     // Ditto for _operationProtocol.
     _start = {};
-    _timeoutAlarm.reset();
+    // We don't reset _timeoutAlarm; it is re-armed with expireAfter() if the next operation
+    // needs a timeout, which avoids constructing a new timer per command.
     // _id stays the same for the lifetime of this object.
     _command = boost::none;
     // _inSetup should always be false at this point.
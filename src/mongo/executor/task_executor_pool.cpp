@@ -97,6 +97,11 @@ TaskExecutor* TaskExecutorPool::getFixedExecutor() {
     return _fixedExecutor.get();
 }
 
+size_t TaskExecutorPool::getPoolSize() const {
+    invariant(!_executors.empty());
+    return _executors.size();
+}
+
 void TaskExecutorPool::appendConnectionStats(ConnectionPoolStats* stats) const {
     // Get stats from our fixed executor.
     _fixedExecutor->appendConnectionStats(stats);
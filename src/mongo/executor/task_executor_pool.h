@@ -102,6 +102,12 @@ public:
      */
     TaskExecutor* getFixedExecutor();
 
+    /**
+     * Returns the number of executors in the pool, not counting the fixed executor. Invalid to
+     * call if the pool has not been initialized with addExecutors().
+     */
+    size_t getPoolSize() const;
+
     /**
      * Appends connection information from all of the executors in the pool.
      *
@@ -510,7 +510,16 @@ void ThreadPoolTaskExecutor::scheduleIntoPool_inlock(WorkQueue* fromQueue,
                                                      const WorkQueue::iterator& end,
                                                      stdx::unique_lock<stdx::mutex> lk) {
     dassert(fromQueue != &_poolInProgressQueue);
-    std::vector<std::shared_ptr<CallbackState>> todo(begin, end);
+
+    // The overwhelmingly common case is scheduling a single callback, so avoid allocating a
+    // vector of them while holding the executor mutex.
+    std::shared_ptr<CallbackState> single;
+    std::vector<std::shared_ptr<CallbackState>> todo;
+    if (begin != end && std::next(begin) == end) {
+        single = *begin;
+    } else {
+        todo.assign(begin, end);
+    }
     _poolInProgressQueue.splice(_poolInProgressQueue.end(), *fromQueue, begin, end);
 
     lk.unlock();
@@ -522,11 +531,19 @@ void ThreadPoolTaskExecutor::scheduleIntoPool_inlock(WorkQueue* fromQueue,
         }
     }
 
-    for (const auto& cbState : todo) {
-        const auto status = _pool->schedule([this, cbState] { runCallback(std::move(cbState)); });
-        if (status == ErrorCodes::ShutdownInProgress)
-            break;
-        fassert(28735, status);
+    if (single) {
+        const auto status =
+            _pool->schedule([this, cbState = std::move(single)] { runCallback(std::move(cbState)); });
+        if (status != ErrorCodes::ShutdownInProgress)
+            fassert(28735, status);
+    } else {
+        for (const auto& cbState : todo) {
+            const auto status =
+                _pool->schedule([this, cbState] { runCallback(std::move(cbState)); });
+            if (status == ErrorCodes::ShutdownInProgress)
+                break;
+            fassert(28735, status);
+        }
     }
     _net->signalWorkAvailable();
 }
@@ -0,0 +1,122 @@
+/*    Copyright 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/logger/async_message_appender.h"
+
+#include <sstream>
+#include <utility>
+
+#include "mongo/util/concurrency/thread_name.h"
+
+namespace mongo {
+namespace logger {
+
+const size_t AsyncMessageAppender::kDefaultMaxQueuedEvents;
+
+AsyncMessageAppender::AsyncMessageAppender(std::unique_ptr<Appender<MessageEventEphemeral>> target,
+                                           size_t maxQueuedEvents)
+    : _target(std::move(target)), _maxQueuedEvents(maxQueuedEvents) {
+    _writerThread = stdx::thread([this] { _writerThreadLoop(); });
+}
+
+AsyncMessageAppender::~AsyncMessageAppender() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _shutdown = true;
+        _condvar.notify_one();
+    }
+    _writerThread.join();
+}
+
+Status AsyncMessageAppender::append(const Event& event) {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (!_shutdown) {
+            if (_queue.size() >= _maxQueuedEvents) {
+                // Dropping is preferable to stalling every operation thread behind a slow
+                // sink; the writer thread reports the count once it catches up.
+                ++_numDropped;
+                return Status::OK();
+            }
+            _queue.emplace_back(event);
+            _condvar.notify_one();
+            return Status::OK();
+        }
+    }
+    // The writer thread is gone, so write through synchronously.  This happens only for
+    // messages logged while the appender itself is being torn down at shutdown.
+    return _target->append(event);
+}
+
+void AsyncMessageAppender::_writerThreadLoop() {
+    setThreadName("asyncLogWriter");
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    while (true) {
+        _condvar.wait(lk, [this] { return _shutdown || !_queue.empty(); });
+
+        std::vector<OwnedEvent> events;
+        events.swap(_queue);
+        const uint64_t numDropped = _numDropped;
+        _numDropped = 0;
+        const bool shutdown = _shutdown;
+        lk.unlock();
+
+        for (const auto& owned : events) {
+            MessageEventEphemeral event(
+                owned.date, owned.severity, owned.component, owned.contextName, owned.message);
+            event.setIsTruncatable(owned.isTruncatable);
+            // There is nobody to return a sink error to; subsequent messages are still
+            // attempted so that a transient failure does not silence the log permanently.
+            _target->append(event).transitional_ignore();
+        }
+
+        if (numDropped > 0) {
+            std::ostringstream os;
+            os << "Dropped " << numDropped
+               << " log line(s) because the asynchronous log queue was full";
+            std::string message = os.str();
+            MessageEventEphemeral event(Date_t::now(),
+                                        LogSeverity::Warning(),
+                                        LogComponent::kControl,
+                                        getThreadName(),
+                                        message);
+            _target->append(event).transitional_ignore();
+        }
+
+        if (shutdown) {
+            return;
+        }
+
+        lk.lock();
+    }
+}
+
+}  // namespace logger
+}  // namespace mongo
@@ -0,0 +1,124 @@
+/*    Copyright 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/status.h"
+#include "mongo/logger/appender.h"
+#include "mongo/logger/message_event.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+namespace logger {
+
+/**
+ * Appender that decouples producing a log message from writing it.
+ *
+ * append() copies the event into a bounded in-memory queue and returns immediately; a dedicated
+ * writer thread drains the queue and forwards the events to the wrapped appender, so encoding
+ * and the write system call happen off the operation thread.  When the queue is full, new
+ * events are dropped and counted rather than blocking the producer, and the writer thread
+ * reports the number of dropped messages once it catches up.
+ *
+ * The price of never blocking producers is a bounded window of recently logged messages that
+ * may be lost if the process aborts before the writer thread drains the queue.
+ */
+class AsyncMessageAppender : public Appender<MessageEventEphemeral> {
+    MONGO_DISALLOW_COPYING(AsyncMessageAppender);
+
+public:
+    /**
+     * Default bound on queued events.  A full queue of typical log lines is a few megabytes,
+     * small enough to hold in memory and large enough that drops only occur when the sink is
+     * persistently slower than the log volume.
+     */
+    static const size_t kDefaultMaxQueuedEvents = 10000;
+
+    /**
+     * Constructs an appender that forwards queued events to "target" from a writer thread.
+     */
+    explicit AsyncMessageAppender(std::unique_ptr<Appender<MessageEventEphemeral>> target,
+                                  size_t maxQueuedEvents = kDefaultMaxQueuedEvents);
+
+    /**
+     * Drains any queued events to the target, then stops the writer thread.
+     */
+    ~AsyncMessageAppender() override;
+
+    /**
+     * Enqueues "event" for the writer thread.  Never blocks on the sink; always returns
+     * Status::OK(), dropping the event if the queue is full.
+     */
+    Status append(const Event& event) override;
+
+private:
+    /**
+     * Owned copy of a MessageEventEphemeral, which does not own the storage behind its context
+     * name and message.
+     */
+    struct OwnedEvent {
+        explicit OwnedEvent(const MessageEventEphemeral& event)
+            : date(event.getDate()),
+              severity(event.getSeverity()),
+              component(event.getComponent()),
+              contextName(event.getContextName().toString()),
+              message(event.getMessage().toString()),
+              isTruncatable(event.isTruncatable()) {}
+
+        Date_t date;
+        LogSeverity severity;
+        LogComponent component;
+        std::string contextName;
+        std::string message;
+        bool isTruncatable;
+    };
+
+    void _writerThreadLoop();
+
+    std::unique_ptr<Appender<MessageEventEphemeral>> _target;
+    const size_t _maxQueuedEvents;
+
+    // Guards all members below.
+    stdx::mutex _mutex;
+    stdx::condition_variable _condvar;
+    std::vector<OwnedEvent> _queue;
+    uint64_t _numDropped = 0;
+    bool _shutdown = false;
+
+    stdx::thread _writerThread;
+};
+
+}  // namespace logger
+}  // namespace mongo
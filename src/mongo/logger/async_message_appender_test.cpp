@@ -0,0 +1,145 @@
+/*    Copyright 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <string>
+#include <vector>
+
+#include "mongo/logger/async_message_appender.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace logger {
+namespace {
+
+/**
+ * Appender that records the messages it receives and can be made to block inside append(), to
+ * simulate a sink that is slower than the log volume.
+ */
+class BlockingVectorAppender : public Appender<MessageEventEphemeral> {
+public:
+    Status append(const MessageEventEphemeral& event) override {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _messages.push_back(event.getMessage().toString());
+        _condvar.notify_all();
+        while (_blocked) {
+            _condvar.wait(lk);
+        }
+        return Status::OK();
+    }
+
+    void setBlocked(bool blocked) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _blocked = blocked;
+        _condvar.notify_all();
+    }
+
+    void waitForMessageCount(size_t count) {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        while (_messages.size() < count) {
+            _condvar.wait(lk);
+        }
+    }
+
+    std::vector<std::string> messages() {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        return _messages;
+    }
+
+private:
+    stdx::mutex _mutex;
+    stdx::condition_variable _condvar;
+    std::vector<std::string> _messages;
+    bool _blocked = false;
+};
+
+/**
+ * Non-owning adapter, so tests can inspect the target appender after the AsyncMessageAppender
+ * that writes to it has been destroyed.
+ */
+class ForwardingAppender : public Appender<MessageEventEphemeral> {
+public:
+    explicit ForwardingAppender(Appender<MessageEventEphemeral>* target) : _target(target) {}
+
+    Status append(const MessageEventEphemeral& event) override {
+        return _target->append(event);
+    }
+
+private:
+    Appender<MessageEventEphemeral>* _target;
+};
+
+MessageEventEphemeral makeEvent(StringData message) {
+    return MessageEventEphemeral(Date_t(), LogSeverity::Log(), "test", message);
+}
+
+TEST(AsyncMessageAppenderTest, ForwardsEventsInOrder) {
+    BlockingVectorAppender target;
+    {
+        AsyncMessageAppender appender(stdx::make_unique<ForwardingAppender>(&target));
+        ASSERT_OK(appender.append(makeEvent("one")));
+        ASSERT_OK(appender.append(makeEvent("two")));
+        ASSERT_OK(appender.append(makeEvent("three")));
+        // Destruction drains the queue before stopping the writer thread.
+    }
+    std::vector<std::string> expected{"one", "two", "three"};
+    ASSERT_TRUE(target.messages() == expected);
+}
+
+TEST(AsyncMessageAppenderTest, DropsAndReportsWhenQueueIsFull) {
+    BlockingVectorAppender target;
+    target.setBlocked(true);
+    {
+        AsyncMessageAppender appender(stdx::make_unique<ForwardingAppender>(&target), 4);
+
+        // Park the writer thread inside the sink so subsequent events stay queued.
+        ASSERT_OK(appender.append(makeEvent("gate")));
+        target.waitForMessageCount(1);
+
+        // Fill the queue, then overflow it.  Overflowing appends still return OK.
+        for (auto&& message : {"q1", "q2", "q3", "q4", "d1", "d2", "d3"}) {
+            ASSERT_OK(appender.append(makeEvent(message)));
+        }
+
+        target.setBlocked(false);
+        // Destruction drains the queued events and the drop report.
+    }
+    auto messages = target.messages();
+    ASSERT_EQUALS(6U, messages.size());
+    std::vector<std::string> queued(messages.begin(), messages.begin() + 5);
+    std::vector<std::string> expected{"gate", "q1", "q2", "q3", "q4"};
+    ASSERT_TRUE(queued == expected);
+    ASSERT_NOT_EQUALS(messages.back().find("Dropped 3"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace logger
+}  // namespace mongo
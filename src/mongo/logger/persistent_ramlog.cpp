@@ -0,0 +1,240 @@
+/*    Copyright 2017 10gen Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/logger/persistent_ramlog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/logger/message_event_utf8_encoder.h"
+#include "mongo/logger/ramlog.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+
+// At the front of the mapped file, followed by the ring bytes themselves. "cursor" is the total
+// number of bytes ever written, so cursor % ringSize is the next write position and cursor >
+// ringSize means the ring has wrapped. The cursor is advanced only after the line bytes are in
+// place, so a crash mid-write costs at most the line being written.
+struct PersistentRamLog::Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t ringSize;
+    uint64_t cursor;
+};
+
+namespace {
+
+const uint64_t kMagic = 0x676f6c6d61726470ULL;  // "pdramlog"
+const uint32_t kVersion = 1;
+
+// Name of the RamLog that receives the previous incarnation's lines.
+const char kRecoveredLogName[] = "recovered";
+
+/**
+ * Maps (creating and sizing if necessary) "totalSize" bytes of the file at "path" as a shared,
+ * writable mapping.
+ */
+StatusWith<char*> mapRingFile(const std::string& path, size_t totalSize) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ,
+                              NULL,
+                              OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL,
+                              NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return Status(ErrorCodes::FileOpenFailed,
+                      str::stream() << "Failed to open " << path << ": " << errnoWithDescription());
+    }
+
+    LARGE_INTEGER size;
+    size.QuadPart = totalSize;
+    if (!SetFilePointerEx(file, size, NULL, FILE_BEGIN) || !SetEndOfFile(file)) {
+        Status status(ErrorCodes::FileStreamFailed,
+                      str::stream() << "Failed to size " << path << ": " << errnoWithDescription());
+        CloseHandle(file);
+        return status;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, size.HighPart, size.LowPart, NULL);
+    if (!mapping) {
+        Status status(ErrorCodes::FileStreamFailed,
+                      str::stream() << "Failed to create mapping of " << path << ": "
+                                    << errnoWithDescription());
+        CloseHandle(file);
+        return status;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, totalSize);
+    CloseHandle(mapping);
+    CloseHandle(file);
+    if (!view) {
+        return Status(ErrorCodes::FileStreamFailed,
+                      str::stream() << "Failed to map " << path << ": " << errnoWithDescription());
+    }
+    return static_cast<char*>(view);
+#else
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        return Status(ErrorCodes::FileOpenFailed,
+                      str::stream() << "Failed to open " << path << ": " << errnoWithDescription());
+    }
+
+    if (ftruncate(fd, totalSize) != 0) {
+        Status status(ErrorCodes::FileStreamFailed,
+                      str::stream() << "Failed to size " << path << ": " << errnoWithDescription());
+        close(fd);
+        return status;
+    }
+
+    void* view = mmap(NULL, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return Status(ErrorCodes::FileStreamFailed,
+                      str::stream() << "Failed to map " << path << ": " << errnoWithDescription());
+    }
+    return static_cast<char*>(view);
+#endif
+}
+
+/**
+ * Replays the ring contents left by the previous incarnation, oldest line first, into "target".
+ */
+void recoverLines(const char* ring, size_t ringSize, uint64_t cursor, RamLog* target) {
+    std::string bytes;
+    if (cursor <= ringSize) {
+        bytes.assign(ring, static_cast<size_t>(cursor));
+    } else {
+        const size_t pos = static_cast<size_t>(cursor % ringSize);
+        bytes.assign(ring + pos, ringSize - pos);
+        bytes.append(ring, pos);
+    }
+
+    // When the ring has wrapped, the oldest line was partially overwritten; skip it.
+    size_t lineStart = 0;
+    if (cursor > ringSize) {
+        lineStart = bytes.find('\n');
+        if (lineStart == std::string::npos)
+            return;
+        lineStart++;
+    }
+
+    while (lineStart < bytes.size()) {
+        const size_t lineEnd = bytes.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+            break;  // An unterminated trailing line was torn by the crash; drop it.
+        std::string line = bytes.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        // NUL bytes mean the region was never written or was torn mid-write.
+        if (!line.empty() && line.find('\0') == std::string::npos) {
+            target->write(line);
+        }
+    }
+}
+
+}  // namespace
+
+StatusWith<PersistentRamLog*> PersistentRamLog::start(const std::string& path,
+                                                      size_t ringSizeBytes) {
+    auto swMapping = mapRingFile(path, sizeof(Header) + ringSizeBytes);
+    if (!swMapping.isOK()) {
+        return swMapping.getStatus();
+    }
+    char* mapping = swMapping.getValue();
+
+    Header* header = reinterpret_cast<Header*>(mapping);
+    char* ring = mapping + sizeof(Header);
+
+    // A ring size mismatch means the configuration changed since the previous incarnation; the
+    // old layout can't be interpreted against the new mapping, so its contents are discarded.
+    if (header->magic == kMagic && header->version == kVersion &&
+        header->ringSize == ringSizeBytes && header->cursor > 0) {
+        recoverLines(ring, ringSizeBytes, header->cursor, RamLog::get(kRecoveredLogName));
+    }
+
+    // Reset the file for this incarnation.
+    std::memset(ring, 0, ringSizeBytes);
+    header->magic = kMagic;
+    header->version = kVersion;
+    header->ringSize = ringSizeBytes;
+    header->cursor = 0;
+
+    return new PersistentRamLog(mapping, ringSizeBytes);
+}
+
+PersistentRamLog::PersistentRamLog(char* mapping, size_t ringSizeBytes)
+    : _header(reinterpret_cast<Header*>(mapping)),
+      _ring(mapping + sizeof(Header)),
+      _ringSize(ringSizeBytes) {}
+
+void PersistentRamLog::write(const std::string& str) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    const char* data = str.data();
+    size_t len = str.size();
+    if (len + 1 > _ringSize) {
+        // Keep the tail of an oversized line; it displaces the entire ring anyway.
+        data += len + 1 - _ringSize;
+        len = _ringSize - 1;
+    }
+
+    const size_t pos = static_cast<size_t>(_header->cursor % _ringSize);
+    const size_t contiguous = std::min(len, _ringSize - pos);
+    std::memcpy(_ring + pos, data, contiguous);
+    std::memcpy(_ring, data + contiguous, len - contiguous);
+    _ring[(pos + len) % _ringSize] = '\n';
+
+    _header->cursor += len + 1;
+}
+
+PersistentRamLogAppender::PersistentRamLogAppender(PersistentRamLog* log) : _log(log) {}
+PersistentRamLogAppender::~PersistentRamLogAppender() {}
+
+Status PersistentRamLogAppender::append(const logger::MessageEventEphemeral& event) {
+    std::ostringstream ss;
+    logger::MessageEventDetailsEncoder encoder;
+    encoder.encode(event, ss);
+    _log->write(ss.str());
+    return Status::OK();
+}
+
+}  // namespace mongo
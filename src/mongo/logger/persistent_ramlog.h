@@ -0,0 +1,103 @@
+/*    Copyright 2017 10gen Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/status_with.h"
+#include "mongo/logger/appender.h"
+#include "mongo/logger/message_event.h"
+#include "mongo/logger/tee.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+
+/**
+ * Crash-surviving companion to RamLog.
+ *
+ * Mirrors log lines into a fixed-size ring inside a memory-mapped file. The write path is a
+ * memcpy into the shared mapping -- no syscalls -- so it is cheap enough to attach to the global
+ * log domain. The operating system writes the dirty pages back even if the process dies, so the
+ * tail of the log survives a crash (though not a kernel panic or power loss).
+ *
+ * On startup, start() recovers whatever the previous incarnation left in the file into the RamLog
+ * named "recovered", where it is visible through { getLog: "recovered" }, then resets the file
+ * for this incarnation.
+ */
+class PersistentRamLog : public logger::Tee {
+    MONGO_DISALLOW_COPYING(PersistentRamLog);
+
+public:
+    /**
+     * Maps (creating if necessary) the ring file at "path", recovers lines written by the
+     * previous incarnation into the RamLog named "recovered", and returns a Tee that mirrors
+     * subsequent writes into the file.
+     *
+     * Returns a non-OK status if the file cannot be created or mapped. Callers are expected to
+     * treat that as non-fatal and carry on with in-memory logging only.
+     */
+    static StatusWith<PersistentRamLog*> start(const std::string& path, size_t ringSizeBytes);
+
+    /**
+     * Appends "str" (plus a trailing newline) to the ring, overwriting the oldest bytes once the
+     * ring is full. Synchronized on the instance's own mutex, like RamLog::write().
+     */
+    void write(const std::string& str) final;
+
+private:
+    struct Header;
+
+    PersistentRamLog(char* mapping, size_t ringSizeBytes);
+
+    // Instances are created once at startup and deliberately leaked, like RamLogs, so that they
+    // remain usable while static destructors run.
+    ~PersistentRamLog() final = default;
+
+    Header* _header;
+    char* _ring;
+    const size_t _ringSize;
+
+    stdx::mutex _mutex;
+};
+
+/**
+ * Appender for mirroring MessageEvents into a PersistentRamLog.
+ */
+class PersistentRamLogAppender : public logger::Appender<logger::MessageEventEphemeral> {
+public:
+    explicit PersistentRamLogAppender(PersistentRamLog* log);
+    virtual ~PersistentRamLogAppender();
+
+    virtual Status append(const logger::MessageEventEphemeral& event);
+
+private:
+    PersistentRamLog* _log;
+};
+
+}  // namespace mongo
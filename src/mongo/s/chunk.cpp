@@ -32,9 +32,23 @@
 
 #include "mongo/s/chunk.h"
 
+#include <algorithm>
+
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/util/mongoutils/str.h"
 
 namespace mongo {
+namespace {
+
+// Upper bound on the number of shard keys sampled per chunk. Keys beyond this overwrite older
+// sample entries cyclically.
+const size_t kMaxSampledSplitKeys = 256;
+
+// Minimum number of sampled keys required per derived split point. Below this density the sample
+// is considered too coarse and the caller falls back to a splitVector scan.
+const size_t kMinSamplesPerSplitPoint = 32;
+
+}  // namespace
 
 Chunk::Chunk(const ChunkType& from)
     : _range(from.getMin(), from.getMax()),
@@ -60,6 +74,59 @@ uint64_t Chunk::addBytesWritten(uint64_t bytesWrittenIncrement) {
 
 void Chunk::clearBytesWritten() {
     _dataWritten = 0;
+
+    stdx::lock_guard<stdx::mutex> lk(_sampledKeysMutex);
+    _sampledKeys.clear();
+    _sampledKeysSeen = 0;
+}
+
+void Chunk::addSampledSplitKeys(const std::vector<BSONObj>& keys) {
+    stdx::lock_guard<stdx::mutex> lk(_sampledKeysMutex);
+
+    for (const auto& key : keys) {
+        if (_sampledKeys.size() < kMaxSampledSplitKeys) {
+            _sampledKeys.push_back(key.getOwned());
+        } else {
+            _sampledKeys[_sampledKeysSeen % kMaxSampledSplitKeys] = key.getOwned();
+        }
+        _sampledKeysSeen++;
+    }
+}
+
+std::vector<BSONObj> Chunk::computeSketchSplitPoints(size_t numSplitPoints) const {
+    std::vector<BSONObj> sample;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_sampledKeysMutex);
+        sample = _sampledKeys;
+    }
+
+    // A single split point is never sufficient for the caller (it indicates a chunk between half
+    // and full size, which is not split), so do not bother deriving fewer than two.
+    if (numSplitPoints < 2 || sample.size() < numSplitPoints * kMinSamplesPerSplitPoint) {
+        return {};
+    }
+
+    std::sort(sample.begin(), sample.end(), SimpleBSONObjComparator::kInstance.makeLessThan());
+
+    std::vector<BSONObj> splitPoints;
+
+    for (size_t i = 1; i <= numSplitPoints; i++) {
+        const BSONObj& candidate = sample[i * sample.size() / (numSplitPoints + 1)];
+
+        // Quantiles of a skewed sample can collapse onto each other or onto the chunk bounds;
+        // only keep points which would produce two non-empty chunks.
+        if (candidate.woCompare(getMin()) <= 0 || candidate.woCompare(getMax()) >= 0) {
+            continue;
+        }
+
+        if (!splitPoints.empty() && candidate.woCompare(splitPoints.back()) == 0) {
+            continue;
+        }
+
+        splitPoints.push_back(candidate);
+    }
+
+    return splitPoints;
 }
 
 std::string Chunk::toString() const {
@@ -28,9 +28,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/chunk_version.h"
 #include "mongo/s/shard_id.h"
+#include "mongo/stdx/mutex.h"
 
 namespace mongo {
 
@@ -81,6 +84,22 @@ public:
     uint64_t addBytesWritten(uint64_t bytesWrittenIncrement);
     void clearBytesWritten();
 
+    /**
+     * Folds shard keys, which were routed to this chunk by the writes accounted for above, into a
+     * bounded sample of the chunk's incoming key distribution. Once the sample is full, older
+     * entries are overwritten so the sample tracks the most recently written keys.
+     */
+    void addSampledSplitKeys(const std::vector<BSONObj>& keys);
+
+    /**
+     * Attempts to derive the requested number of split points as evenly-spaced quantiles of the
+     * sampled key distribution. Returns an empty vector if the sample is not dense enough to
+     * support that many split points, in which case the caller should fall back to asking the
+     * shard to scan the chunk (splitVector). All returned points lie strictly inside the chunk's
+     * range and are sorted and distinct.
+     */
+    std::vector<BSONObj> computeSketchSplitPoints(size_t numSplitPoints) const;
+
     /**
      * Marks this chunk as jumbo. Only moves from false to true once and is used by the balancer.
      */
@@ -99,6 +118,13 @@ private:
 
     // Statistics for the approximate data written to this chunk
     mutable uint64_t _dataWritten;
+
+    // Bounded sample of the shard keys recently written to this chunk, used to derive split
+    // points without scanning the chunk's data. Like _dataWritten this is per-router, best-effort
+    // state, but unlike the plain counter it needs a mutex since it holds a vector.
+    mutable stdx::mutex _sampledKeysMutex;
+    mutable std::vector<BSONObj> _sampledKeys;
+    mutable uint64_t _sampledKeysSeen{0};
 };
 
 }  // namespace mongo
@@ -52,6 +52,10 @@ enum CompareResult { CompareResult_Unknown, CompareResult_GTE, CompareResult_LT
 
 const ShardKeyPattern virtualIdShardKey(BSON("_id" << 1));
 
+// Per-chunk cap on the shard keys sampled into TargeterStats during a single batch, bounding the
+// memory the split point sampling can consume.
+const size_t kMaxSampledShardKeysPerBatch = 256;
+
 /**
  * There are two styles of update expressions:
  *
@@ -556,16 +560,39 @@ Status ChunkManagerTargeter::targetQuery(
 std::unique_ptr<ShardEndpoint> ChunkManagerTargeter::targetShardKey(const BSONObj& shardKey,
                                                                     const BSONObj& collation,
                                                                     long long estDataSize) const {
-    auto chunk = _routingInfo->cm()->findIntersectingChunk(shardKey, collation);
+    const auto& cm = _routingInfo->cm();
+
+    // Try the chunk found by the previous lookup before searching the chunk map again;
+    // consecutive documents in a batch usually fall on the same chunk. The memoized chunk is
+    // only valid for the routing table it came from, and the bare range containment check
+    // skips the collatable-type validation that findIntersectingChunk performs, so the fast
+    // path is restricted to lookups with the simple collation.
+    std::shared_ptr<Chunk> chunk;
+    if (_lastTargetedChunk && _lastTargetedChunkManager == cm &&
+        SimpleBSONObjComparator::kInstance.evaluate(collation == CollationSpec::kSimpleSpec) &&
+        _lastTargetedChunk->containsKey(shardKey)) {
+        chunk = _lastTargetedChunk;
+    } else {
+        chunk = cm->findIntersectingChunk(shardKey, collation);
+        _lastTargetedChunk = chunk;
+        _lastTargetedChunkManager = cm;
+    }
 
     // Track autosplit stats for sharded collections
     // Note: this is only best effort accounting and is not accurate.
     if (estDataSize > 0) {
         _stats->chunkSizeDelta[chunk->getMin()] += estDataSize;
+
+        // Remember the keys being written so split points can later be derived from them without
+        // scanning the chunk's data
+        auto& sampledKeys = _stats->sampledShardKeys[chunk->getMin()];
+        if (sampledKeys.size() < kMaxSampledShardKeysPerBatch) {
+            sampledKeys.push_back(shardKey.getOwned());
+        }
     }
 
     return stdx::make_unique<ShardEndpoint>(chunk->getShardId(),
-                                            _routingInfo->cm()->getVersion(chunk->getShardId()));
+                                            cm->getVersion(chunk->getShardId()));
 }
 
 Status ChunkManagerTargeter::targetCollection(
@@ -30,6 +30,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobj_comparator_interface.h"
@@ -40,6 +41,7 @@
 
 namespace mongo {
 
+class Chunk;
 class ChunkManager;
 class OperationContext;
 class Shard;
@@ -47,11 +49,17 @@ struct ChunkVersion;
 
 struct TargeterStats {
     TargeterStats()
-        : chunkSizeDelta(SimpleBSONObjComparator::kInstance.makeBSONObjIndexedMap<int>()) {}
+        : chunkSizeDelta(SimpleBSONObjComparator::kInstance.makeBSONObjIndexedMap<int>()),
+          sampledShardKeys(SimpleBSONObjComparator::kInstance
+                               .makeBSONObjIndexedMap<std::vector<BSONObj>>()) {}
 
     // Map of chunk shard minKey -> approximate delta. This is used for deciding
     // whether a chunk might need splitting or not.
     BSONObjIndexedMap<int> chunkSizeDelta;
+
+    // Map of chunk shard minKey -> shard keys written to the chunk, capped per chunk. Feeds each
+    // chunk's split point sample so that splits can be decided without scanning the chunk.
+    BSONObjIndexedMap<std::vector<BSONObj>> sampledShardKeys;
 };
 
 /**
@@ -164,6 +172,13 @@ private:
     // The latest loaded routing cache entry
     boost::optional<CachedCollectionRoutingInfo> _routingInfo;
 
+    // Memoized result of the most recent successful chunk lookup. Consecutive documents in a
+    // batch frequently fall on the same chunk (most notably time-ordered inserts), so
+    // targetShardKey tries this chunk before searching the chunk map again. Only valid while
+    // '_lastTargetedChunkManager' still matches the routing info's ChunkManager.
+    mutable std::shared_ptr<Chunk> _lastTargetedChunk;
+    mutable std::shared_ptr<ChunkManager> _lastTargetedChunkManager;
+
     // Map of shard->remote shard version reported from stale errors
     ShardVersionMap _remoteShardVersions;
 };
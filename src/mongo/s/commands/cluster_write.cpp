@@ -192,6 +192,11 @@ void splitIfNeeded(OperationContext* opCtx,
             return;
         }
 
+        auto sampledKeysIt = stats.sampledShardKeys.find(it->first);
+        if (sampledKeysIt != stats.sampledShardKeys.end()) {
+            chunk->addSampledSplitKeys(sampledKeysIt->second);
+        }
+
         updateChunkWriteStatsAndSplitIfNeeded(
             opCtx, routingInfo.cm().get(), chunk.get(), it->second);
     }
@@ -345,21 +350,39 @@ void updateChunkWriteStatsAndSplitIfNeeded(OperationContext* opCtx,
             }
         }();
 
-        auto splitPoints =
-            uassertStatusOK(shardutil::selectChunkSplitPoints(opCtx,
-                                                              chunk->getShardId(),
-                                                              nss,
-                                                              manager->getShardKeyPattern(),
-                                                              chunkRange,
-                                                              chunkSizeToUse,
-                                                              boost::none));
-
-        if (splitPoints.size() <= 1) {
-            // No split points means there isn't enough data to split on; 1 split point means we
-            // have
-            // between half the chunk size to full chunk size so there is no need to split yet
-            chunk->clearBytesWritten();
-            return;
+        // First try to derive split points from the shard keys this router sampled while the
+        // write counter accumulated, which avoids the splitVector index walk on the shard. The
+        // sample only justifies a split once the bytes counted since the last decision would on
+        // their own fill more than one chunk; below that, fall back to asking the shard to scan
+        // the chunk, which also accounts for data this router did not see.
+        const uint64_t halfChunkSize = std::max(chunkSizeToUse / 2, static_cast<uint64_t>(1));
+        const size_t numSketchSplitPoints = chunkBytesWritten > halfChunkSize
+            ? static_cast<size_t>(chunkBytesWritten / halfChunkSize) - 1
+            : 0;
+
+        auto splitPoints = chunk->computeSketchSplitPoints(numSketchSplitPoints);
+
+        if (splitPoints.size() > 1) {
+            LOG(1) << "autosplit derived " << splitPoints.size()
+                   << " split points from sampled shard keys for chunk "
+                   << redact(chunk->toString());
+        } else {
+            splitPoints =
+                uassertStatusOK(shardutil::selectChunkSplitPoints(opCtx,
+                                                                  chunk->getShardId(),
+                                                                  nss,
+                                                                  manager->getShardKeyPattern(),
+                                                                  chunkRange,
+                                                                  chunkSizeToUse,
+                                                                  boost::none));
+
+            if (splitPoints.size() <= 1) {
+                // No split points means there isn't enough data to split on; 1 split point means
+                // we have between half the chunk size to full chunk size so there is no need to
+                // split yet
+                chunk->clearBytesWritten();
+                return;
+            }
         }
 
         if (minIsInf || maxIsInf) {
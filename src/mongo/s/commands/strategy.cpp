@@ -32,6 +32,9 @@
 
 #include "mongo/s/commands/strategy.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "mongo/base/data_cursor.h"
 #include "mongo/base/init.h"
 #include "mongo/base/owned_pointer_vector.h"
@@ -159,7 +162,11 @@ void execCommandClient(OperationContext* opCtx,
             str::stream() << "Invalid database name: '" << dbname << "'",
             NamespaceString::validDBName(dbname, NamespaceString::DollarInDbNameBehavior::Allow));
 
-    StringMap<int> topLevelFields;
+    // Duplicate top-level fields are detected with a linear scan of the names already seen.
+    // Command objects have few top-level fields, so this is cheaper than building a per-request
+    // hash table, which costs an allocation per field on every operation.
+    std::vector<StringData> topLevelFields;
+    topLevelFields.reserve(16);
     for (auto&& element : request.body) {
         StringData fieldName = element.fieldNameStringData();
         if (fieldName == "help" && element.type() == Bool && element.Bool()) {
@@ -174,7 +181,9 @@ void execCommandClient(OperationContext* opCtx,
         uassert(ErrorCodes::FailedToParse,
                 str::stream() << "Parsed command object contains duplicate top level key: "
                               << fieldName,
-                topLevelFields[fieldName]++ == 0);
+                std::find(topLevelFields.begin(), topLevelFields.end(), fieldName) ==
+                    topLevelFields.end());
+        topLevelFields.push_back(fieldName);
     }
 
     Status status = Command::checkAuthorization(c, opCtx, dbname, request.body);
@@ -199,6 +199,7 @@ ClusterQueryResult AsyncResultsMerger::nextReadySorted() {
 
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
     _remotes[smallestRemote].docBuffer.pop();
+    _remotes[smallestRemote].sortKeyBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
@@ -239,6 +240,24 @@ ClusterQueryResult AsyncResultsMerger::nextReadyUnsorted() {
     return {};
 }
 
+void AsyncResultsMerger::scheduleReadAhead(OperationContext* opCtx) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    if (_lifecycleState != kAlive || _params->isTailable) {
+        return;
+    }
+
+    for (size_t i = 0; i < _remotes.size(); ++i) {
+        auto& remote = _remotes[i];
+        if (remote.status.isOK() && !remote.hasNext() && !remote.exhausted() &&
+            !remote.cbHandle.isValid()) {
+            // Best effort: if scheduling fails the remote is left without an outstanding
+            // request, and the next nextEvent() call will retry it and report the error.
+            askForNextBatch_inlock(opCtx, i).transitional_ignore();
+        }
+    }
+}
+
 Status AsyncResultsMerger::askForNextBatch_inlock(OperationContext* opCtx, size_t remoteIndex) {
     auto& remote = _remotes[remoteIndex];
 
@@ -422,6 +441,8 @@ void AsyncResultsMerger::handleBatchResponse(
             // Clear the results buffer and cursor id.
             std::queue<ClusterQueryResult> emptyBuffer;
             std::swap(remote.docBuffer, emptyBuffer);
+            std::queue<BSONObj> emptySortKeyBuffer;
+            std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
             remote.cursorId = 0;
         }
 
@@ -470,14 +491,19 @@ bool AsyncResultsMerger::addBatchToBuffer(size_t remoteIndex, const std::vector<
     auto& remote = _remotes[remoteIndex];
     for (const auto& obj : batch) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
-        if (!_params->sort.isEmpty() &&
-            obj[ClusterClientCursorParams::kSortKeyField].type() != BSONType::Object) {
-            remote.status = Status(ErrorCodes::InternalError,
-                                   str::stream() << "Missing field '"
-                                                 << ClusterClientCursorParams::kSortKeyField
-                                                 << "' in document: "
-                                                 << obj);
-            return false;
+        // Extract it now, so that the merge queue comparator can compare buffered results
+        // without re-scanning each document for the sort key field.
+        if (!_params->sort.isEmpty()) {
+            auto sortKeyElt = obj[ClusterClientCursorParams::kSortKeyField];
+            if (sortKeyElt.type() != BSONType::Object) {
+                remote.status = Status(ErrorCodes::InternalError,
+                                       str::stream() << "Missing field '"
+                                                     << ClusterClientCursorParams::kSortKeyField
+                                                     << "' in document: "
+                                                     << obj);
+                return false;
+            }
+            remote.sortKeyBuffer.push(sortKeyElt.Obj());
         }
 
         ClusterQueryResult result(obj);
@@ -608,11 +634,8 @@ std::shared_ptr<Shard> AsyncResultsMerger::RemoteCursorData::getShard() {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    BSONObj leftDocKey = (*leftDoc.getResult())[ClusterClientCursorParams::kSortKeyField].Obj();
-    BSONObj rightDocKey = (*rightDoc.getResult())[ClusterClientCursorParams::kSortKeyField].Obj();
+    const BSONObj& leftDocKey = _remotes[lhs].sortKeyBuffer.front();
+    const BSONObj& rightDocKey = _remotes[rhs].sortKeyBuffer.front();
 
     // This does not need to sort with a collator, since mongod has already mapped strings to their
     // ICU comparison keys as part of the $sortKey meta projection.
@@ -140,6 +140,19 @@ public:
      */
     StatusWith<ClusterQueryResult> nextReady();
 
+    /**
+     * Schedules a getMore on any remote whose buffer has been drained but whose cursor is not
+     * exhausted, without waiting for a consumer to block in nextEvent(). Intended to be called
+     * after results are returned via nextReady(), so that the shard round trip for a drained
+     * remote's next batch overlaps with returning already-buffered results to the client.
+     *
+     * Best effort: scheduling failures are ignored here, since the next call to nextEvent()
+     * will retry the remote and surface the error. Has no effect on tailable cursors, whose
+     * getMores may block on the remote and must only be issued when the consumer asks for more
+     * results.
+     */
+    void scheduleReadAhead(OperationContext* opCtx);
+
     /**
      * Schedules remote work as required in order to make further results available. If there is an
      * error in scheduling this work, returns a non-ok status. On success, returns an event handle.
@@ -214,6 +227,13 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // For sorted merges only, the '$sortKey' of each buffered result, parallel to
+        // 'docBuffer'. The keys are extracted once when a batch is buffered so that the merge
+        // queue comparator does not have to re-scan each document per comparison. Each key is a
+        // view into the corresponding document in 'docBuffer', so the two queues must always be
+        // pushed, popped and cleared together.
+        std::queue<BSONObj> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
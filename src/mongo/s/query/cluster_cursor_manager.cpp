@@ -178,14 +178,18 @@ ClusterCursorManager::ClusterCursorManager(ClockSource* clockSource)
 }
 
 ClusterCursorManager::~ClusterCursorManager() {
+    invariant(_cursorEntries.empty());
     invariant(_cursorIdPrefixToNamespaceMap.empty());
-    invariant(_namespaceToContainerMap.empty());
+    invariant(_namespaceToInfoMap.empty());
 }
 
 void ClusterCursorManager::shutdown() {
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
-    _inShutdown = true;
-    lk.unlock();
+    {
+        // Taking the registration mutex serializes the flag flip with in-progress registrations,
+        // so any cursor registered before the flip is visible to killAllCursors() below.
+        stdx::lock_guard<stdx::mutex> registrationLock(_registrationMutex);
+        _inShutdown.store(true);
+    }
 
     killAllCursors();
     reapZombieCursors();
@@ -200,20 +204,21 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     // Read the clock out of the lock.
     const auto now = _clockSource->now();
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    invariant(cursor);
+
+    stdx::unique_lock<stdx::mutex> registrationLock(_registrationMutex);
 
-    if (_inShutdown) {
-        lk.unlock();
+    if (_inShutdown.load()) {
+        registrationLock.unlock();
         cursor->kill(opCtx);
         return Status(ErrorCodes::ShutdownInProgress,
                       "Cannot register new cursors as we are in the process of shutting down");
     }
 
-    invariant(cursor);
-
-    // Find the CursorEntryContainer for this namespace.  If none exists, create one.
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    if (nsToContainerIt == _namespaceToContainerMap.end()) {
+    // Find the namespace bookkeeping for this namespace.  If none exists, allocate a cursor id
+    // prefix and create it.
+    auto nsInfoIt = _namespaceToInfoMap.find(nss);
+    if (nsInfoIt == _namespaceToInfoMap.end()) {
         uint32_t containerPrefix = 0;
         do {
             // The server has always generated positive values for CursorId (which is a signed
@@ -223,28 +228,29 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
         } while (_cursorIdPrefixToNamespaceMap.count(containerPrefix) > 0);
         _cursorIdPrefixToNamespaceMap[containerPrefix] = nss;
 
-        auto emplaceResult =
-            _namespaceToContainerMap.emplace(nss, CursorEntryContainer(containerPrefix));
+        auto emplaceResult = _namespaceToInfoMap.emplace(nss, NamespaceInfo{containerPrefix, 0});
         invariant(emplaceResult.second);
-        invariant(_namespaceToContainerMap.size() == _cursorIdPrefixToNamespaceMap.size());
+        invariant(_namespaceToInfoMap.size() == _cursorIdPrefixToNamespaceMap.size());
 
-        nsToContainerIt = emplaceResult.first;
+        nsInfoIt = emplaceResult.first;
     } else {
-        invariant(!nsToContainerIt->second.entryMap.empty());  // If exists, shouldn't be empty.
+        invariant(nsInfoIt->second.numCursors > 0);  // If exists, shouldn't be empty.
     }
-    CursorEntryContainer& container = nsToContainerIt->second;
 
     // Generate a CursorId (which can't be the invalid value zero).
-    CursorEntryMap& entryMap = container.entryMap;
     CursorId cursorId = 0;
     do {
         const uint32_t cursorSuffix = static_cast<uint32_t>(_pseudoRandom.nextInt32());
-        cursorId = createCursorId(container.containerPrefix, cursorSuffix);
-    } while (cursorId == 0 || entryMap.count(cursorId) > 0);
+        cursorId = createCursorId(nsInfoIt->second.containerPrefix, cursorSuffix);
+    } while (cursorId == 0 || _cursorEntries.count(cursorId) > 0);
+
+    ++nsInfoIt->second.numCursors;
 
-    // Create a new CursorEntry and register it in the CursorEntryContainer's map.
-    auto emplaceResult =
-        entryMap.emplace(cursorId, CursorEntry(std::move(cursor), cursorType, cursorLifetime, now));
+    // Create a new CursorEntry and register it in the entry map.  Taking a partition while
+    // holding '_registrationMutex' is fine; the reverse order is what's forbidden.
+    auto partition = _cursorEntries.lockOnePartition(cursorId);
+    auto emplaceResult = partition->emplace(
+        cursorId, CursorEntry(std::move(cursor), nss, cursorType, cursorLifetime, now));
     invariant(emplaceResult.second);
 
     return cursorId;
@@ -252,21 +258,21 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
 
 StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCursor(
     const NamespaceString& nss, CursorId cursorId, OperationContext* opCtx) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-    if (_inShutdown) {
+    if (_inShutdown.load()) {
         return Status(ErrorCodes::ShutdownInProgress,
                       "Cannot check out cursor as we are in the process of shutting down");
     }
 
-    CursorEntry* entry = getEntry_inlock(nss, cursorId);
-    if (!entry) {
+    auto partition = _cursorEntries.lockOnePartition(cursorId);
+    auto entryIt = partition->find(cursorId);
+    if (entryIt == partition->end() || entryIt->second.getNamespace() != nss) {
         return cursorNotFoundStatus(nss, cursorId);
     }
-    if (entry->getKillPending()) {
+    CursorEntry& entry = entryIt->second;
+    if (entry.getKillPending()) {
         return cursorNotFoundStatus(nss, cursorId);
     }
-    std::unique_ptr<ClusterClientCursor> cursor = entry->releaseCursor();
+    std::unique_ptr<ClusterClientCursor> cursor = entry.releaseCursor();
     if (!cursor) {
         return cursorInUseStatus(nss, cursorId);
     }
@@ -283,57 +289,57 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
     // Read the clock out of the lock.
     const auto now = _clockSource->now();
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
-
     invariant(cursor);
 
     const bool remotesExhausted = cursor->remotesExhausted();
 
-    CursorEntry* entry = getEntry_inlock(nss, cursorId);
-    invariant(entry);
+    {
+        auto partition = _cursorEntries.lockOnePartition(cursorId);
+        auto entryIt = partition->find(cursorId);
+        invariant(entryIt != partition->end());
+        CursorEntry& entry = entryIt->second;
 
-    entry->setLastActive(now);
-    entry->returnCursor(std::move(cursor));
+        entry.setLastActive(now);
+        entry.returnCursor(std::move(cursor));
 
-    if (cursorState == CursorState::NotExhausted || entry->getKillPending()) {
-        return;
-    }
+        if (cursorState == CursorState::NotExhausted || entry.getKillPending()) {
+            return;
+        }
 
-    if (!remotesExhausted) {
-        // The cursor still has open remote cursors that need to be cleaned up. Schedule for
-        // deletion by the reaper thread by setting the kill pending flag.
-        entry->setKillPending();
-        return;
+        if (!remotesExhausted) {
+            // The cursor still has open remote cursors that need to be cleaned up. Schedule for
+            // deletion by the reaper thread by setting the kill pending flag.
+            entry.setKillPending();
+            return;
+        }
     }
 
     // The cursor is exhausted, is not already scheduled for deletion, and does not have any
-    // remote cursor state left to clean up. We can delete the cursor right away.
-    auto detachedCursor = detachCursor_inlock(nss, cursorId);
-    invariantOK(detachedCursor.getStatus());
-
-    // Deletion of the cursor can happen out of the lock.
-    lk.unlock();
-    detachedCursor.getValue().reset();
+    // remote cursor state left to clean up. We can delete the cursor right away.  detachCursor()
+    // takes its own locks, and deletion of the cursor happens out of any lock.  If another thread
+    // managed to check the exhausted cursor out again in the meantime, leave it to them.
+    auto detachedCursor = detachCursor(nss, cursorId);
+    if (detachedCursor.isOK()) {
+        detachedCursor.getValue().reset();
+    }
 }
 
 Status ClusterCursorManager::killCursor(const NamespaceString& nss, CursorId cursorId) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-    CursorEntry* entry = getEntry_inlock(nss, cursorId);
-    if (!entry) {
+    auto partition = _cursorEntries.lockOnePartition(cursorId);
+    auto entryIt = partition->find(cursorId);
+    if (entryIt == partition->end() || entryIt->second.getNamespace() != nss) {
         return cursorNotFoundStatus(nss, cursorId);
     }
 
-    entry->setKillPending();
+    entryIt->second.setKillPending();
 
     return Status::OK();
 }
 
 void ClusterCursorManager::killMortalCursorsInactiveSince(Date_t cutoff) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-    for (auto& nsContainerPair : _namespaceToContainerMap) {
-        for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+    auto allPartitions = _cursorEntries.lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto& cursorIdEntryPair : partition) {
             CursorEntry& entry = cursorIdEntryPair.second;
             if (entry.getLifetimeType() == CursorLifetime::Mortal && entry.isCursorOwned() &&
                 entry.getLastActive() <= cutoff) {
@@ -347,10 +353,9 @@ void ClusterCursorManager::killMortalCursorsInactiveSince(Date_t cutoff) {
 }
 
 void ClusterCursorManager::killAllCursors() {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-    for (auto& nsContainerPair : _namespaceToContainerMap) {
-        for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+    auto allPartitions = _cursorEntries.lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto& cursorIdEntryPair : partition) {
             cursorIdEntryPair.second.setKillPending();
         }
     }
@@ -366,21 +371,22 @@ std::size_t ClusterCursorManager::reapZombieCursors() {
         bool isInactive;
     };
 
-    // List all zombie cursors under the manager lock, and kill them one-by-one while not holding
-    // the lock (ClusterClientCursor::kill() is blocking, so we don't want to hold a lock while
-    // issuing the kill).
+    // List all zombie cursors under the partition locks, and kill them one-by-one while not
+    // holding any lock (ClusterClientCursor::kill() is blocking, so we don't want to hold a lock
+    // while issuing the kill).
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
     std::vector<CursorDescriptor> zombieCursorDescriptors;
-    for (auto& nsContainerPair : _namespaceToContainerMap) {
-        const NamespaceString& nss = nsContainerPair.first;
-        for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
-            CursorId cursorId = cursorIdEntryPair.first;
-            const CursorEntry& entry = cursorIdEntryPair.second;
-            if (!entry.getKillPending()) {
-                continue;
+    {
+        auto allPartitions = _cursorEntries.lockAllPartitions();
+        for (auto&& partition : allPartitions) {
+            for (auto& cursorIdEntryPair : partition) {
+                const CursorEntry& entry = cursorIdEntryPair.second;
+                if (!entry.getKillPending()) {
+                    continue;
+                }
+                zombieCursorDescriptors.emplace_back(
+                    entry.getNamespace(), cursorIdEntryPair.first, entry.isInactive());
             }
-            zombieCursorDescriptors.emplace_back(nss, cursorId, entry.isInactive());
         }
     }
 
@@ -388,20 +394,18 @@ std::size_t ClusterCursorManager::reapZombieCursors() {
 
     for (auto& cursorDescriptor : zombieCursorDescriptors) {
         StatusWith<std::unique_ptr<ClusterClientCursor>> zombieCursor =
-            detachCursor_inlock(cursorDescriptor.ns, cursorDescriptor.cursorId);
+            detachCursor(cursorDescriptor.ns, cursorDescriptor.cursorId);
         if (!zombieCursor.isOK()) {
             // Cursor in use, or has already been deleted.
             continue;
         }
 
-        lk.unlock();
         // Pass a null OperationContext, because this call should not actually schedule any remote
         // work: the cursor is already pending kill, meaning the killCursors commands are already
         // being scheduled to be sent to the remote shard hosts. This method will just wait for them
         // all to be scheduled.
         zombieCursor.getValue()->kill(nullptr);
         zombieCursor.getValue().reset();
-        lk.lock();
 
         if (cursorDescriptor.isInactive) {
             ++cursorsTimedOut;
@@ -411,12 +415,11 @@ std::size_t ClusterCursorManager::reapZombieCursors() {
 }
 
 ClusterCursorManager::Stats ClusterCursorManager::stats() const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
     Stats stats;
 
-    for (auto& nsContainerPair : _namespaceToContainerMap) {
-        for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+    auto allPartitions = _cursorEntries.lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto& cursorIdEntryPair : partition) {
             const CursorEntry& entry = cursorIdEntryPair.second;
 
             if (entry.getKillPending()) {
@@ -445,7 +448,7 @@ ClusterCursorManager::Stats ClusterCursorManager::stats() const {
 
 boost::optional<NamespaceString> ClusterCursorManager::getNamespaceForCursorId(
     CursorId cursorId) const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    stdx::lock_guard<stdx::mutex> registrationLock(_registrationMutex);
 
     const auto it = _cursorIdPrefixToNamespaceMap.find(extractPrefixFromCursorId(cursorId));
     if (it == _cursorIdPrefixToNamespaceMap.end()) {
@@ -454,46 +457,38 @@ boost::optional<NamespaceString> ClusterCursorManager::getNamespaceForCursorId(
     return it->second;
 }
 
-ClusterCursorManager::CursorEntry* ClusterCursorManager::getEntry_inlock(const NamespaceString& nss,
-                                                                         CursorId cursorId) {
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    if (nsToContainerIt == _namespaceToContainerMap.end()) {
-        return nullptr;
-    }
-    CursorEntryMap& entryMap = nsToContainerIt->second.entryMap;
-    auto entryMapIt = entryMap.find(cursorId);
-    if (entryMapIt == entryMap.end()) {
-        return nullptr;
-    }
-
-    return &entryMapIt->second;
-}
-
-StatusWith<std::unique_ptr<ClusterClientCursor>> ClusterCursorManager::detachCursor_inlock(
+StatusWith<std::unique_ptr<ClusterClientCursor>> ClusterCursorManager::detachCursor(
     const NamespaceString& nss, CursorId cursorId) {
-    CursorEntry* entry = getEntry_inlock(nss, cursorId);
-    if (!entry) {
-        return cursorNotFoundStatus(nss, cursorId);
-    }
+    std::unique_ptr<ClusterClientCursor> cursor;
+    {
+        auto partition = _cursorEntries.lockOnePartition(cursorId);
+        auto entryIt = partition->find(cursorId);
+        if (entryIt == partition->end() || entryIt->second.getNamespace() != nss) {
+            return cursorNotFoundStatus(nss, cursorId);
+        }
 
-    std::unique_ptr<ClusterClientCursor> cursor = entry->releaseCursor();
-    if (!cursor) {
-        return cursorInUseStatus(nss, cursorId);
+        cursor = entryIt->second.releaseCursor();
+        if (!cursor) {
+            return cursorInUseStatus(nss, cursorId);
+        }
+
+        partition->erase(entryIt);
     }
 
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    invariant(nsToContainerIt != _namespaceToContainerMap.end());
-    CursorEntryMap& entryMap = nsToContainerIt->second.entryMap;
-    size_t eraseResult = entryMap.erase(cursorId);
-    invariant(1 == eraseResult);
-    if (entryMap.empty()) {
-        // This was the last cursor remaining in the given namespace.  Erase all state associated
+    // Update the namespace bookkeeping after releasing the partition; '_registrationMutex' must
+    // never be acquired while a partition of '_cursorEntries' is held.
+    stdx::lock_guard<stdx::mutex> registrationLock(_registrationMutex);
+    auto nsInfoIt = _namespaceToInfoMap.find(nss);
+    invariant(nsInfoIt != _namespaceToInfoMap.end());
+    invariant(nsInfoIt->second.numCursors > 0);
+    if (--nsInfoIt->second.numCursors == 0) {
+        // This was the last cursor remaining on the given namespace.  Erase all state associated
         // with this namespace.
         size_t numDeleted =
-            _cursorIdPrefixToNamespaceMap.erase(nsToContainerIt->second.containerPrefix);
+            _cursorIdPrefixToNamespaceMap.erase(nsInfoIt->second.containerPrefix);
         invariant(numDeleted == 1);
-        _namespaceToContainerMap.erase(nsToContainerIt);
-        invariant(_namespaceToContainerMap.size() == _cursorIdPrefixToNamespaceMap.size());
+        _namespaceToInfoMap.erase(nsInfoIt);
+        invariant(_namespaceToInfoMap.size() == _cursorIdPrefixToNamespaceMap.size());
     }
 
     return std::move(cursor);
@@ -31,8 +31,10 @@
 #include <memory>
 #include <vector>
 
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/query/cluster_client_cursor.h"
 #include "mongo/stdx/mutex.h"
@@ -381,14 +383,6 @@ private:
                        CursorId cursorId,
                        CursorState cursorState);
 
-    /**
-     * Returns a pointer to the CursorEntry for the given cursor.  If the given cursor is not
-     * registered, returns null.
-     *
-     * Not thread-safe.
-     */
-    CursorEntry* getEntry_inlock(const NamespaceString& nss, CursorId cursorId);
-
     /**
      * De-registers the given cursor, and returns an owned pointer to the underlying
      * ClusterClientCursor object.
@@ -396,10 +390,10 @@ private:
      * If the given cursor is pinned, returns an error Status with code CursorInUse.  If the given
      * cursor is not registered, returns an error Status with code CursorNotFound.
      *
-     * Not thread-safe.
+     * Thread-safe.
      */
-    StatusWith<std::unique_ptr<ClusterClientCursor>> detachCursor_inlock(const NamespaceString& nss,
-                                                                         CursorId cursorId);
+    StatusWith<std::unique_ptr<ClusterClientCursor>> detachCursor(const NamespaceString& nss,
+                                                                  CursorId cursorId);
 
     /**
      * CursorEntry is a moveable, non-copyable container for a single cursor.
@@ -411,10 +405,12 @@ private:
         CursorEntry() = default;
 
         CursorEntry(std::unique_ptr<ClusterClientCursor> cursor,
+                    NamespaceString nss,
                     CursorType cursorType,
                     CursorLifetime cursorLifetime,
                     Date_t lastActive)
             : _cursor(std::move(cursor)),
+              _nss(std::move(nss)),
               _cursorType(cursorType),
               _cursorLifetime(cursorLifetime),
               _lastActive(lastActive) {
@@ -432,6 +428,10 @@ private:
             return _isInactive;
         }
 
+        const NamespaceString& getNamespace() const {
+            return _nss;
+        }
+
         CursorType getCursorType() const {
             return _cursorType;
         }
@@ -479,6 +479,7 @@ private:
 
     private:
         std::unique_ptr<ClusterClientCursor> _cursor;
+        NamespaceString _nss;
         bool _killPending = false;
         bool _isInactive = false;
         CursorType _cursorType = CursorType::NamespaceNotSharded;
@@ -487,34 +488,37 @@ private:
     };
 
     /**
-     * CursorEntryContainer is a moveable, non-copyable container for a set of cursors, where all
-     * contained cursors share the same 32-bit prefix of their cursor id.
+     * NamespaceInfo is the registration bookkeeping for a namespace with at least one registered
+     * cursor: the shared 32-bit cursor id prefix for the namespace, and the number of cursors
+     * currently registered on it.
      */
-    struct CursorEntryContainer {
-        MONGO_DISALLOW_COPYING(CursorEntryContainer);
-
-        CursorEntryContainer(uint32_t containerPrefix) : containerPrefix(containerPrefix) {}
-
-        CursorEntryContainer(CursorEntryContainer&& other) = default;
-        CursorEntryContainer& operator=(CursorEntryContainer&& other) = default;
-
-        // Common cursor id prefix for all cursors in this container.
+    struct NamespaceInfo {
+        // Common cursor id prefix for all cursors on this namespace.
         uint32_t containerPrefix;
 
-        // Map from cursor id to cursor entry.
-        CursorEntryMap entryMap;
+        // Number of registered cursors on this namespace.  When it drops to zero, all state for
+        // the namespace is erased.
+        size_t numCursors;
     };
 
+    // The number of partitions of the cursor entry map.  More partitions reduce contention between
+    // concurrent getMore operations, at the cost of a cache-aligned mutex and a hash table per
+    // partition.
+    static constexpr std::size_t kNumPartitions = 128;
+
     // Clock source.  Used when the 'last active' time for a cursor needs to be set/updated.  May be
     // concurrently accessed by multiple threads.
     ClockSource* _clockSource;
 
-    // Synchronizes access to all private state variables below.
-    mutable stdx::mutex _mutex;
+    // Set once the manager starts shutting down.  Read on the hot paths without any lock.
+    AtomicBool _inShutdown{false};
 
-    bool _inShutdown{false};
+    // Synchronizes cursor id generation and access to the two namespace bookkeeping maps below.
+    // Acquired only when cursors are registered, destroyed, or looked up by id prefix -- never on
+    // the getMore path.  Must not be acquired while holding a partition of '_cursorEntries'.
+    mutable stdx::mutex _registrationMutex;
 
-    // Randomness source.  Used for cursor id generation.
+    // Randomness source.  Used for cursor id generation.  Protected by '_registrationMutex'.
     PseudoRandom _pseudoRandom;
 
     // Map from cursor id prefix to associated namespace.  Exists only to provide namespace lookup
@@ -526,15 +530,22 @@ private:
     // namespace will all share the same prefix.
     //
     // Entries are added when the first cursor on the given namespace is registered, and removed
-    // when the last cursor on the given namespace is destroyed.
+    // when the last cursor on the given namespace is destroyed.  Protected by
+    // '_registrationMutex'.
     stdx::unordered_map<uint32_t, NamespaceString> _cursorIdPrefixToNamespaceMap;
 
-    // Map from namespace to the CursorEntryContainer for that namespace.
+    // Map from namespace to the registration bookkeeping for that namespace.
     //
     // Entries are added when the first cursor on the given namespace is registered, and removed
-    // when the last cursor on the given namespace is destroyed.
-    stdx::unordered_map<NamespaceString, CursorEntryContainer, NamespaceString::Hasher>
-        _namespaceToContainerMap;
+    // when the last cursor on the given namespace is destroyed.  Protected by
+    // '_registrationMutex'.
+    stdx::unordered_map<NamespaceString, NamespaceInfo, NamespaceString::Hasher>
+        _namespaceToInfoMap;
+
+    // All registered cursors, keyed by cursor id and guarded by per-partition mutexes.  The random
+    // 32-bit suffix of each cursor id spreads the cursors of a single namespace across partitions,
+    // so concurrent getMores contend only when their cursors hash to the same partition.
+    mutable Partitioned<CursorEntryMap, kNumPartitions> _cursorEntries;
 
     size_t _cursorsTimedOut = 0;
 };
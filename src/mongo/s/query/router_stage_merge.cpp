@@ -52,7 +52,14 @@ StatusWith<ClusterQueryResult> RouterStageMerge::next(OperationContext* opCtx) {
         _executor->waitForEvent(event);
     }
 
-    return _arm.nextReady();
+    auto next = _arm.nextReady();
+
+    // If returning this result drained a remote's buffer, start fetching that remote's next
+    // batch now: the network round trip then overlaps with draining the remaining buffers and
+    // returning the batch to the client, instead of stalling a later call to ready().
+    _arm.scheduleReadAhead(opCtx);
+
+    return next;
 }
 
 void RouterStageMerge::kill(OperationContext* opCtx) {
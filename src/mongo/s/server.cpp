@@ -64,6 +64,7 @@
 #include "mongo/db/service_context_noop.h"
 #include "mongo/db/startup_warnings_common.h"
 #include "mongo/db/wire_version.h"
+#include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/task_executor_pool.h"
 #include "mongo/platform/process_id.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
@@ -236,6 +237,48 @@ static Status initializeSharding(OperationContext* opCtx) {
     return Status::OK();
 }
 
+/**
+ * Best-effort warm-up of the sharding task executors' connection pools before client traffic is
+ * accepted. Scheduling a ping to every shard host through every executor in the pool creates the
+ * per-host connection pools, each of which then keeps itself populated up to
+ * ShardingTaskExecutorPoolMinSize connections. Failures are ignored; hosts that are down simply
+ * stay cold and their pools get established on first use as before.
+ */
+static void warmUpConnectionPools(OperationContext* opCtx) {
+    auto const grid = Grid::get(opCtx);
+    auto executorPool = grid->getExecutorPool();
+
+    std::vector<ShardId> shardIds;
+    grid->shardRegistry()->getAllShardIds(&shardIds);
+
+    int scheduled = 0;
+    for (const auto& shardId : shardIds) {
+        auto shard = grid->shardRegistry()->getShardNoReload(shardId);
+        if (!shard) {
+            continue;
+        }
+
+        for (const auto& host : shard->getConnString().getServers()) {
+            // The request deliberately carries no OperationContext: the pings are fire and
+            // forget, and responses may arrive after startup has moved on.
+            const executor::RemoteCommandRequest request(host, "admin", BSON("ping" << 1), nullptr);
+
+            for (size_t i = 0; i < executorPool->getPoolSize() + 1; ++i) {
+                auto executor = (i == 0) ? executorPool->getFixedExecutor()
+                                         : executorPool->getArbitraryExecutor();
+                auto swHandle = executor->scheduleRemoteCommand(
+                    request, [](const executor::TaskExecutor::RemoteCommandCallbackArgs&) {});
+                if (swHandle.isOK()) {
+                    scheduled++;
+                }
+            }
+        }
+    }
+
+    LOG(1) << "warmed up connection pools with " << scheduled << " pings across "
+           << shardIds.size() << " shards";
+}
+
 static void _initWireSpec() {
     WireSpec& spec = WireSpec::instance();
     // connect to version supporting Write Concern only
@@ -312,6 +355,8 @@ static ExitCode runMongosServer() {
             ->getBalancerConfiguration()
             ->refreshAndCheck(opCtx.get())
             .transitional_ignore();
+
+        warmUpConnectionPools(opCtx.get());
     }
 
     Status status = getGlobalAuthorizationManager()->initialize(NULL);
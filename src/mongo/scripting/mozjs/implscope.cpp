@@ -35,6 +35,8 @@
 #include <js/CharacterEncoding.h>
 #include <jscustomallocator.h>
 #include <jsfriendapi.h>
+#include <memory>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/db/operation_context.h"
@@ -46,6 +48,7 @@
 #include "mongo/scripting/mozjs/valuewriter.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/threadlocal.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
@@ -98,6 +101,46 @@ bool gFirstRuntimeCreated = false;
 bool closeToMaxMemory() {
     return mongo::sm::get_total_bytes() > (kInterruptGCThreshold * mongo::sm::get_max_bytes());
 }
+
+/**
+ * A process-wide cache of XDR-encoded function bytecode, keyed by the function's source text.
+ * Decoding cached bytecode is considerably cheaper than a full parse and compile, and the encoded
+ * form can be decoded into any runtime, so a function compiled in one scope (e.g. a mapReduce
+ * reducer) does not need to be recompiled when another scope sees the same source.
+ */
+class CompiledFunctionCache {
+public:
+    using Bytecode = std::shared_ptr<const std::vector<uint8_t>>;
+
+    Bytecode lookup(const std::string& source) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = _cache.find(source);
+        return it != _cache.end() ? it->second : nullptr;
+    }
+
+    void store(const std::string& source, Bytecode bytecode) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_cache.size() >= kMaxEntries && _cache.find(source) == _cache.end()) {
+            // Prefer to keep the functions seen first; workloads that replay the same stored
+            // functions over and over are the ones this cache exists for.
+            return;
+        }
+        _cache[source] = std::move(bytecode);
+    }
+
+    void invalidate(const std::string& source) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _cache.erase(source);
+    }
+
+private:
+    static const size_t kMaxEntries = 128;
+
+    stdx::mutex _mutex;
+    stdx::unordered_map<std::string, Bytecode> _cache;  // protected by _mutex
+};
+
+CompiledFunctionCache gCompiledFunctionCache;
 }  // namespace
 
 MONGO_TRIVIALLY_CONSTRUCTIBLE_THREAD_LOCAL MozJSImplScope::ASANHandles* kCurrentASANHandles =
@@ -577,6 +620,21 @@ void MozJSImplScope::_MozJSCreateFunction(StringData raw, JS::MutableHandleValue
     std::string code = str::stream()
         << "(" << parseJSFunctionOrExpression(_context, StringData(raw)) << ")";
 
+    // If any scope has already compiled this exact source, decode the cached bytecode rather
+    // than parsing and compiling it again.
+    if (auto bytecode = gCompiledFunctionCache.lookup(code)) {
+        JS::RootedObject decoded(
+            _context, JS_DecodeInterpretedFunction(_context, bytecode->data(), bytecode->size()));
+        if (decoded) {
+            fun.setObject(*decoded);
+            return;
+        }
+
+        // A failed decode is not fatal; drop the entry and recompile from source.
+        JS_ClearPendingException(_context);
+        gCompiledFunctionCache.invalidate(code);
+    }
+
     JS::CompileOptions co(_context);
     setCompileOptions(&co);
 
@@ -584,6 +642,20 @@ void MozJSImplScope::_MozJSCreateFunction(StringData raw, JS::MutableHandleValue
     uassert(10232,
             "not a function",
             fun.isObject() && JS_ObjectIsFunction(_context, fun.toObjectOrNull()));
+
+    JS::RootedObject compiled(_context, fun.toObjectOrNull());
+    uint32_t length;
+    if (void* data = JS_EncodeInterpretedFunction(_context, compiled, &length)) {
+        gCompiledFunctionCache.store(code,
+                                     std::make_shared<const std::vector<uint8_t>>(
+                                         static_cast<const uint8_t*>(data),
+                                         static_cast<const uint8_t*>(data) + length));
+        JS_free(_context, data);
+    } else {
+        // Not every function can be encoded; failing to cache one just means that source will
+        // be compiled from scratch next time.
+        JS_ClearPendingException(_context);
+    }
 }
 
 BSONObj MozJSImplScope::callThreadArgs(const BSONObj& args) {
@@ -73,6 +73,13 @@ struct CompressionHeader {
 
 const transport::Session::Decoration<MessageCompressorManager> getForSession =
     transport::Session::declareDecoration<MessageCompressorManager>();
+
+// Adaptive compression parameters. After compressing kSampleWindowMessages messages, if the
+// bytes saved over the window are less than kMinSavingsPercent of the input bytes, compression
+// is skipped for the next kBackoffMessages messages before sampling again.
+const int32_t kSampleWindowMessages = 64;
+const int32_t kBackoffMessages = 1024;
+const int64_t kMinSavingsPercent = 10;
 }  // namespace
 
 MessageCompressorManager::MessageCompressorManager()
@@ -85,6 +92,15 @@ StatusWith<Message> MessageCompressorManager::compressMessage(const Message& msg
     if (_negotiated.size() == 0) {
         return {msg};
     }
+
+    // If recent sampling showed that this connection's traffic doesn't compress well, pass
+    // messages through uncompressed for a while. This is always legal - receivers key
+    // decompression off the dbCompressed opcode, not off the negotiation.
+    if (_skipRemaining > 0) {
+        _skipRemaining--;
+        return {msg};
+    }
+
     auto compressor = _negotiated[0];
 
     LOG(3) << "Compressing message with " << compressor->getName();
@@ -122,6 +138,24 @@ StatusWith<Message> MessageCompressorManager::compressMessage(const Message& msg
     auto realCompressedSize = sws.getValue();
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
 
+    // Account for this message in the current sampling window, and back off if the window
+    // shows compression isn't shrinking this connection's traffic enough to bother.
+    _sampleBytesIn += inputHeader.dataLen();
+    _sampleBytesOut += static_cast<int64_t>(realCompressedSize) + CompressionHeader::size();
+    if (++_sampledMessages >= kSampleWindowMessages) {
+        if (_sampleBytesIn - _sampleBytesOut < _sampleBytesIn * kMinSavingsPercent / 100) {
+            LOG(2) << "Compression with " << compressor->getName() << " reduced "
+                   << _sampleBytesIn << " bytes to " << _sampleBytesOut
+                   << " over the last " << _sampledMessages
+                   << " messages; disabling compression for the next " << kBackoffMessages
+                   << " messages";
+            _skipRemaining = kBackoffMessages;
+        }
+        _sampleBytesIn = 0;
+        _sampleBytesOut = 0;
+        _sampledMessages = 0;
+    }
+
     return {Message(outputMessageBuffer)};
 }
 
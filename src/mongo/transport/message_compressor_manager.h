@@ -95,6 +95,11 @@ public:
      * If _negotiated is empty (meaning compression was not negotiated or is not supported), then
      * it will return a ref-count bumped copy of the input message.
      *
+     * Messages may also be passed through uncompressed: the wire protocol lets a sender
+     * transmit any individual message uncompressed after negotiation, and this manager uses
+     * that to back off on connections where the recently observed compression ratio does
+     * not pay for the CPU spent compressing.
+     *
      * If an error occurs in the compressor, it will return a Status error.
      */
     StatusWith<Message> compressMessage(const Message& msg);
@@ -119,6 +124,16 @@ public:
 private:
     std::vector<MessageCompressorBase*> _negotiated;
     MessageCompressorRegistry* _registry;
+
+    // Adaptive compression state. A session's messages flow through its manager one at a
+    // time, so these need no synchronization. Compressed input/output bytes are accumulated
+    // over a window of messages; if the window shows the compressor barely shrinking this
+    // connection's traffic, compression is skipped for a stretch of messages before
+    // sampling again.
+    int64_t _sampleBytesIn = 0;
+    int64_t _sampleBytesOut = 0;
+    int32_t _sampledMessages = 0;
+    int32_t _skipRemaining = 0;
 };
 
 }  // namespace mongo
@@ -32,12 +32,15 @@
 
 #include "mongo/transport/service_entry_point_impl.h"
 
+#include <memory>
 #include <vector>
 
 #include "mongo/db/auth/restriction_environment.h"
+#include "mongo/db/service_context.h"
 #include "mongo/transport/service_entry_point_utils.h"
 #include "mongo/transport/service_state_machine.h"
 #include "mongo/transport/session.h"
+#include "mongo/util/numa_placement.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 
@@ -52,10 +55,23 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
         stdx::make_unique<RestrictionEnvironment>(*remoteAddr, *localAddr);
     RestrictionEnvironment::set(session, std::move(restrictionEnvironment));
 
+    // If a ServiceExecutor is set up, run the session on its worker pool instead of a
+    // dedicated thread. The closures scheduled on the executor own the state machine, so
+    // an idle connection holds no thread - just its socket and the state machine itself.
+    if (_svcCtx->getServiceExecutor()) {
+        auto ssm = std::make_shared<ServiceStateMachine>(_svcCtx, std::move(session), false);
+        ssm->scheduleNext();
+        return;
+    }
+
     // Pass ownership of the transport::SessionHandle into our worker thread. When this
     // thread exits, the session will end.
     //
     launchServiceWorkerThread([ this, session = std::move(session) ]() mutable {
+        // Bind before touching session state so that first-touch allocation keeps this
+        // connection's memory on the node the thread runs on.
+        numa::bindCurrentThreadToNextNode();
+
         _nWorkers.addAndFetch(1);
         const auto guard = MakeGuard([this] { _nWorkers.subtractAndFetch(1); });
 
@@ -0,0 +1,124 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kNetwork
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/transport/service_executor_asio.h"
+
+#include "asio.hpp"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+namespace transport {
+
+ServiceExecutorASIO::ServiceExecutorASIO(std::shared_ptr<asio::io_context> ioContext,
+                                         size_t numWorkerThreads)
+    : _ioContext(std::move(ioContext)), _numWorkerThreads(numWorkerThreads) {
+    invariant(_numWorkerThreads > 0);
+}
+
+ServiceExecutorASIO::~ServiceExecutorASIO() {
+    shutdown().transitional_ignore();
+}
+
+Status ServiceExecutorASIO::start() {
+    invariant(_workerThreads.empty());
+
+    // Hold work against the io_context so that run() blocks for new events instead of
+    // returning while all connections are idle.
+    _workGuard = std::make_shared<asio::io_context::work>(*_ioContext);
+
+    log() << "Starting " << _numWorkerThreads << " service executor worker threads";
+    for (size_t i = 0; i < _numWorkerThreads; i++) {
+        _workerThreads.emplace_back([this, i] { _workerThreadBody(i); });
+    }
+
+    return Status::OK();
+}
+
+Status ServiceExecutorASIO::schedule(Task task) {
+    if (_stopping.load()) {
+        return {ErrorCodes::ShutdownInProgress, "Service executor is shutting down"};
+    }
+
+    _tasksQueued.addAndFetch(1);
+    _ioContext->post([this, task = std::move(task)] {
+        _tasksQueued.subtractAndFetch(1);
+        task();
+    });
+    return Status::OK();
+}
+
+void ServiceExecutorASIO::appendStats(BSONObjBuilder* bob) const {
+    BSONObjBuilder section(bob->subobjStart("serviceExecutor"));
+    section.append("executor", "asio");
+    section.append("threads", static_cast<int>(_numWorkerThreads));
+    section.append("queueDepth", static_cast<long long>(_tasksQueued.load()));
+    section.doneFast();
+}
+
+Status ServiceExecutorASIO::shutdown() {
+    if (_stopping.swap(true)) {
+        return Status::OK();
+    }
+
+    // Dropping the work guard and stopping the io_context lets run() return in each worker.
+    _workGuard.reset();
+    _ioContext->stop();
+
+    for (auto& thread : _workerThreads) {
+        thread.join();
+    }
+    _workerThreads.clear();
+
+    return Status::OK();
+}
+
+void ServiceExecutorASIO::_workerThreadBody(size_t threadId) {
+    setThreadName(str::stream() << "worker" << threadId);
+    while (!_stopping.load()) {
+        try {
+            _ioContext->run();
+            _ioContext->reset();
+        } catch (...) {
+            severe() << "Uncaught exception in service executor worker thread: "
+                     << exceptionToStatus();
+            fassertFailed(40563);
+        }
+    }
+}
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,82 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/transport/service_executor_base.h"
+
+namespace asio {
+class io_context;
+}  // namespace asio
+
+namespace mongo {
+namespace transport {
+
+/**
+ * A ServiceExecutor that runs tasks on a fixed-size pool of worker threads driving an ASIO
+ * io_context. The io_context is shared with TransportLayerASIO, so the same threads that
+ * execute scheduled tasks also service network readiness events; a connection waiting for
+ * a message holds no thread at all until its socket becomes readable.
+ */
+class ServiceExecutorASIO final : public ServiceExecutorBase {
+    MONGO_DISALLOW_COPYING(ServiceExecutorASIO);
+
+public:
+    ServiceExecutorASIO(std::shared_ptr<asio::io_context> ioContext, size_t numWorkerThreads);
+    ~ServiceExecutorASIO();
+
+    Status start() final;
+    Status schedule(Task task) final;
+    Status shutdown() final;
+    void appendStats(BSONObjBuilder* bob) const final;
+
+private:
+    void _workerThreadBody(size_t threadId);
+
+    std::shared_ptr<asio::io_context> _ioContext;
+    const size_t _numWorkerThreads;
+    std::vector<stdx::thread> _workerThreads;
+    AtomicWord<bool> _stopping{false};
+
+    // Number of tasks scheduled but not yet run; the queue depth reported in serverStatus.
+    AtomicWord<int64_t> _tasksQueued{0};
+
+    // Keeps io_context::run() from returning while the workers are idle. Declared as a
+    // shared_ptr to void so the header does not need the full asio headers for
+    // asio::io_context::work.
+    std::shared_ptr<void> _workGuard;
+};
+
+}  // namespace transport
+}  // namespace mongo
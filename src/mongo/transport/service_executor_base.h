@@ -0,0 +1,78 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/base/status.h"
+#include "mongo/stdx/functional.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+namespace transport {
+
+/**
+ * The ServiceExecutor executes ServiceStateMachine state transitions on a pool of worker
+ * threads, so that idle connections cost only a socket and a small amount of state instead
+ * of a dedicated thread.
+ *
+ * Tasks scheduled here must never block indefinitely - they borrow a worker thread that
+ * other connections are waiting on.
+ */
+class ServiceExecutorBase {
+public:
+    using Task = stdx::function<void()>;
+
+    virtual ~ServiceExecutorBase() = default;
+
+    /**
+     * Starts the worker threads. Must be called before schedule().
+     */
+    virtual Status start() = 0;
+
+    /**
+     * Schedules a task to run on a worker thread as soon as one is available. Returns a
+     * non-OK status if the executor is shutting down and the task will never run.
+     */
+    virtual Status schedule(Task task) = 0;
+
+    /**
+     * Stops accepting new tasks and joins the worker threads. Safe to call more than once.
+     */
+    virtual Status shutdown() = 0;
+
+    /**
+     * Appends statistics about this executor (worker threads, queued tasks) to the builder
+     * for reporting in serverStatus.
+     */
+    virtual void appendStats(BSONObjBuilder* bob) const = 0;
+};
+
+}  // namespace transport
+}  // namespace mongo
@@ -38,6 +38,7 @@
 #include "mongo/stdx/memory.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/service_executor_base.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/ticket.h"
 #include "mongo/transport/transport_layer.h"
@@ -97,10 +98,14 @@ ServiceStateMachine::ServiceStateMachine(ServiceContext* svcContext,
     : _state{State::Source},
       _sep{svcContext->getServiceEntryPoint()},
       _sync(sync),
+      _serviceExecutor{svcContext->getServiceExecutor()},
       _dbClient{svcContext->makeClient("conn", std::move(session))},
       _dbClientPtr{_dbClient.get()},
       _threadName{str::stream() << "conn" << _dbClient->session()->id()},
-      _currentOwningThread{stdx::this_thread::get_id()} {}
+      _currentOwningThread{stdx::this_thread::get_id()} {
+    // Asynchronous mode requires an executor to schedule state transitions on.
+    invariant(_sync || _serviceExecutor);
+}
 
 const transport::SessionHandle& ServiceStateMachine::session() const {
     // The _dbClientPtr should always point to our Client which should always own our SessionHandle
@@ -214,7 +219,8 @@ void ServiceStateMachine::processMessage() {
             sinkCallback(session()->getTransportLayer()->wait(std::move(ticket)));
         } else {
             session()->getTransportLayer()->asyncWait(
-                std::move(ticket), [this](Status status) { sinkCallback(status); });
+                std::move(ticket),
+                [ssm = shared_from_this()](Status status) { ssm->sinkCallback(status); });
         }
     } else {
         _state = State::Source;
@@ -304,7 +310,8 @@ void ServiceStateMachine::runNext() {
                     sourceCallback(session()->getTransportLayer()->wait(std::move(ticket)));
                 } else {
                     session()->getTransportLayer()->asyncWait(
-                        std::move(ticket), [this](Status status) { sourceCallback(status); });
+                        std::move(ticket),
+                        [ssm = shared_from_this()](Status status) { ssm->sourceCallback(status); });
                     break;
                 }
             }
@@ -345,9 +352,25 @@ void ServiceStateMachine::runNext() {
     endSession();
 }
 
-// TODO: Right now this is a noop because we only run in synchronous mode. When an async
-// TransportLayer is written, this will call the serviceexecutor to schedule calls to runNext().
-void ServiceStateMachine::scheduleNext() {}
+void ServiceStateMachine::scheduleNext() {
+    // In synchronous mode the dedicated connection thread drives the state machine by
+    // calling runNext() in a loop, so there is nothing to schedule.
+    if (_sync) {
+        return;
+    }
+
+    auto status = _serviceExecutor->schedule([ssm = shared_from_this()] { ssm->runNext(); });
+    if (!status.isOK()) {
+        // The executor is shutting down, so clean up the session here. runNext() handles
+        // being called recursively by the same thread, so this is safe from any context
+        // that calls scheduleNext().
+        log() << "Unable to schedule session on the service executor: " << status
+              << ". Ending connection from " << session()->remote()
+              << " (connection id: " << session()->id() << ")";
+        _state = State::EndSession;
+        runNext();
+    }
+}
 
 void ServiceStateMachine::endSession() {
     auto tl = session()->getTransportLayer();
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include "mongo/base/status.h"
 #include "mongo/db/service_context.h"
@@ -49,8 +50,14 @@ class ServiceExecutorBase;
  * lifecycle of each user request as a state machine. It is the glue between the stateless
  * ServiceEntryPoint and TransportLayer that ties network and database logic together for a
  * user.
+ *
+ * In synchronous mode a dedicated worker thread owns the state machine on its stack and
+ * drives it by calling runNext() in a loop. In asynchronous mode the state machine must be
+ * owned by a shared_ptr; the closures scheduled on the ServiceExecutor and registered with
+ * the TransportLayer keep it alive, and it is destroyed after the session ends when the
+ * last of them is run.
  */
-class ServiceStateMachine {
+class ServiceStateMachine : public std::enable_shared_from_this<ServiceStateMachine> {
     ServiceStateMachine(ServiceStateMachine&) = delete;
     ServiceStateMachine& operator=(ServiceStateMachine&) = delete;
 
@@ -89,8 +96,8 @@ public:
     void runNext();
 
     /*
-     * scheduleNext() schedules a call to runNext() in the future. This will be implemented with
-     * an async TransportLayer.
+     * scheduleNext() schedules a call to runNext() on the ServiceExecutor. In synchronous
+     * mode it is a noop because the dedicated connection thread calls runNext() in a loop.
      *
      * It is guaranteed to unwind the stack, and not call runNext() recursively, but is not
      * guaranteed that runNext() will run after this returns.
@@ -134,6 +141,7 @@ private:
 
     ServiceEntryPoint* _sep;
     bool _sync;
+    transport::ServiceExecutorBase* _serviceExecutor;
 
     ServiceContext::UniqueClient _dbClient;
     const Client* _dbClientPtr;
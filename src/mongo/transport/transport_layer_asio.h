@@ -114,6 +114,15 @@ public:
 
     void shutdown() final;
 
+    /**
+     * Returns the io_context that drives this transport layer's network events. In async
+     * mode a ServiceExecutor runs this context on its worker pool so that the same threads
+     * handle readiness events and session state transitions.
+     */
+    std::shared_ptr<asio::io_context> getIOContext() const {
+        return _ioContext;
+    }
+
 private:
     class ASIOSession;
     class ASIOTicket;
@@ -137,7 +146,7 @@ private:
     // Only used if _listenerOptions.async is false.
     stdx::thread _listenerThread;
 
-    std::unique_ptr<asio::io_context> _ioContext;
+    std::shared_ptr<asio::io_context> _ioContext;
 #ifdef MONGO_CONFIG_SSL
     std::unique_ptr<asio::ssl::context> _sslContext;
     SSLParams::SSLModes _sslMode;
@@ -34,10 +34,12 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/transport/service_executor_asio.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer_asio.h"
 #include "mongo/transport/transport_layer_legacy.h"
 #include "mongo/util/net/ssl_types.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/time_support.h"
 #include <limits>
 
@@ -151,7 +153,31 @@ std::unique_ptr<TransportLayer> TransportLayerManager::createWithConfig(
     auto sep = ctx->getServiceEntryPoint();
     if (config->transportLayer == "asio") {
         transport::TransportLayerASIO::Options opts(config);
-        transportLayer = stdx::make_unique<transport::TransportLayerASIO>(opts, sep);
+
+        if (config->serviceExecutor == "asio") {
+            // Borrowed-thread mode: accepted sockets are non-blocking and a fixed pool of
+            // worker threads runs the transport layer's io_context, so the same threads
+            // service network readiness events and session state transitions.
+            opts.async = true;
+        }
+
+        auto asioTransportLayer = stdx::make_unique<transport::TransportLayerASIO>(opts, sep);
+
+        if (opts.async) {
+            const auto numWorkerThreads = [] {
+                ProcessInfo p;
+                if (auto availCores = p.getNumAvailableCores()) {
+                    return static_cast<size_t>(*availCores);
+                }
+                return static_cast<size_t>(p.getNumCores());
+            }();
+            auto serviceExecutor = stdx::make_unique<transport::ServiceExecutorASIO>(
+                asioTransportLayer->getIOContext(), numWorkerThreads);
+            fassert(40564, serviceExecutor->start());
+            ctx->setServiceExecutor(std::move(serviceExecutor));
+        }
+
+        transportLayer = std::move(asioTransportLayer);
     } else if (serverGlobalParams.transportLayer == "legacy") {
         transport::TransportLayerLegacy::Options opts(config);
         transportLayer = stdx::make_unique<transport::TransportLayerLegacy>(opts, sep);
@@ -0,0 +1,70 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/arena.h"
+
+namespace mongo {
+
+namespace {
+
+// Every allocation is rounded up so the next bump stays aligned for any object type.
+const size_t kAlignment = alignof(std::max_align_t);
+
+size_t alignUp(size_t size) {
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+}  // namespace
+
+void* Arena::allocate(size_t size) {
+    _bytesAllocated += size;
+    const size_t aligned = alignUp(size);
+
+    if (aligned > _chunkSize) {
+        // Oversized request: give it a dedicated chunk and keep bumping into the current one.
+        Chunk chunk{std::unique_ptr<char[]>(new char[aligned]), aligned, aligned};
+        _bytesReserved += aligned;
+        char* result = chunk.data.get();
+        _chunks.insert(_chunks.empty() ? _chunks.end() : _chunks.end() - 1, std::move(chunk));
+        return result;
+    }
+
+    if (_chunks.empty() || _chunks.back().size - _chunks.back().used < aligned) {
+        _chunks.push_back(Chunk{std::unique_ptr<char[]>(new char[_chunkSize]), _chunkSize, 0});
+        _bytesReserved += _chunkSize;
+    }
+
+    Chunk& chunk = _chunks.back();
+    char* result = chunk.data.get() + chunk.used;
+    chunk.used += aligned;
+    return result;
+}
+
+}  // namespace mongo
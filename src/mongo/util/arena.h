@@ -0,0 +1,142 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+
+namespace mongo {
+
+/**
+ * A chunked bump-pointer allocator. Allocations carve aligned slices off the current chunk,
+ * falling back to the general-purpose heap only once per chunk; individual allocations are
+ * never freed, the whole arena is released at once by the destructor. This trades memory held
+ * until destruction for allocation that is a pointer bump with no cross-thread coordination,
+ * which is the right trade for the many small, identically scoped allocations a single
+ * operation performs.
+ *
+ * Not thread safe. An arena must be used and destroyed by one thread at a time.
+ */
+class Arena {
+    MONGO_DISALLOW_COPYING(Arena);
+
+public:
+    static const size_t kDefaultChunkSize = 64 * 1024;
+
+    /**
+     * Creates an arena that obtains memory from the heap 'chunkSize' bytes at a time. No
+     * memory is reserved until the first allocation.
+     */
+    explicit Arena(size_t chunkSize = kDefaultChunkSize) : _chunkSize(chunkSize) {}
+
+    /**
+     * Returns a pointer to 'size' bytes, aligned for any object type. The bytes remain valid
+     * until the arena is destroyed. Requests larger than the chunk size get a dedicated chunk
+     * rather than growing the bump chunks.
+     */
+    void* allocate(size_t size);
+
+    /**
+     * Total bytes handed out by allocate(), before alignment padding.
+     */
+    size_t bytesAllocated() const {
+        return _bytesAllocated;
+    }
+
+    /**
+     * Total bytes obtained from the heap, including the unused tail of the current chunk.
+     */
+    size_t bytesReserved() const {
+        return _bytesReserved;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    const size_t _chunkSize;
+
+    // All chunks ever obtained; the last entry is the one allocations bump into. Oversized
+    // chunks are inserted before the last entry so they never steal its remaining capacity.
+    std::vector<Chunk> _chunks;
+
+    size_t _bytesAllocated = 0;
+    size_t _bytesReserved = 0;
+};
+
+/**
+ * Minimal C++ allocator handing out memory from an Arena, for use with standard containers:
+ *
+ *     Arena arena;
+ *     std::vector<int, ArenaAllocator<int>> vec{ArenaAllocator<int>(&arena)};
+ *
+ * deallocate() is a no-op; everything is freed when the arena is destroyed, so containers
+ * using this allocator must not outlive it.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena* arena) : _arena(arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.arena()) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(_arena->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    Arena* arena() const {
+        return _arena;
+    }
+
+private:
+    Arena* _arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+}  // namespace mongo
@@ -0,0 +1,96 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <cstring>
+#include <vector>
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/arena.h"
+
+namespace mongo {
+namespace {
+
+TEST(ArenaTest, ReservesNothingUntilFirstAllocation) {
+    Arena arena;
+    ASSERT_EQUALS(0U, arena.bytesReserved());
+    ASSERT_EQUALS(0U, arena.bytesAllocated());
+
+    arena.allocate(1);
+    ASSERT_EQUALS(Arena::kDefaultChunkSize, arena.bytesReserved());
+    ASSERT_EQUALS(1U, arena.bytesAllocated());
+}
+
+TEST(ArenaTest, AllocationsAreAlignedAndDistinct) {
+    Arena arena;
+    void* a = arena.allocate(3);
+    void* b = arena.allocate(5);
+
+    ASSERT_NOT_EQUALS(a, b);
+    ASSERT_EQUALS(0U, reinterpret_cast<uintptr_t>(a) % alignof(std::max_align_t));
+    ASSERT_EQUALS(0U, reinterpret_cast<uintptr_t>(b) % alignof(std::max_align_t));
+
+    // Earlier allocations stay intact as the arena grows across many chunks.
+    std::memset(a, 0xab, 3);
+    for (int i = 0; i < 10000; i++) {
+        arena.allocate(64);
+    }
+    ASSERT_EQUALS(0xab, static_cast<unsigned char*>(a)[2]);
+}
+
+TEST(ArenaTest, OversizedAllocationGetsDedicatedChunk) {
+    Arena arena(1024);
+    void* small = arena.allocate(16);
+    std::memset(small, 0x5c, 16);
+
+    const size_t bigSize = 64 * 1024;
+    void* big = arena.allocate(bigSize);
+    std::memset(big, 0xee, bigSize);
+
+    // The oversized chunk must not have consumed the bump chunk's remaining capacity.
+    void* next = arena.allocate(16);
+    ASSERT_EQUALS(1024U + bigSize, arena.bytesReserved());
+    ASSERT_EQUALS(static_cast<void*>(static_cast<char*>(small) + 16), next);
+    ASSERT_EQUALS(0x5c, static_cast<unsigned char*>(small)[15]);
+}
+
+TEST(ArenaTest, AllocatorAdapterWorksWithContainers) {
+    Arena arena;
+    std::vector<int, ArenaAllocator<int>> vec{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+
+    ASSERT_EQUALS(1000U, vec.size());
+    ASSERT_EQUALS(999, vec[999]);
+    ASSERT_GREATER_THAN_OR_EQUALS(arena.bytesAllocated(), 1000 * sizeof(int));
+}
+
+}  // namespace
+}  // namespace mongo
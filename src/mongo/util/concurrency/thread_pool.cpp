@@ -173,7 +173,7 @@ void ThreadPool::_join_inlock(stdx::unique_lock<stdx::mutex>* lk) {
 }
 
 Status ThreadPool::schedule(Task task) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
     switch (_state) {
         case joinRequired:
         case joining:
@@ -197,10 +197,64 @@ Status ThreadPool::schedule(Task task) {
     if (_numIdleThreads <= _pendingTasks.size()) {
         _lastFullUtilizationDate = Date_t::now();
     }
+    lk.unlock();
+    // Signal with the mutex released, so that the awakened worker does not immediately block on
+    // it.
     _workAvailable.notify_one();
     return Status::OK();
 }
 
+Status ThreadPool::scheduleBatch(std::vector<Task> tasks) {
+    if (tasks.empty()) {
+        return Status::OK();
+    }
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    switch (_state) {
+        case joinRequired:
+        case joining:
+        case shutdownComplete:
+            return Status(ErrorCodes::ShutdownInProgress,
+                          str::stream() << "Shutdown of thread pool " << _options.poolName
+                                        << " in progress");
+        case preStart:
+        case running:
+            break;
+        default:
+            MONGO_UNREACHABLE;
+    }
+    for (auto& task : tasks) {
+        _pendingTasks.emplace_back(std::move(task));
+    }
+    if (_state == preStart) {
+        return Status::OK();
+    }
+    while (_numIdleThreads < _pendingTasks.size() && _threads.size() < _options.maxThreads) {
+        const size_t numThreadsBefore = _threads.size();
+        _startWorkerThread_inlock();
+        if (_threads.size() == numThreadsBefore) {
+            // Could not start another thread; make do with the workers we have.
+            break;
+        }
+    }
+    if (_numIdleThreads <= _pendingTasks.size()) {
+        _lastFullUtilizationDate = Date_t::now();
+    }
+    // Wake at most one idle worker per pending task, collapsing to a single notify_all when the
+    // whole pool is needed. As above, signal with the mutex released so that awakened workers do
+    // not immediately block on it.
+    const bool wakeAll = _pendingTasks.size() >= _numIdleThreads;
+    const size_t numToWake = std::min(_pendingTasks.size(), _numIdleThreads);
+    lk.unlock();
+    if (wakeAll) {
+        _workAvailable.notify_all();
+    } else {
+        for (size_t i = 0; i < numToWake; ++i) {
+            _workAvailable.notify_one();
+        }
+    }
+    return Status::OK();
+}
+
 void ThreadPool::waitForIdle() {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
     // If there are any pending tasks, or non-idle threads, the pool is not idle.
@@ -119,6 +119,16 @@ public:
     void join() override;
     Status schedule(Task task) override;
 
+    /**
+     * Schedules "tasks" to run in order in the pool, as if by calling schedule() on each in turn,
+     * but acquires the pool mutex only once and wakes at most one idle worker per task. Callers
+     * submitting many small tasks at once should prefer this to a loop of schedule() calls, which
+     * pays one lock acquisition and one wakeup per task.
+     *
+     * Either all of the tasks are scheduled or, if the pool is shutting down, none of them are.
+     */
+    Status scheduleBatch(std::vector<Task> tasks);
+
     /**
      * Blocks the caller until there are no pending tasks on this pool.
      *
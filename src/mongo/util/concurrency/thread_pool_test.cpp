@@ -33,6 +33,7 @@
 #include <boost/optional.hpp>
 
 #include "mongo/base/init.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/thread.h"
@@ -177,6 +178,49 @@ TEST_F(ThreadPoolTest, MaxPoolSize20MinPoolSize15) {
         << "Failed to reap excess threads after " << durationCount<Milliseconds>(reapTime) << "ms";
 }
 
+TEST_F(ThreadPoolTest, ScheduleBatchRunsAllTasks) {
+    ThreadPool::Options options;
+    options.minThreads = 0;
+    options.maxThreads = 4;
+    auto& pool = makePool(options);
+    pool.startup();
+    AtomicInt32 count{0};
+    std::vector<ThreadPool::Task> tasks;
+    for (int i = 0; i < 100; ++i) {
+        tasks.emplace_back([&count] { count.fetchAndAdd(1); });
+    }
+    ASSERT_OK(pool.scheduleBatch(std::move(tasks)));
+    pool.waitForIdle();
+    ASSERT_EQ(100, count.load());
+    ASSERT_OK(pool.scheduleBatch({}));
+}
+
+TEST_F(ThreadPoolTest, ScheduleBatchBeforeStartupRunsTasksAfterStartup) {
+    ThreadPool::Options options;
+    options.maxThreads = 2;
+    auto& pool = makePool(options);
+    AtomicInt32 count{0};
+    std::vector<ThreadPool::Task> tasks;
+    for (int i = 0; i < 10; ++i) {
+        tasks.emplace_back([&count] { count.fetchAndAdd(1); });
+    }
+    ASSERT_OK(pool.scheduleBatch(std::move(tasks)));
+    ASSERT_EQ(10U, pool.getStats().numPendingTasks);
+    ASSERT_EQ(0, count.load());
+    pool.startup();
+    pool.waitForIdle();
+    ASSERT_EQ(10, count.load());
+}
+
+TEST_F(ThreadPoolTest, ScheduleBatchFailsAfterShutdown) {
+    auto& pool = makePool(ThreadPool::Options());
+    pool.startup();
+    pool.shutdown();
+    std::vector<ThreadPool::Task> tasks;
+    tasks.emplace_back([] {});
+    ASSERT_EQ(ErrorCodes::ShutdownInProgress, pool.scheduleBatch(std::move(tasks)));
+}
+
 DEATH_TEST(ThreadPoolTest, MaxThreadsTooFewDies, "but the maximum must be at least 1") {
     ThreadPool::Options options;
     options.maxThreads = 0;
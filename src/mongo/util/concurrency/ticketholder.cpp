@@ -68,25 +68,37 @@ bool TicketHolder::tryAcquire() {
 }
 
 void TicketHolder::waitForTicket() {
+    if (tryAcquire())
+        return;
+
+    _waiters.addAndFetch(1);
     while (0 != sem_wait(&_sem)) {
         if (errno != EINTR)
             _check(-1);
     }
+    _waiters.subtractAndFetch(1);
 }
 
 bool TicketHolder::waitForTicketUntil(Date_t until) {
+    if (tryAcquire())
+        return true;
+
     const long long millisSinceEpoch = until.toMillisSinceEpoch();
     struct timespec ts;
 
     ts.tv_sec = millisSinceEpoch / 1000;
     ts.tv_nsec = (millisSinceEpoch % 1000) * (1000 * 1000);
+    _waiters.addAndFetch(1);
     while (0 != sem_timedwait(&_sem, &ts)) {
-        if (errno == ETIMEDOUT)
+        if (errno == ETIMEDOUT) {
+            _waiters.subtractAndFetch(1);
             return false;
+        }
 
         if (errno != EINTR)
             _check(-1);
     }
+    _waiters.subtractAndFetch(1);
     return true;
 }
 
@@ -149,15 +161,27 @@ bool TicketHolder::tryAcquire() {
 void TicketHolder::waitForTicket() {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
 
+    if (_tryAcquire())
+        return;
+
+    _waiters.addAndFetch(1);
     while (!_tryAcquire()) {
         _newTicket.wait(lk);
     }
+    _waiters.subtractAndFetch(1);
 }
 
 bool TicketHolder::waitForTicketUntil(Date_t until) {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
 
-    return _newTicket.wait_until(lk, until.toSystemTimePoint(), [this] { return _tryAcquire(); });
+    if (_tryAcquire())
+        return true;
+
+    _waiters.addAndFetch(1);
+    const bool gotTicket =
+        _newTicket.wait_until(lk, until.toSystemTimePoint(), [this] { return _tryAcquire(); });
+    _waiters.subtractAndFetch(1);
+    return gotTicket;
 }
 
 void TicketHolder::release() {
@@ -213,4 +237,8 @@ bool TicketHolder::_tryAcquire() {
     return true;
 }
 #endif
+
+int TicketHolder::queued() const {
+    return _waiters.load();
+}
 }
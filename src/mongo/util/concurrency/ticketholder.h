@@ -61,7 +61,14 @@ public:
 
     int outof() const;
 
+    /**
+     * Returns the number of threads currently blocked waiting for a ticket.
+     */
+    int queued() const;
+
 private:
+    AtomicInt32 _waiters;
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
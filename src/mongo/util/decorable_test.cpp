@@ -152,6 +152,28 @@ TEST(DecorableTest, ThrowingConstructor) {
     ASSERT_EQ(1, numDestructedAs);
 }
 
+TEST(DecorableTest, ThrowingConstructorWithTrivialDecorations) {
+    numConstructedAs = 0;
+    numDestructedAs = 0;
+
+    // Trivially initializable decorations interleaved with the throwing one must not confuse
+    // the unwind logic, which tracks construction progress by declaration order.
+    DecorationRegistry registry;
+    registry.declareDecoration<int>();
+    registry.declareDecoration<A>();
+    registry.declareDecoration<int>();
+    registry.declareDecoration<ThrowA>();
+    registry.declareDecoration<A>();
+
+    try {
+        DecorationContainer d(&registry);
+    } catch (const UserException& ex) {
+        ASSERT_EQ(ErrorCodes::Unauthorized, ex.getCode());
+    }
+    ASSERT_EQ(1, numConstructedAs);
+    ASSERT_EQ(1, numDestructedAs);
+}
+
 TEST(DecorableTest, Alignment) {
     DecorationRegistry registry;
     const auto firstChar = registry.declareDecoration<char>();
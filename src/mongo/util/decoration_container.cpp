@@ -30,6 +30,8 @@
 
 #include "mongo/util/decoration_container.h"
 
+#include <cstring>
+
 #include "mongo/util/decoration_registry.h"
 
 namespace mongo {
@@ -37,6 +39,9 @@ namespace mongo {
 DecorationContainer::DecorationContainer(const DecorationRegistry* registry)
     : _registry(registry),
       _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+    // Zero-filling the buffer value-initializes every trivially constructible decoration,
+    // letting the registry skip their construction hooks.
+    std::memset(_decorationData.get(), 0, registry->getDecorationBufferSizeBytes());
     _registry->construct(this);
 }
 
@@ -42,22 +42,29 @@ DecorationContainer::DecorationDescriptor DecorationRegistry::declareDecoration(
         _totalSizeBytes += alignBytes - misalignment;
     }
     DecorationContainer::DecorationDescriptor result(_totalSizeBytes);
-    _decorationInfo.push_back(DecorationInfo(result, constructor, destructor));
+    const size_t declarationIndex = _numDecorations++;
+    if (constructor)
+        _constructors.push_back(ConstructorInfo{result, declarationIndex, constructor});
+    if (destructor)
+        _destructors.push_back(DestructorInfo{result, declarationIndex, destructor});
     _totalSizeBytes += sizeBytes;
     return result;
 }
 
 void DecorationRegistry::construct(DecorationContainer* decorable) const {
-    auto iter = _decorationInfo.cbegin();
+    auto iter = _constructors.cbegin();
     try {
-        for (; iter != _decorationInfo.cend(); ++iter) {
+        for (; iter != _constructors.cend(); ++iter) {
             iter->constructor(decorable->getDecoration(iter->descriptor));
         }
     } catch (...) {
         try {
-            while (iter != _decorationInfo.cbegin()) {
-                --iter;
-                iter->destructor(decorable->getDecoration(iter->descriptor));
+            // Destroy the decorations constructed before the one that threw: those declared
+            // before it that have a nontrivial destructor, in reverse declaration order.
+            const size_t failedIndex = iter->declarationIndex;
+            for (auto diter = _destructors.crbegin(); diter != _destructors.crend(); ++diter) {
+                if (diter->declarationIndex < failedIndex)
+                    diter->destructor(decorable->getDecoration(diter->descriptor));
             }
         } catch (...) {
             std::terminate();
@@ -68,10 +75,7 @@ void DecorationRegistry::construct(DecorationContainer* decorable) const {
 
 void DecorationRegistry::destruct(DecorationContainer* decorable) const {
     try {
-        for (DecorationInfoVector::const_reverse_iterator iter = _decorationInfo.rbegin(),
-                                                          end = _decorationInfo.rend();
-             iter != end;
-             ++iter) {
+        for (auto iter = _destructors.crbegin(); iter != _destructors.crend(); ++iter) {
             iter->destructor(decorable->getDecoration(iter->descriptor));
         }
     } catch (...) {
@@ -79,12 +83,4 @@ void DecorationRegistry::destruct(DecorationContainer* decorable) const {
     }
 }
 
-DecorationRegistry::DecorationInfo::DecorationInfo(
-    DecorationContainer::DecorationDescriptor inDescriptor,
-    DecorationConstructorFn inConstructor,
-    DecorationDestructorFn inDestructor)
-    : descriptor(std::move(inDescriptor)),
-      constructor(std::move(inConstructor)),
-      destructor(std::move(inDestructor)) {}
-
 }  // namespace mongo
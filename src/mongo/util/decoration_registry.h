@@ -33,7 +33,6 @@
 
 #include "mongo/base/disallow_copying.h"
 #include "mongo/base/static_assert.h"
-#include "mongo/stdx/functional.h"
 #include "mongo/util/decoration_container.h"
 
 namespace mongo {
@@ -62,8 +61,15 @@ public:
     DecorationContainer::DecorationDescriptorWithType<T> declareDecoration() {
         MONGO_STATIC_ASSERT_MSG(std::is_nothrow_destructible<T>::value,
                                 "Decorations must be nothrow destructible");
+        // The decoration buffer is zero-filled before construction, which already
+        // value-initializes trivially constructible decorations, and trivially destructible
+        // ones need no teardown. Register null hooks for them so they are omitted from the
+        // construct/destruct lists entirely.
         return DecorationContainer::DecorationDescriptorWithType<T>(std::move(declareDecoration(
-            sizeof(T), std::alignment_of<T>::value, &constructAt<T>, &destructAt<T>)));
+            sizeof(T),
+            std::alignment_of<T>::value,
+            std::is_trivially_default_constructible<T>::value ? nullptr : &constructAt<T>,
+            std::is_trivially_destructible<T>::value ? nullptr : &destructAt<T>)));
     }
 
     size_t getDecorationBufferSizeBytes() const {
@@ -87,27 +93,34 @@ public:
 
 private:
     /**
-     * Function that constructs (initializes) a single instance of a decoration.
+     * Function that constructs (initializes) a single instance of a decoration. May be null
+     * for decorations that are fully initialized by zero-filling their storage.
      */
-    using DecorationConstructorFn = stdx::function<void(void*)>;
+    using DecorationConstructorFn = void (*)(void*);
 
     /**
-     * Function that destructs (deinitializes) a single instance of a decoration.
+     * Function that destructs (deinitializes) a single instance of a decoration. May be null
+     * for trivially destructible decorations.
      */
-    using DecorationDestructorFn = stdx::function<void(void*)>;
-
-    struct DecorationInfo {
-        DecorationInfo() {}
-        DecorationInfo(DecorationContainer::DecorationDescriptor descriptor,
-                       DecorationConstructorFn constructor,
-                       DecorationDestructorFn destructor);
+    using DecorationDestructorFn = void (*)(void*);
 
+    /**
+     * Entry in the list of decorations with a nontrivial constructor (destructor). The
+     * declaration index orders entries of the two lists relative to each other, which the
+     * exception-unwind path of construct() needs to know which decorations were already
+     * constructed when a constructor throws.
+     */
+    struct ConstructorInfo {
         DecorationContainer::DecorationDescriptor descriptor;
+        size_t declarationIndex;
         DecorationConstructorFn constructor;
-        DecorationDestructorFn destructor;
     };
 
-    using DecorationInfoVector = std::vector<DecorationInfo>;
+    struct DestructorInfo {
+        DecorationContainer::DecorationDescriptor descriptor;
+        size_t declarationIndex;
+        DecorationDestructorFn destructor;
+    };
 
     template <typename T>
     static void constructAt(void* location) {
@@ -130,7 +143,13 @@ private:
                                                                 DecorationConstructorFn constructor,
                                                                 DecorationDestructorFn destructor);
 
-    DecorationInfoVector _decorationInfo;
+    // Packed lists holding only the decorations that need code to run at construction and
+    // destruction time. construct() and destruct() iterate these, so a registry full of
+    // trivially initializable decorations costs nothing per instance beyond the zero fill.
+    std::vector<ConstructorInfo> _constructors;
+    std::vector<DestructorInfo> _destructors;
+
+    size_t _numDecorations{0};
     size_t _totalSizeBytes{0};
 };
 
@@ -26,6 +26,8 @@
  *    it in the license file.
  */
 
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kControl
+
 #include "mongo/platform/basic.h"
 
 #include "mongo/util/fast_clock_source_factory.h"
@@ -34,16 +36,45 @@
 
 #include "mongo/stdx/memory.h"
 #include "mongo/util/background_thread_clock_source.h"
+#include "mongo/util/log.h"
 #include "mongo/util/system_clock_source.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
+namespace {
+
+// Number of trial reads used to estimate the cost of reading the system clock.
+const int kTrialClockReads = 10000;
+
+// If the system clock can be read in at most this many nanoseconds on average, it is cheap
+// enough -- implemented without a system call, e.g. via the vDSO on Linux -- to serve as the
+// fast clock directly.
+const long long kMaxNanosPerFastRead = 100;
+
+}  // namespace
+
 std::unique_ptr<ClockSource> FastClockSourceFactory::create(Milliseconds granularity) {
-    // TODO: Create the fastest to read wall clock available on the system.
-    // For now, assume there is no built-in fast wall clock so instead
-    // create a background-thread-based timer.
-    return stdx::make_unique<BackgroundThreadClockSource>(stdx::make_unique<SystemClockSource>(),
-                                                          granularity);
+    auto systemClock = stdx::make_unique<SystemClockSource>();
+
+    // If the system wall clock is cheap to read on this platform, use it directly: it costs
+    // about as much as the cached-time load of the background thread clock, but is accurate to
+    // the clock's full precision rather than to 'granularity'. Otherwise fall back to a
+    // background thread that refreshes a cached time every 'granularity'.
+    Timer timer;
+    for (int i = 0; i < kTrialClockReads; ++i) {
+        systemClock->now();
+    }
+    const long long nanosPerRead = timer.micros() * 1000 / kTrialClockReads;
+    if (nanosPerRead <= kMaxNanosPerFastRead) {
+        LOG(1) << "System clock reads take approximately " << nanosPerRead
+               << "ns; using the system clock as the fast clock source";
+        return std::move(systemClock);
+    }
+
+    LOG(1) << "System clock reads take approximately " << nanosPerRead
+           << "ns; using a background thread clock source with " << granularity << " granularity";
+    return stdx::make_unique<BackgroundThreadClockSource>(std::move(systemClock), granularity);
 }
 
 }  // namespace mongo
@@ -0,0 +1,59 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/fast_clock_source_factory.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+TEST(FastClockSourceFactoryTest, ClockTracksSystemTime) {
+    auto clock = FastClockSourceFactory::create(Milliseconds(10));
+    ASSERT(clock);
+
+    // Whichever implementation the factory picked, it must be at least as precise as the
+    // requested granularity.
+    ASSERT_LTE(clock->getPrecision(), Milliseconds(10));
+
+    // The reported time must loosely track the system clock.
+    const Date_t systemNow = Date_t::now();
+    const Date_t fastNow = clock->now();
+    ASSERT_LTE(fastNow - systemNow, Minutes(1));
+    ASSERT_LTE(systemNow - fastNow, Minutes(1));
+
+    // The clock must advance.
+    sleepmillis(50);
+    ASSERT_GTE(clock->now() - fastNow, Milliseconds(10));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -35,6 +35,7 @@
 #include "mongo/config.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/util/concurrency/threadlocal.h"
 #include "mongo/util/log.h"
 #include "mongo/util/stacktrace.h"
 
@@ -62,7 +63,9 @@
 // fixed-size hash tables. Size of the separate hash tables is configurable
 // but something on the order of tens of MB should suffice for most purposes.
 //
-// Performance overhead is small because it only samples a fraction of the allocations.
+// Performance overhead is small because it only samples a fraction of the allocations;
+// the sampling trigger is a per-thread byte countdown, so the common unsampled
+// allocation path touches no shared state.
 //
 // Samples allocate calls every so many bytes allocated.
 //   * a stack trace is obtained, and entered in a stack hash table if it's a new stack trace
@@ -72,8 +75,13 @@
 //   * the number of active bytes charged to the allocating stack trace is decreased
 //   * the object is removed from the object hash table
 //
-// Enable at startup time (only) with
+// Enable at startup time with
 //     mongod --setParameter heapProfilingEnabled=true
+// or at runtime, without a restart, by giving the sampling interval a nonzero value:
+//     db.adminCommand({setParameter: 1, heapProfilingSampleIntervalBytes: 262144})
+// Setting heapProfilingSampleIntervalBytes to 0 at runtime pauses sampling; the profile
+// collected so far remains queryable via serverStatus, and the hash tables are retained
+// until shutdown so sampling can be resumed later.
 //
 // If enabled, adds a heapProfile section to serverStatus as follows:
 //
@@ -273,6 +281,13 @@ public:
 };
 
 
+// Number of bytes the current thread may allocate before its next sample is taken.
+// Making the sampling trigger a per-thread countdown keeps the common (unsampled)
+// allocation path free of shared state; a single process-wide atomic counter becomes a
+// measurable point of cache-line contention when every thread updates it on every
+// allocation. Zero means the countdown has not yet been initialized for this thread.
+MONGO_TRIVIALLY_CONSTRUCTIBLE_THREAD_LOCAL int64_t bytesUntilNextSample = 0;
+
 class HeapProfiler {
 private:
     // 0: sampling internally disabled
@@ -283,7 +298,7 @@ private:
     stdx::mutex hashtable_mutex;  // guards updates to both object and stack hash tables
     stdx::mutex stackinfo_mutex;  // guards against races updating the StackInfo bson representation
 
-    // cumulative bytes allocated - determines when samples are taken
+    // estimated cumulative bytes allocated - updated only when a sample is taken
     std::atomic_size_t bytesAllocated{0};  // NOLINT
 
     // estimated currently active bytes - sum of activeBytes for all stacks
@@ -386,19 +401,27 @@ private:
     //
     void _alloc(const void* objPtr, size_t objLen) {
         // still profiling?
-        if (sampleIntervalBytes == 0)
+        const int64_t sampleInterval = sampleIntervalBytes;
+        if (sampleInterval == 0)
             return;
 
-        // Sample every sampleIntervalBytes bytes of allocation.
+        // Sample every sampleIntervalBytes bytes of allocation per thread; see
+        // bytesUntilNextSample above for why the countdown is thread-local.
         // We charge each sampled stack with the amount of memory allocated since the last sample
         // this could grossly overcharge any given stack sample, but on average over a large
         // number of samples will be correct.
-        size_t lastSample = bytesAllocated.fetch_add(objLen);
-        size_t currentSample = lastSample + objLen;
-        size_t accountedLen = sampleIntervalBytes *
-            (currentSample / sampleIntervalBytes - lastSample / sampleIntervalBytes);
-        if (accountedLen == 0)
+        int64_t countdown = bytesUntilNextSample;
+        if (countdown == 0)
+            countdown = sampleInterval;  // first allocation made by this thread
+        countdown -= objLen;
+        if (countdown > 0) {
+            bytesUntilNextSample = countdown;
             return;
+        }
+        const int64_t intervals = 1 + -countdown / sampleInterval;
+        bytesUntilNextSample = countdown + intervals * sampleInterval;
+        const size_t accountedLen = intervals * sampleInterval;
+        bytesAllocated += accountedLen;
 
         // Get backtrace.
         Stack tempStack;
@@ -616,21 +639,54 @@ public:
     static HeapProfiler* heapProfiler;
     static bool enabledParameter;
     static long long sampleIntervalBytesParameter;
+    static stdx::mutex startMutex;
+    static bool startupComplete;
 
     HeapProfiler() {
         // Set sample interval from the parameter.
         sampleIntervalBytes = sampleIntervalBytesParameter;
 
-        // This is our only allocator dependency - ifdef and change as
-        // appropriate for other allocators, using hooks or shims.
         // For tcmalloc we skip two frames that are internal to the allocator
         // so that the top frame is the public tc_* function.
         skipStartFrames = 2;
         skipEndFrames = 0;
+    }
+
+    // Constructs the profiler, allocating its hash tables, then installs the allocator hooks.
+    // The profiler pointer must be published before the hooks are installed because the hooks
+    // dereference it unconditionally, possibly from other threads.
+    // Must be called with startMutex held.
+    static void start() {
+        heapProfiler = new HeapProfiler();
+
+        // This is our only allocator dependency - ifdef and change as
+        // appropriate for other allocators, using hooks or shims.
         MallocHook::AddNewHook(alloc);
         MallocHook::AddDeleteHook(free);
     }
 
+    // Sets the sampling interval, constructing and starting the profiler on first use at
+    // runtime. Setting the interval to zero pauses sampling; the profile collected so far
+    // remains queryable via serverStatus and the hash tables are retained until shutdown, so
+    // sampling can be resumed later.
+    static Status setSampleIntervalBytes(long long newValue) {
+        if (newValue < 0) {
+            return Status(ErrorCodes::BadValue,
+                          "heapProfilingSampleIntervalBytes must be a non-negative integer");
+        }
+        stdx::lock_guard<stdx::mutex> lk(startMutex);
+        sampleIntervalBytesParameter = newValue;
+        if (heapProfiler) {
+            heapProfiler->sampleIntervalBytes = newValue;
+        } else if (newValue > 0 && startupComplete) {
+            // First runtime enable - construct the profiler now. At startup the profiler is
+            // instead constructed by the StartHeapProfiling initializer, so that setting the
+            // interval on the command line does not by itself enable profiling.
+            start();
+        }
+        return Status::OK();
+    }
+
     static void generateServerStatusSection(BSONObjBuilder& builder) {
         if (heapProfiler)
             heapProfiler->_generateServerStatusSection(builder);
@@ -646,7 +702,7 @@ public:
     HeapProfilerServerStatusSection() : ServerStatusSection("heapProfile") {}
 
     bool includeByDefault() const override {
-        return HeapProfiler::enabledParameter;
+        return HeapProfiler::heapProfiler != nullptr;
     }
 
     BSONObj generateSection(OperationContext* opCtx,
@@ -664,19 +720,24 @@ public:
 HeapProfiler* HeapProfiler::heapProfiler;
 bool HeapProfiler::enabledParameter = false;
 long long HeapProfiler::sampleIntervalBytesParameter = 256 * 1024;
+stdx::mutex HeapProfiler::startMutex;
+bool HeapProfiler::startupComplete = false;
 
 ExportedServerParameter<bool, ServerParameterType::kStartupOnly> heapProfilingEnabledParameter(
     ServerParameterSet::getGlobal(), "heapProfilingEnabled", &HeapProfiler::enabledParameter);
 
-ExportedServerParameter<long long, ServerParameterType::kStartupOnly>
-    heapProfilingSampleIntervalBytes(ServerParameterSet::getGlobal(),
-                                     "heapProfilingSampleIntervalBytes",
-                                     &HeapProfiler::sampleIntervalBytesParameter);
+BoundServerParameter<long long> heapProfilingSampleIntervalBytes(
+    "heapProfilingSampleIntervalBytes",
+    [](const long long& newValue) { return HeapProfiler::setSampleIntervalBytes(newValue); },
+    [] { return HeapProfiler::sampleIntervalBytesParameter; },
+    ServerParameterType::kStartupAndRuntime);
 
 MONGO_INITIALIZER_GENERAL(StartHeapProfiling, ("EndStartupOptionHandling"), ("default"))
 (InitializerContext* context) {
-    if (HeapProfiler::enabledParameter)
-        HeapProfiler::heapProfiler = new HeapProfiler();
+    stdx::lock_guard<stdx::mutex> lk(HeapProfiler::startMutex);
+    HeapProfiler::startupComplete = true;
+    if (HeapProfiler::enabledParameter && !HeapProfiler::heapProfiler)
+        HeapProfiler::start();
     return Status::OK();
 }
 
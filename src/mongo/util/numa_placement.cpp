@@ -0,0 +1,147 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kControl
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/numa_placement.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/log.h"
+
+namespace mongo {
+namespace numa {
+namespace {
+
+bool placementEnabled = false;
+
+#ifdef __linux__
+
+/**
+ * Parses a sysfs cpulist string, e.g. "0-15,32-47", into "cpus". Returns false if nothing could
+ * be parsed.
+ */
+bool parseCpuList(const std::string& cpulist, cpu_set_t* cpus) {
+    CPU_ZERO(cpus);
+    bool any = false;
+    std::stringstream ss(cpulist);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        int first;
+        int last;
+        const int matched = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (matched < 1 || first < 0) {
+            continue;
+        }
+        if (matched == 1) {
+            last = first;
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, cpus);
+            any = true;
+        }
+    }
+    return any;
+}
+
+/**
+ * Returns one cpu_set_t per NUMA node with online CPUs, read from sysfs once on first use.
+ */
+const std::vector<cpu_set_t>& nodeCpuSets() {
+    static const std::vector<cpu_set_t> nodes = [] {
+        std::vector<cpu_set_t> result;
+        for (size_t node = 0;; node++) {
+            std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!in) {
+                break;
+            }
+            std::string cpulist;
+            std::getline(in, cpulist);
+            cpu_set_t cpus;
+            if (parseCpuList(cpulist, &cpus)) {
+                result.push_back(cpus);
+            }
+        }
+        return result;
+    }();
+    return nodes;
+}
+
+#endif  // __linux__
+
+}  // namespace
+
+size_t getNumNodes() {
+#ifdef __linux__
+    return std::max<size_t>(nodeCpuSets().size(), 1);
+#else
+    return 1;
+#endif
+}
+
+void enableWorkerThreadPlacement() {
+    placementEnabled = true;
+}
+
+void bindCurrentThreadToNextNode() {
+#ifdef __linux__
+    if (!placementEnabled) {
+        return;
+    }
+    const auto& nodes = nodeCpuSets();
+    if (nodes.size() < 2) {
+        return;
+    }
+
+    static AtomicUInt64 nextNode(0);
+    const size_t node = static_cast<size_t>(nextNode.fetchAndAdd(1)) % nodes.size();
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &nodes[node]) != 0) {
+        static AtomicWord<bool> logged(false);
+        if (!logged.swap(true)) {
+            warning() << "failed to bind worker thread to NUMA node " << node << ": "
+                      << errnoWithDescription();
+        }
+    }
+#endif
+}
+
+}  // namespace numa
+}  // namespace mongo
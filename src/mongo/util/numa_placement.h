@@ -0,0 +1,66 @@
+/**
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace mongo {
+namespace numa {
+
+/**
+ * Utilities for spreading worker threads across NUMA nodes.
+ *
+ * On a multi-node host, binding a connection's worker thread to one node keeps the memory that
+ * thread touches (session buffers, parsed messages) node-local via first-touch allocation, instead
+ * of being interleaved across nodes. Only Linux has an implementation; elsewhere every function
+ * behaves as if the host had a single node.
+ */
+
+/**
+ * Returns the number of NUMA nodes with online CPUs, or 1 if the host is not NUMA or the topology
+ * cannot be determined.
+ */
+size_t getNumNodes();
+
+/**
+ * Globally enables bindCurrentThreadToNextNode(). Called once at startup, before worker threads
+ * are spawned, when the operator has opted in.
+ */
+void enableWorkerThreadPlacement();
+
+/**
+ * Binds the calling thread to the CPUs of the next node in round-robin order. A no-op unless
+ * enableWorkerThreadPlacement() has been called and the host has more than one node. Binding
+ * failures are logged once and otherwise ignored; placement is an optimization, not a
+ * correctness requirement.
+ */
+void bindCurrentThreadToNextNode();
+
+}  // namespace numa
+}  // namespace mongo
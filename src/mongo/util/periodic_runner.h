@@ -28,12 +28,16 @@
 
 #pragma once
 
+#include <string>
+
 #include "mongo/base/disallow_copying.h"
 #include "mongo/stdx/functional.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
+
 /**
  * An interface for objects that run work items at specified intervals.
  *
@@ -47,8 +51,13 @@ public:
     using Job = stdx::function<void()>;
 
     struct PeriodicJob {
-        PeriodicJob(Job callable, Milliseconds period)
-            : job(std::move(callable)), interval(period) {}
+        PeriodicJob(std::string jobName, Job callable, Milliseconds period)
+            : name(std::move(jobName)), job(std::move(callable)), interval(period) {}
+
+        /**
+         * Name of the job, used to identify it in runtime statistics.
+         */
+        std::string name;
 
         /**
          * A task to be run at regular intervals by the runner.
@@ -88,6 +97,12 @@ public:
      * runner should no longer execute once shutdown() is called.
      */
     virtual void shutdown() = 0;
+
+    /**
+     * Appends one subobject of runtime statistics per scheduled job to "bob", keyed by job
+     * name.
+     */
+    virtual void appendStats(BSONObjBuilder* bob) const = 0;
 };
 
 }  // namespace mongo
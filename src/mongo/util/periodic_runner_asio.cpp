@@ -35,8 +35,10 @@
 
 #include "mongo/util/periodic_runner_asio.h"
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/client.h"
 #include "mongo/util/log.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -84,19 +86,35 @@ void PeriodicRunnerASIO::_scheduleJob(std::weak_ptr<PeriodicJobASIO> job) {
             return;
         }
 
-        stdx::unique_lock<stdx::mutex> lk(_stateMutex);
-        if (_state != State::kRunning) {
-            return;
-        }
+        std::shared_ptr<PeriodicJobASIO> lockedJob;
+        {
+            stdx::unique_lock<stdx::mutex> lk(_stateMutex);
+            if (_state != State::kRunning) {
+                return;
+            }
 
-        auto lockedJob = job.lock();
-        if (!lockedJob) {
-            return;
+            lockedJob = job.lock();
+            if (!lockedJob) {
+                return;
+            }
+
+            lockedJob->start = _timerFactory->now();
         }
 
-        lockedJob->start = _timerFactory->now();
+        // Run the job without holding _stateMutex, so that a long-running job does not block
+        // scheduleJob(), shutdown(), or appendStats(). The job object is kept alive by the
+        // shared_ptr even if the runner clears its job list concurrently.
+        Timer timer;
         lockedJob->job();
 
+        const long long millis = timer.millis();
+        lockedJob->runs.addAndFetch(1);
+        lockedJob->totalExecutionMillis.addAndFetch(millis);
+        lockedJob->lastExecutionMillis.store(millis);
+        if (millis > lockedJob->maxExecutionMillis.load()) {
+            lockedJob->maxExecutionMillis.store(millis);
+        }
+
         _io_service.post([this, job]() mutable { _scheduleJob(job); });
     });
 }
@@ -134,6 +152,18 @@ Status PeriodicRunnerASIO::startup() {
     return Status::OK();
 }
 
+void PeriodicRunnerASIO::appendStats(BSONObjBuilder* bob) const {
+    stdx::lock_guard<stdx::mutex> lk(_stateMutex);
+    for (auto&& job : _jobs) {
+        BSONObjBuilder sub(bob->subobjStart(job->name));
+        sub.append("intervalMillis", durationCount<Milliseconds>(job->interval));
+        sub.append("runs", job->runs.load());
+        sub.append("totalExecutionMillis", job->totalExecutionMillis.load());
+        sub.append("lastExecutionMillis", job->lastExecutionMillis.load());
+        sub.append("maxExecutionMillis", job->maxExecutionMillis.load());
+    }
+}
+
 void PeriodicRunnerASIO::shutdown() {
     stdx::unique_lock<stdx::mutex> lk(_stateMutex);
     if (_state == State::kRunning) {
@@ -83,19 +83,34 @@ public:
      */
     void shutdown() override;
 
+    /**
+     * Append runtime statistics for each scheduled job: the number of completed runs and the
+     * total, last, and maximum execution time. Statistics are updated by the runner thread as
+     * jobs complete, so a job's currently executing run is not reflected.
+     */
+    void appendStats(BSONObjBuilder* bob) const override;
+
 private:
     struct PeriodicJobASIO {
         explicit PeriodicJobASIO(PeriodicJob callable,
                                  Date_t startTime,
                                  std::shared_ptr<executor::AsyncTimerInterface> sharedTimer)
-            : job(std::move(callable.job)),
+            : name(std::move(callable.name)),
+              job(std::move(callable.job)),
               interval(callable.interval),
               start(startTime),
               timer(sharedTimer) {}
+        std::string name;
         Job job;
         Milliseconds interval;
         Date_t start;
         std::shared_ptr<executor::AsyncTimerInterface> timer;
+
+        // Execution statistics, updated by the runner thread after each run.
+        AtomicInt64 runs{0};
+        AtomicInt64 totalExecutionMillis{0};
+        AtomicInt64 lastExecutionMillis{0};
+        AtomicInt64 maxExecutionMillis{0};
     };
 
     // Internally, we will transition through these states
@@ -110,7 +125,7 @@ private:
 
     std::unique_ptr<executor::AsyncTimerFactoryInterface> _timerFactory;
 
-    stdx::mutex _stateMutex;
+    mutable stdx::mutex _stateMutex;
     State _state;
 
     std::vector<std::shared_ptr<PeriodicJobASIO>> _jobs;
@@ -28,6 +28,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/executor/async_timer_interface.h"
 #include "mongo/executor/async_timer_mock.h"
 #include "mongo/stdx/condition_variable.h"
@@ -91,6 +92,7 @@ TEST_F(PeriodicRunnerASIOTest, OneJobTest) {
 
     // Add a job, ensure that it runs once
     PeriodicRunner::PeriodicJob job(
+        "job",
         [&count, &mutex, &cv] {
             {
                 stdx::unique_lock<stdx::mutex> lk(mutex);
@@ -128,6 +130,7 @@ TEST_F(PeriodicRunnerASIOTestNoSetup, ScheduleBeforeStartupTest) {
 
     // Schedule a job before startup
     PeriodicRunner::PeriodicJob job(
+        "job",
         [&count, &mutex, &cv] {
             {
                 stdx::unique_lock<stdx::mutex> lk(mutex);
@@ -153,7 +156,7 @@ TEST_F(PeriodicRunnerASIOTest, ScheduleAfterShutdownTest) {
     Milliseconds interval{5};
 
     // Schedule a job before shutdown
-    PeriodicRunner::PeriodicJob job([&count] { count++; }, interval);
+    PeriodicRunner::PeriodicJob job("job", [&count] { count++; }, interval);
 
     runner()->scheduleJob(std::move(job));
 
@@ -185,6 +188,7 @@ TEST_F(PeriodicRunnerASIOTest, TwoJobsTest) {
 
     // Add two jobs, ensure they both run the proper number of times
     PeriodicRunner::PeriodicJob jobA(
+        "jobA",
         [&countA, &mutex, &cv] {
             {
                 stdx::unique_lock<stdx::mutex> lk(mutex);
@@ -195,6 +199,7 @@ TEST_F(PeriodicRunnerASIOTest, TwoJobsTest) {
         intervalA);
 
     PeriodicRunner::PeriodicJob jobB(
+        "jobB",
         [&countB, &mutex, &cv] {
             {
                 stdx::unique_lock<stdx::mutex> lk(mutex);
@@ -218,5 +223,63 @@ TEST_F(PeriodicRunnerASIOTest, TwoJobsTest) {
     }
 }
 
+TEST_F(PeriodicRunnerASIOTest, StatsTest) {
+    int count = 0;
+    Milliseconds interval{5};
+
+    stdx::mutex mutex;
+    stdx::condition_variable cv;
+
+    PeriodicRunner::PeriodicJob job(
+        "statsJob",
+        [&count, &mutex, &cv] {
+            {
+                stdx::unique_lock<stdx::mutex> lk(mutex);
+                count++;
+            }
+            cv.notify_all();
+        },
+        interval);
+
+    runner()->scheduleJob(std::move(job));
+
+    // Before the job has run it is reported with zero runs.
+    {
+        BSONObjBuilder bob;
+        runner()->appendStats(&bob);
+        auto stats = bob.obj();
+        ASSERT_EQ(stats["statsJob"]["runs"].numberLong(), 0);
+        ASSERT_EQ(stats["statsJob"]["intervalMillis"].numberLong(), 5);
+    }
+
+    // Run the job three times.
+    for (int i = 0; i < 3; i++) {
+        timerFactory().fastForward(interval);
+        {
+            stdx::unique_lock<stdx::mutex> lk(mutex);
+            cv.wait(lk, [&count, &i] { return count > i; });
+        }
+        sleepForReschedule(2);
+    }
+
+    // Statistics are updated after the job body returns, so poll until the final run has been
+    // recorded.
+    BSONObj jobStats;
+    while (true) {
+        BSONObjBuilder bob;
+        runner()->appendStats(&bob);
+        auto stats = bob.obj();
+        jobStats = stats["statsJob"].Obj().getOwned();
+        if (jobStats["runs"].numberLong() == 3) {
+            break;
+        }
+        sleepmillis(2);
+    }
+    ASSERT_GTE(jobStats["totalExecutionMillis"].numberLong(),
+               jobStats["maxExecutionMillis"].numberLong());
+    ASSERT_GTE(jobStats["maxExecutionMillis"].numberLong(),
+               jobStats["lastExecutionMillis"].numberLong());
+}
+
 }  // namespace
 }  // namespace mongo
@@ -38,6 +38,10 @@
 #include <fstream>
 #include <iostream>
 
+#if !defined(_WIN32)
+#include <time.h>
+#endif
+
 #include "mongo/util/log.h"
 
 using namespace std;
@@ -80,6 +84,31 @@ bool writePidFile(const string& path) {
     return pidFileWiper.write(path);
 }
 
+long long getThreadCpuTimeMicros() {
+#if defined(__linux__)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return -1;
+    }
+    return static_cast<long long>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#elif defined(_WIN32)
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return -1;
+    }
+    // FILETIMEs are expressed in 100-nanosecond units.
+    const auto toMicros = [](const FILETIME& ft) {
+        return ((static_cast<long long>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) / 10;
+    };
+    return toMicros(kernelTime) + toMicros(userTime);
+#else
+    return -1;
+#endif
+}
+
 ProcessInfo::SystemInfo* ProcessInfo::systemInfo = NULL;
 
 void ProcessInfo::initializeSystemInfo() {
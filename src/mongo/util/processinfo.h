@@ -245,4 +245,10 @@ public:
 };
 
 bool writePidFile(const std::string& path);
+
+/**
+ * Returns the CPU time consumed so far by the calling thread, in microseconds, or -1 if the
+ * platform offers no cheap way to read it. Cheap enough to call once per operation.
+ */
+long long getThreadCpuTimeMicros();
 }